@@ -0,0 +1,65 @@
+#pragma once
+
+#include <iomanip>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/hana/for_each.hpp>
+
+#include "all_type_variant.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+// Returns the type string of T as used by Table::add_column, e.g., "int" for int32_t.
+template <typename T>
+std::string benchmark_type_string() {
+  auto type_string = std::string{};
+  hana::for_each(data_types, [&](const auto data_type) {
+    using DataType = typename decltype(+hana::second(data_type))::type;
+    if constexpr (std::is_same_v<DataType, T>) type_string = hana::first(data_type);
+  });
+  return type_string;
+}
+
+// Returns a value of type T that is unique for the given index. Values of larger indices are greater for all types,
+// i.e., strings are zero-padded.
+template <typename T>
+T make_benchmark_value(const size_t index) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    auto stream = std::stringstream{};
+    stream << "value_" << std::setw(10) << std::setfill('0') << index;
+    return stream.str();
+  } else {
+    return static_cast<T>(index);
+  }
+}
+
+// Returns row_count values with distinct_count distinct values in random order.
+template <typename T>
+std::vector<T> make_benchmark_values(const size_t row_count, const size_t distinct_count, const uint32_t seed = 42) {
+  auto generator = std::mt19937{seed};
+  auto distribution = std::uniform_int_distribution<size_t>{0, distinct_count - 1};
+
+  auto values = std::vector<T>{};
+  values.reserve(row_count);
+  for (auto row = size_t{0}; row < row_count; ++row) {
+    values.push_back(make_benchmark_value<T>(distribution(generator)));
+  }
+  return values;
+}
+
+// Creates a ValueSegment holding the given values.
+template <typename T>
+std::shared_ptr<ValueSegment<T>> make_benchmark_value_segment(const std::vector<T>& values) {
+  auto value_segment = std::make_shared<ValueSegment<T>>();
+  for (const auto& value : values) {
+    value_segment->append(value);
+  }
+  return value_segment;
+}
+
+}  // namespace opossum
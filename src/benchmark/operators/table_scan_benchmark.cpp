@@ -0,0 +1,165 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "micro_benchmark_utils.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr auto ROW_COUNT = size_t{1} << 20;
+constexpr auto VALUE_RANGE = size_t{1} << 20;
+constexpr auto TIMESTAMP_BASE = int64_t{1'600'000'000'000};
+
+// Returns ROW_COUNT timestamp-like values, which are mostly distinct but lie in a narrow range.
+std::vector<int64_t> make_timestamps() {
+  auto values = make_benchmark_values<int64_t>(ROW_COUNT, VALUE_RANGE);
+  for (auto& value : values) {
+    value += TIMESTAMP_BASE;
+  }
+  return values;
+}
+
+// Creates a table with a single chunk of the given values. state.range(0) selects the encoding: none, dictionary,
+// frame-of-reference, or delta.
+std::shared_ptr<TableWrapper> setup_table_wrapper(benchmark::State& state, const std::vector<int64_t>& values) {
+  auto table = std::make_shared<Table>(ROW_COUNT);
+  table->set_background_compression(false);
+  table->add_column("a", "long");
+  table->append_columns({make_benchmark_value_segment(values)});
+  if (state.range(0) == 1) table->compress_chunk(ChunkID{0}, EncodingType::Dictionary);
+  if (state.range(0) == 2) table->compress_chunk(ChunkID{0}, EncodingType::FrameOfReference);
+  if (state.range(0) == 3) table->compress_chunk(ChunkID{0}, EncodingType::Delta);
+  state.counters["segment_bytes"] =
+      static_cast<double>(table->get_chunk(ChunkID{0}).get_segment(ColumnID{0})->estimate_memory_usage());
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  return table_wrapper;
+}
+
+// Scans for the smallest percent of the values
+void scan_smallest_percent(benchmark::State& state, const std::shared_ptr<TableWrapper>& table_wrapper) {
+  const auto search_value = TIMESTAMP_BASE + static_cast<int64_t>(VALUE_RANGE / 100);
+  for (auto _ : state) {
+    auto table_scan = TableScan{table_wrapper, ColumnID{0}, ScanType::OpLessThan, search_value};
+    table_scan.execute();
+    benchmark::DoNotOptimize(table_scan.get_output());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * ROW_COUNT));
+}
+
+// Returns ROW_COUNT URL-like values, which are mostly distinct but share many substrings
+std::vector<std::string> make_urls() {
+  auto values = std::vector<std::string>{};
+  values.reserve(ROW_COUNT);
+  for (const auto id : make_benchmark_values<int64_t>(ROW_COUNT, VALUE_RANGE)) {
+    values.push_back("https://www.example.com/catalog/" + std::to_string(id % 50) + "/products/" + std::to_string(id) +
+                     "?utm_source=newsletter");
+  }
+  return values;
+}
+
+// Creates a table with a single chunk of URLs. state.range(0) selects the encoding: none, dictionary, or FSST.
+std::shared_ptr<TableWrapper> setup_url_table_wrapper(benchmark::State& state, const std::vector<std::string>& values) {
+  auto table = std::make_shared<Table>(ROW_COUNT);
+  table->set_background_compression(false);
+  table->add_column("a", "string");
+  table->append_columns({make_benchmark_value_segment(values)});
+  if (state.range(0) == 1) table->compress_chunk(ChunkID{0}, EncodingType::Dictionary);
+  if (state.range(0) == 2) table->compress_chunk(ChunkID{0}, EncodingType::Fsst);
+  state.counters["segment_bytes"] =
+      static_cast<double>(table->get_chunk(ChunkID{0}).get_segment(ColumnID{0})->estimate_memory_usage());
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  return table_wrapper;
+}
+
+}  // namespace
+
+void BM_TableScanEncodings(benchmark::State& state) {
+  scan_smallest_percent(state, setup_table_wrapper(state, make_timestamps()));
+}
+
+// The same values in insertion order, as in append-only tables with increasing timestamps
+void BM_TableScanSortedEncodings(benchmark::State& state) {
+  auto values = make_timestamps();
+  std::sort(values.begin(), values.end());
+  scan_smallest_percent(state, setup_table_wrapper(state, values));
+}
+
+// Sorted timestamps in chunks of state.range(0) rows, of which the scan only needs the first percent. The zone maps
+// of the dictionary-encoded chunks let the scan skip all others.
+void BM_TableScanZoneMaps(benchmark::State& state) {
+  auto values = make_timestamps();
+  std::sort(values.begin(), values.end());
+  auto table = std::make_shared<Table>(static_cast<ChunkOffset>(state.range(0)));
+  table->set_background_compression(false);
+  table->add_column("a", "long");
+  table->append_columns({make_benchmark_value_segment(values)});
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    if (table->get_chunk(chunk_id).size() == table->target_chunk_size()) table->compress_chunk(chunk_id);
+  }
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  scan_smallest_percent(state, table_wrapper);
+}
+
+// Point lookups of user IDs in an unclustered column of 64K-row dictionary-encoded chunks, whose zone maps cover
+// almost the whole value range. Most looked up IDs do not exist. state.range(0) enables Bloom filters with a
+// false-positive rate of 1%.
+void BM_TableScanBloomFilters(benchmark::State& state) {
+  constexpr auto chunk_size = ChunkOffset{1} << 16;
+  constexpr auto user_id_range = size_t{1} << 30;
+  const auto values = make_benchmark_values<int64_t>(ROW_COUNT, user_id_range);
+  auto table = std::make_shared<Table>(chunk_size);
+  table->set_background_compression(false);
+  if (state.range(0)) table->set_bloom_filter_false_positive_rate(0.01);
+  table->add_column("a", "long");
+  table->append_columns({make_benchmark_value_segment(values)});
+  auto segment_bytes = size_t{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    table->compress_chunk(chunk_id);
+    segment_bytes += table->get_chunk(chunk_id).get_segment(ColumnID{0})->estimate_memory_usage();
+  }
+  state.counters["segment_bytes"] = static_cast<double>(segment_bytes);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  const auto search_values = make_benchmark_values<int64_t>(1024, user_id_range, 7);
+  auto lookup = size_t{0};
+  for (auto _ : state) {
+    auto table_scan = TableScan{table_wrapper, ColumnID{0}, ScanType::OpEquals, search_values[lookup++ % 1024]};
+    table_scan.execute();
+    benchmark::DoNotOptimize(table_scan.get_output());
+  }
+}
+
+// Point lookup of a single URL in a high-cardinality string column
+void BM_TableScanStringEncodings(benchmark::State& state) {
+  const auto values = make_urls();
+  const auto table_wrapper = setup_url_table_wrapper(state, values);
+  for (auto _ : state) {
+    auto table_scan = TableScan{table_wrapper, ColumnID{0}, ScanType::OpEquals, values[ROW_COUNT / 2]};
+    table_scan.execute();
+    benchmark::DoNotOptimize(table_scan.get_output());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * ROW_COUNT));
+}
+
+BENCHMARK(BM_TableScanEncodings)->DenseRange(0, 3)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_TableScanSortedEncodings)->DenseRange(0, 3)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_TableScanZoneMaps)->RangeMultiplier(16)->Range(1 << 12, 1 << 20)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_TableScanBloomFilters)->DenseRange(0, 1)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_TableScanStringEncodings)->DenseRange(0, 2)->Unit(benchmark::kMicrosecond);
+
+}  // namespace opossum
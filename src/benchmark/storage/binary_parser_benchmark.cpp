@@ -0,0 +1,49 @@
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "micro_benchmark_utils.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr auto ROW_COUNT = size_t{1} << 24;
+constexpr auto CHUNK_SIZE = ChunkOffset{1} << 16;
+
+// Saves a table of ROW_COUNT rows in two dictionary-encoded columns once and returns the file name.
+const std::string& benchmark_binary_file() {
+  static const auto file_name = [] {
+    const auto path = (std::filesystem::temp_directory_path() / "opossum_binary_parser_benchmark.bin").string();
+    auto table = Table{CHUNK_SIZE};
+    table.add_column("a", "long");
+    table.add_column("b", "double");
+    table.append_columns({make_benchmark_value_segment(make_benchmark_values<int64_t>(ROW_COUNT, 1'000)),
+                          make_benchmark_value_segment(make_benchmark_values<double>(ROW_COUNT, 100'000))});
+    table.wait_for_background_compressions();
+    table.save(path);
+    return path;
+  }();
+  return file_name;
+}
+
+}  // namespace
+
+// Loads the table, using its dictionaries and attribute vectors in place from the mapped file if state.range(0) is set.
+void BM_LoadBinaryTableMemoryMapped(benchmark::State& state) {
+  const auto& file_name = benchmark_binary_file();
+  for (auto _ : state) {
+    const auto table = Table::load(file_name, state.range(0));
+    benchmark::DoNotOptimize(table->row_count());
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * std::filesystem::file_size(file_name)));
+}
+
+BENCHMARK(BM_LoadBinaryTableMemoryMapped)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+}  // namespace opossum
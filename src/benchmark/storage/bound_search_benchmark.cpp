@@ -0,0 +1,84 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "micro_benchmark_utils.hpp"
+#include "storage/dictionary_segment.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr auto PROBE_COUNT = size_t{1024};
+
+// The linear search that DictionarySegment used before the BoundSearch was introduced. Kept as a baseline.
+template <typename T>
+ValueID linear_lower_bound(const DictionarySegment<T>& segment, const T& value) {
+  const auto dictionary_size = segment.unique_values_count();
+  for (auto value_id = ValueID{0}; value_id < dictionary_size; ++value_id) {
+    if (segment.value_by_value_id(value_id) >= value) return value_id;
+  }
+  return INVALID_VALUE_ID;
+}
+
+// Creates a dictionary segment with state.range(0) distinct values and search values that are spread over the
+// dictionary, half of them being contained in it.
+template <typename T>
+std::pair<std::shared_ptr<DictionarySegment<T>>, std::vector<T>> setup(const benchmark::State& state) {
+  const auto dictionary_size = static_cast<size_t>(state.range(0));
+  auto values = std::vector<T>{};
+  values.reserve(dictionary_size);
+  for (auto index = size_t{0}; index < dictionary_size; ++index) {
+    values.push_back(make_benchmark_value<T>(2 * index));
+  }
+  auto segment = std::make_shared<DictionarySegment<T>>(make_benchmark_value_segment(values));
+
+  auto probe_indices = make_benchmark_values<size_t>(PROBE_COUNT, 2 * dictionary_size);
+  auto probes = std::vector<T>{};
+  probes.reserve(PROBE_COUNT);
+  for (const auto probe_index : probe_indices) {
+    probes.push_back(make_benchmark_value<T>(probe_index));
+  }
+
+  return {segment, probes};
+}
+
+template <typename T>
+void BM_BoundSearchLinear(benchmark::State& state) {
+  const auto [segment, probes] = setup<T>(state);
+  auto probe_index = size_t{0};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(linear_lower_bound(*segment, probes[probe_index]));
+    probe_index = (probe_index + 1) % PROBE_COUNT;
+  }
+}
+
+template <typename T>
+void BM_BoundSearch(benchmark::State& state) {
+  const auto [segment, probes] = setup<T>(state);
+  state.counters["segment_bytes"] = static_cast<double>(segment->estimate_memory_usage());
+  auto probe_index = size_t{0};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(segment->lower_bound(probes[probe_index]));
+    probe_index = (probe_index + 1) % PROBE_COUNT;
+  }
+}
+
+}  // namespace
+
+// The linear search is not run on the largest dictionaries since a single lookup takes milliseconds there.
+BENCHMARK_TEMPLATE(BM_BoundSearchLinear, int32_t)->RangeMultiplier(8)->Range(1 << 6, 1 << 18);
+BENCHMARK_TEMPLATE(BM_BoundSearchLinear, int64_t)->RangeMultiplier(8)->Range(1 << 6, 1 << 18);
+BENCHMARK_TEMPLATE(BM_BoundSearchLinear, float)->RangeMultiplier(8)->Range(1 << 6, 1 << 18);
+BENCHMARK_TEMPLATE(BM_BoundSearchLinear, double)->RangeMultiplier(8)->Range(1 << 6, 1 << 18);
+BENCHMARK_TEMPLATE(BM_BoundSearchLinear, std::string)->RangeMultiplier(8)->Range(1 << 6, 1 << 15);
+
+BENCHMARK_TEMPLATE(BM_BoundSearch, int32_t)->RangeMultiplier(8)->Range(1 << 6, 1 << 21);
+BENCHMARK_TEMPLATE(BM_BoundSearch, int64_t)->RangeMultiplier(8)->Range(1 << 6, 1 << 21);
+BENCHMARK_TEMPLATE(BM_BoundSearch, float)->RangeMultiplier(8)->Range(1 << 6, 1 << 21);
+BENCHMARK_TEMPLATE(BM_BoundSearch, double)->RangeMultiplier(8)->Range(1 << 6, 1 << 21);
+BENCHMARK_TEMPLATE(BM_BoundSearch, std::string)->RangeMultiplier(8)->Range(1 << 6, 1 << 21);
+
+}  // namespace opossum
@@ -0,0 +1,86 @@
+#include <algorithm>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "micro_benchmark_utils.hpp"
+#include "storage/dictionary_builder.hpp"
+
+namespace opossum {
+
+namespace {
+
+// The std::set-based encoding that DictionarySegment used before the DictionaryBuilder was introduced. Kept as a
+// baseline.
+template <typename T>
+BuiltDictionary<T> build_with_set(const std::vector<T>& values) {
+  auto raw_dictionary = values;
+  auto raw_values = raw_dictionary;
+  const auto distinct_values = std::set<T>(raw_dictionary.begin(), raw_dictionary.end());
+  raw_dictionary.assign(distinct_values.begin(), distinct_values.end());
+
+  auto built_dictionary = BuiltDictionary<T>{raw_dictionary, std::vector<ValueID>(raw_values.size())};
+  for (auto row = size_t{0}; row < raw_values.size(); ++row) {
+    const auto iterator = std::lower_bound(raw_dictionary.begin(), raw_dictionary.end(), raw_values[row]);
+    built_dictionary.value_ids[row] = ValueID{static_cast<ValueID::base_type>(iterator - raw_dictionary.begin())};
+  }
+  return built_dictionary;
+}
+
+// state.range(0) is the number of rows, state.range(1) the number of distinct values, and state.range(2) whether the
+// values are sorted.
+template <typename T>
+std::vector<T> setup(const benchmark::State& state) {
+  auto values = make_benchmark_values<T>(state.range(0), state.range(1));
+  if (state.range(2)) std::sort(values.begin(), values.end());
+  return values;
+}
+
+template <typename T>
+void BM_DictionaryBuildWithSet(benchmark::State& state) {
+  const auto values = setup<T>(state);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(build_with_set(values));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T>
+void BM_DictionaryBuilder(benchmark::State& state) {
+  const auto values = setup<T>(state);
+  const auto builder = DictionaryBuilder<T>{};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(builder.build(values));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void builder_arguments(benchmark::internal::Benchmark* benchmark) {
+  for (const auto row_count : {1 << 16, 1 << 22}) {
+    for (const auto distinct_count : {100, row_count / 2}) {
+      for (const auto sorted : {0, 1}) {
+        benchmark->Args({row_count, distinct_count, sorted});
+      }
+    }
+  }
+  benchmark->ArgNames({"rows", "distinct", "sorted"})->Unit(benchmark::kMillisecond)->UseRealTime();
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_DictionaryBuildWithSet, int32_t)->Apply(builder_arguments);
+BENCHMARK_TEMPLATE(BM_DictionaryBuildWithSet, int64_t)->Apply(builder_arguments);
+BENCHMARK_TEMPLATE(BM_DictionaryBuildWithSet, float)->Apply(builder_arguments);
+BENCHMARK_TEMPLATE(BM_DictionaryBuildWithSet, double)->Apply(builder_arguments);
+BENCHMARK_TEMPLATE(BM_DictionaryBuildWithSet, std::string)->Apply(builder_arguments);
+
+BENCHMARK_TEMPLATE(BM_DictionaryBuilder, int32_t)->Apply(builder_arguments);
+BENCHMARK_TEMPLATE(BM_DictionaryBuilder, int64_t)->Apply(builder_arguments);
+BENCHMARK_TEMPLATE(BM_DictionaryBuilder, float)->Apply(builder_arguments);
+BENCHMARK_TEMPLATE(BM_DictionaryBuilder, double)->Apply(builder_arguments);
+BENCHMARK_TEMPLATE(BM_DictionaryBuilder, std::string)->Apply(builder_arguments);
+
+}  // namespace opossum
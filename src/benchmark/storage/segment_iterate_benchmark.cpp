@@ -0,0 +1,119 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "micro_benchmark_utils.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "type_cast.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr auto ROW_COUNT = size_t{1} << 16;
+
+// Consumes a value so that reading it cannot be optimized away, without letting the consumption dominate the cost.
+template <typename T>
+int64_t consume(const T& value) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    return static_cast<int64_t>(value.size());
+  } else {
+    return static_cast<int64_t>(value);
+  }
+}
+
+// Creates a table with a single chunk of ROW_COUNT rows and state.range(0) distinct values. If state.range(1) is set,
+// the chunk is dictionary-encoded.
+template <typename T>
+std::shared_ptr<Table> setup_table(const benchmark::State& state) {
+  auto table = std::make_shared<Table>(ROW_COUNT);
+  table->add_column("a", benchmark_type_string<T>());
+  for (const auto& value : make_benchmark_values<T>(ROW_COUNT, state.range(0))) {
+    table->append({value});
+  }
+  if (state.range(1)) table->compress_chunk(ChunkID{0});
+  return table;
+}
+
+// Creates a ReferenceSegment pointing to every other row of the table.
+std::shared_ptr<ReferenceSegment> setup_reference_segment(const std::shared_ptr<Table>& table) {
+  auto pos_list = std::make_shared<PosList>();
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < ROW_COUNT; chunk_offset += 2) {
+    pos_list->push_back(RowID{ChunkID{0}, chunk_offset});
+  }
+  return std::make_shared<ReferenceSegment>(table, ColumnID{0}, pos_list);
+}
+
+template <typename T>
+void BM_SegmentAccessOperator(benchmark::State& state, const BaseSegment& segment) {
+  const auto size = segment.size();
+  for (auto _ : state) {
+    auto sum = int64_t{0};
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < size; ++chunk_offset) {
+      sum += consume(type_cast<T>(segment[chunk_offset]));
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * size);
+}
+
+template <typename T>
+void BM_SegmentAccessIterate(benchmark::State& state, const BaseSegment& segment) {
+  const auto size = segment.size();
+  for (auto _ : state) {
+    auto sum = int64_t{0};
+    segment_iterate<T>(segment, [&](const SegmentPosition<T>& position) { sum += consume(position.value()); });
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * size);
+}
+
+template <typename T>
+void BM_SegmentOperator(benchmark::State& state) {
+  const auto table = setup_table<T>(state);
+  BM_SegmentAccessOperator<T>(state, *table->get_chunk(ChunkID{0}).get_segment(ColumnID{0}));
+}
+
+template <typename T>
+void BM_SegmentIterate(benchmark::State& state) {
+  const auto table = setup_table<T>(state);
+  BM_SegmentAccessIterate<T>(state, *table->get_chunk(ChunkID{0}).get_segment(ColumnID{0}));
+}
+
+template <typename T>
+void BM_ReferenceSegmentOperator(benchmark::State& state) {
+  const auto table = setup_table<T>(state);
+  BM_SegmentAccessOperator<T>(state, *setup_reference_segment(table));
+}
+
+template <typename T>
+void BM_ReferenceSegmentIterate(benchmark::State& state) {
+  const auto table = setup_table<T>(state);
+  BM_SegmentAccessIterate<T>(state, *setup_reference_segment(table));
+}
+
+// Arguments: number of distinct values (a bit-packed and a one-byte attribute vector), dictionary-encoded or not
+void segment_arguments(benchmark::internal::Benchmark* benchmark) {
+  benchmark->Args({1000, 0});
+  benchmark->Args({1000, 1});
+  benchmark->Args({200, 1});
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_SegmentOperator, int32_t)->Apply(segment_arguments);
+BENCHMARK_TEMPLATE(BM_SegmentIterate, int32_t)->Apply(segment_arguments);
+BENCHMARK_TEMPLATE(BM_SegmentOperator, std::string)->Apply(segment_arguments);
+BENCHMARK_TEMPLATE(BM_SegmentIterate, std::string)->Apply(segment_arguments);
+
+BENCHMARK_TEMPLATE(BM_ReferenceSegmentOperator, int32_t)->Apply(segment_arguments);
+BENCHMARK_TEMPLATE(BM_ReferenceSegmentIterate, int32_t)->Apply(segment_arguments);
+BENCHMARK_TEMPLATE(BM_ReferenceSegmentOperator, std::string)->Apply(segment_arguments);
+BENCHMARK_TEMPLATE(BM_ReferenceSegmentIterate, std::string)->Apply(segment_arguments);
+
+}  // namespace opossum
@@ -0,0 +1,110 @@
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr auto TABLE_COUNT = 64;
+constexpr auto LOOKUP_COUNT = 1 << 16;
+
+std::vector<std::string> benchmark_table_names() {
+  auto names = std::vector<std::string>{};
+  for (auto table_index = 0; table_index < TABLE_COUNT; ++table_index) {
+    names.push_back("table_" + std::to_string(table_index));
+  }
+  return names;
+}
+
+// Looks up LOOKUP_COUNT tables from each of state.range(0) threads via get_table. With state.range(1) set, another
+// thread keeps adding and dropping a table meanwhile.
+template <typename GetTable, typename AddAndDropTable>
+void run_readers(benchmark::State& state, const std::vector<std::string>& names, const GetTable& get_table,
+                 const AddAndDropTable& add_and_drop_table) {
+  const auto thread_count = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    auto readers_done = std::atomic_bool{false};
+    auto writer = std::thread{};
+    if (state.range(1)) {
+      writer = std::thread{[&] {
+        while (!readers_done) add_and_drop_table();
+      }};
+    }
+
+    auto readers = std::vector<std::thread>{};
+    for (auto thread_index = 0; thread_index < thread_count; ++thread_index) {
+      readers.emplace_back([&, thread_index] {
+        for (auto lookup = 0; lookup < LOOKUP_COUNT; ++lookup) {
+          benchmark::DoNotOptimize(get_table(names[(lookup + thread_index) % TABLE_COUNT]));
+        }
+      });
+    }
+    for (auto& reader : readers) {
+      reader.join();
+    }
+    readers_done = true;
+    if (writer.joinable()) writer.join();
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * thread_count * LOOKUP_COUNT);
+}
+
+}  // namespace
+
+void BM_StorageManagerGetTable(benchmark::State& state) {
+  const auto names = benchmark_table_names();
+  auto& storage_manager = StorageManager::get();
+  for (const auto& name : names) {
+    storage_manager.add_table(name, std::make_shared<Table>());
+  }
+
+  run_readers(
+      state, names, [&](const std::string& name) { return storage_manager.get_table(name); },
+      [&] {
+        storage_manager.add_table("other_table", std::make_shared<Table>());
+        storage_manager.drop_table("other_table");
+      });
+  storage_manager.reset();
+}
+
+// Looks up the tables in a map behind a single mutex, as callers had to do before the StorageManager was thread-safe.
+void BM_StorageManagerGetTableWithLock(benchmark::State& state) {
+  const auto names = benchmark_table_names();
+  auto tables = std::unordered_map<std::string, std::shared_ptr<Table>>{};
+  for (const auto& name : names) {
+    tables.emplace(name, std::make_shared<Table>());
+  }
+
+  auto mutex = std::mutex{};
+  run_readers(
+      state, names,
+      [&](const std::string& name) {
+        std::lock_guard<std::mutex> lock(mutex);
+        return tables.at(name);
+      },
+      [&] {
+        std::lock_guard<std::mutex> lock(mutex);
+        tables.emplace("other_table", std::make_shared<Table>());
+        tables.erase("other_table");
+      });
+}
+
+BENCHMARK(BM_StorageManagerGetTable)
+    ->ArgsProduct({{1, 2, 4, 8, 16}, {0, 1}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK(BM_StorageManagerGetTableWithLock)
+    ->ArgsProduct({{1, 2, 4, 8, 16}, {0, 1}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+}  // namespace opossum
@@ -0,0 +1,105 @@
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "micro_benchmark_utils.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr auto ROW_COUNT = 1 << 20;
+constexpr auto CHUNK_SIZE = ChunkOffset{1} << 16;
+
+// Appends ROW_COUNT rows to a new table from state.range(0) threads, each appending an equal share via append_row.
+template <typename AppendRow>
+void run_writers(benchmark::State& state, const AppendRow& append_row) {
+  const auto thread_count = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    auto table = Table{CHUNK_SIZE};
+    table.set_background_compression(false);
+    table.add_column("a", "int");
+    table.add_column("b", "float");
+
+    auto threads = std::vector<std::thread>{};
+    for (auto thread_index = 0; thread_index < thread_count; ++thread_index) {
+      threads.emplace_back([&, thread_index] {
+        for (auto row = thread_index; row < ROW_COUNT; row += thread_count) {
+          append_row(table, {row, static_cast<float>(row)});
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    table.finish_concurrent_appends();
+    benchmark::DoNotOptimize(table.row_count());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * ROW_COUNT);
+}
+
+}  // namespace
+
+void BM_TableAppendConcurrently(benchmark::State& state) {
+  run_writers(state, [](Table& table, const std::vector<AllTypeVariant>& values) {
+    table.append_concurrently(values);
+  });
+}
+
+// Serializes Table::append behind an external lock, as ingestion had to do before append_concurrently.
+void BM_TableAppendWithLock(benchmark::State& state) {
+  auto mutex = std::mutex{};
+  run_writers(state, [&](Table& table, const std::vector<AllTypeVariant>& values) {
+    std::lock_guard<std::mutex> lock(mutex);
+    table.append(values);
+  });
+}
+
+// Loads ROW_COUNT rows of a single column of type T row by row.
+template <typename T>
+void BM_TableAppendRows(benchmark::State& state) {
+  const auto values = make_benchmark_values<T>(ROW_COUNT, ROW_COUNT);
+  for (auto _ : state) {
+    auto table = Table{CHUNK_SIZE};
+    table.set_background_compression(false);
+    table.add_column("a", benchmark_type_string<T>());
+    for (const auto& value : values) {
+      table.append({value});
+    }
+    benchmark::DoNotOptimize(table.row_count());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * ROW_COUNT);
+}
+
+// Loads the same rows with a single column batch. Copying the values into the batch is not measured, as a loader
+// would produce the batch directly.
+template <typename T>
+void BM_TableAppendColumns(benchmark::State& state) {
+  const auto values = make_benchmark_values<T>(ROW_COUNT, ROW_COUNT);
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto table = Table{CHUNK_SIZE};
+    table.set_background_compression(false);
+    table.add_column("a", benchmark_type_string<T>());
+    const auto column_batch = std::make_shared<ValueSegment<T>>(std::vector<T>{values});
+    state.ResumeTiming();
+
+    table.append_columns({column_batch});
+    benchmark::DoNotOptimize(table.row_count());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * ROW_COUNT);
+}
+
+BENCHMARK_TEMPLATE(BM_TableAppendRows, int32_t)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_TableAppendRows, std::string)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_TableAppendColumns, int32_t)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_TableAppendColumns, std::string)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TableAppendConcurrently)->RangeMultiplier(2)->Range(1, 16)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TableAppendWithLock)->RangeMultiplier(2)->Range(1, 16)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+}  // namespace opossum
@@ -0,0 +1,63 @@
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include "benchmark/benchmark.h"
+
+#include "micro_benchmark_utils.hpp"
+#include "storage/table.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr auto ROW_COUNT = size_t{1} << 20;
+constexpr auto CHUNK_SIZE = size_t{1} << 16;
+
+// Writes a .tbl file with ROW_COUNT rows of an int, a float, and a string column once and returns its path.
+const std::string& benchmark_table_file() {
+  static const auto file_name = [] {
+    const auto path = (std::filesystem::temp_directory_path() / "opossum_load_table_benchmark.tbl").string();
+    auto file = std::ofstream{path};
+    file << "a|b|c\nint|float|string\n";
+    const auto values = make_benchmark_values<int32_t>(ROW_COUNT, ROW_COUNT);
+    for (const auto value : values) {
+      file << value << '|' << value / 4.0f << '|' << make_benchmark_value<std::string>(value) << '\n';
+    }
+    return path;
+  }();
+  return file_name;
+}
+
+}  // namespace
+
+// Loads the table, dictionary-encoding full chunks if state.range(0) is set.
+void BM_LoadTable(benchmark::State& state) {
+  const auto& file_name = benchmark_table_file();
+  for (auto _ : state) {
+    const auto table = load_table(file_name, CHUNK_SIZE, state.range(0));
+    benchmark::DoNotOptimize(table->row_count());
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * std::filesystem::file_size(file_name)));
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * ROW_COUNT));
+}
+
+// Loads the same table, with all chunks dictionary-encoded, from the binary format, as on a warm restart.
+void BM_LoadBinaryTable(benchmark::State& state) {
+  const auto binary_file_name = benchmark_table_file() + ".bin";
+  load_table(benchmark_table_file(), CHUNK_SIZE, true)->save(binary_file_name);
+  for (auto _ : state) {
+    const auto table = Table::load(binary_file_name);
+    benchmark::DoNotOptimize(table->row_count());
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * std::filesystem::file_size(binary_file_name)));
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * ROW_COUNT));
+  std::filesystem::remove(binary_file_name);
+}
+
+BENCHMARK(BM_LoadTable)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_LoadBinaryTable)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+}  // namespace opossum
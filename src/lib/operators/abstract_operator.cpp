@@ -0,0 +1,39 @@
+#include "abstract_operator.hpp"
+
+#include <memory>
+
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+AbstractOperator::AbstractOperator(const std::shared_ptr<const AbstractOperator>& left,
+                                   const std::shared_ptr<const AbstractOperator>& right)
+    : _input_left{left}, _input_right{right} {}
+
+void AbstractOperator::execute() {
+  Assert(!_output, "Operators must not be executed twice");
+  _output = _on_execute();
+  Assert(_output, "Operator did not produce an output table");
+}
+
+std::shared_ptr<const Table> AbstractOperator::get_output() const {
+  Assert(_output, "Operator has not been executed yet");
+  return _output;
+}
+
+std::shared_ptr<const AbstractOperator> AbstractOperator::input_left() const { return _input_left; }
+
+std::shared_ptr<const AbstractOperator> AbstractOperator::input_right() const { return _input_right; }
+
+std::shared_ptr<const Table> AbstractOperator::_input_table_left() const {
+  Assert(_input_left, "Operator has no left input");
+  return _input_left->get_output();
+}
+
+std::shared_ptr<const Table> AbstractOperator::_input_table_right() const {
+  Assert(_input_right, "Operator has no right input");
+  return _input_right->get_output();
+}
+
+}  // namespace opossum
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <memory>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+// AbstractOperator is the abstract super class for all operators.
+// All operators have up to two input operators and one output table.
+// Their lifecycle has three phases:
+// 1. The operator is constructed. The input operators are not guaranteed to have been executed yet, so operators must
+// not call get_output on them in their constructor.
+// 2. execute() is called from the outside. This is where the heavy lifting is done. By now, the input operators have
+// been executed.
+// 3. The consumer (usually another operator) calls get_output(). This is cheap and only succeeds after execute().
+//
+// Operators that filter their input do not copy values. Instead, they output tables of ReferenceSegments that point
+// into the table holding the actual data.
+class AbstractOperator : private Noncopyable {
+ public:
+  explicit AbstractOperator(const std::shared_ptr<const AbstractOperator>& left = nullptr,
+                            const std::shared_ptr<const AbstractOperator>& right = nullptr);
+
+  virtual ~AbstractOperator() = default;
+
+  // we need to explicitly set the move constructor to default when
+  // we overwrite the copy constructor
+  AbstractOperator(AbstractOperator&&) = default;
+  AbstractOperator& operator=(AbstractOperator&&) = default;
+
+  // runs the operator, must only be called once
+  void execute();
+
+  // returns the result of the operator
+  std::shared_ptr<const Table> get_output() const;
+
+  // returns the input operators, can be nullptr
+  std::shared_ptr<const AbstractOperator> input_left() const;
+  std::shared_ptr<const AbstractOperator> input_right() const;
+
+ protected:
+  // abstract method to actually execute the operator
+  // execute and get_output are split into two methods to allow for easier asynchronous execution
+  virtual std::shared_ptr<const Table> _on_execute() = 0;
+
+  // return the output tables of the input operators
+  std::shared_ptr<const Table> _input_table_left() const;
+  std::shared_ptr<const Table> _input_table_right() const;
+
+  std::shared_ptr<const AbstractOperator> _input_left;
+  std::shared_ptr<const AbstractOperator> _input_right;
+
+  // is nullptr until the operator is executed
+  std::shared_ptr<const Table> _output;
+};
+
+}  // namespace opossum
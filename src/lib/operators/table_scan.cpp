@@ -0,0 +1,447 @@
+#include "table_scan.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/delta_segment.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/fsst_segment.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/zone_map.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Number of rows that are compared before their positions are written to the output.
+constexpr auto BLOCK_SIZE = ChunkOffset{1024};
+
+// Calls the functor with the comparison function object that belongs to the scan type. As the comparison is a template
+// parameter of the scan loops, they are instantiated (and vectorized) separately for every scan type.
+template <typename Functor>
+void with_comparator(const ScanType scan_type, const Functor& functor) {
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return functor(std::equal_to<>{});
+    case ScanType::OpNotEquals:
+      return functor(std::not_equal_to<>{});
+    case ScanType::OpLessThan:
+      return functor(std::less<>{});
+    case ScanType::OpLessThanEquals:
+      return functor(std::less_equal<>{});
+    case ScanType::OpGreaterThan:
+      return functor(std::greater<>{});
+    case ScanType::OpGreaterThanEquals:
+      return functor(std::greater_equal<>{});
+  }
+  Fail("Unsupported scan type");
+}
+
+// Appends the positions of all matching rows to the pos_list. compare_block(begin, length, matches) sets one flag per
+// row in [begin, begin + length).
+template <typename BlockComparator>
+void emit_matches(const ChunkID chunk_id, const ChunkOffset row_count, const BlockComparator& compare_block,
+                  PosList& pos_list) {
+  auto matches = std::array<uint8_t, BLOCK_SIZE>{};
+  for (auto begin = ChunkOffset{0}; begin < row_count; begin += BLOCK_SIZE) {
+    const auto length = std::min(BLOCK_SIZE, row_count - begin);
+    compare_block(begin, length, matches.data());
+
+    // Every position is written, but the output only advances for matches. Unlike an if per row, this does not
+    // suffer from branch mispredictions for selectivities around 50%.
+    const auto previous_size = pos_list.size();
+    pos_list.resize(previous_size + length);
+    auto* const output = pos_list.data() + previous_size;
+    auto match_count = size_t{0};
+    for (auto offset = ChunkOffset{0}; offset < length; ++offset) {
+      output[match_count] = RowID{chunk_id, begin + offset};
+      match_count += matches[offset];
+    }
+    pos_list.resize(previous_size + match_count);
+  }
+}
+
+// Appends the positions [begin, end) to the pos_list.
+void emit_range(const ChunkID chunk_id, const ChunkOffset begin, const ChunkOffset end, PosList& pos_list) {
+  const auto previous_size = pos_list.size();
+  pos_list.resize(previous_size + (end - begin));
+  auto* const output = pos_list.data() + previous_size;
+  for (auto chunk_offset = begin; chunk_offset < end; ++chunk_offset) {
+    output[chunk_offset - begin] = RowID{chunk_id, chunk_offset};
+  }
+}
+
+void emit_all(const ChunkID chunk_id, const ChunkOffset row_count, PosList& pos_list) {
+  emit_range(chunk_id, 0, row_count, pos_list);
+}
+
+template <typename T>
+void scan_value_segment(const ValueSegment<T>& segment, const ChunkID chunk_id, const ScanType scan_type,
+                        const T& search_value, PosList& pos_list) {
+  const auto* const values = segment.values().data();
+  with_comparator(scan_type, [&](const auto comparator) {
+    emit_matches(
+        chunk_id, segment.size(),
+        [&](const ChunkOffset begin, const ChunkOffset length, uint8_t* matches) {
+          for (auto offset = ChunkOffset{0}; offset < length; ++offset) {
+            matches[offset] = comparator(values[begin + offset], search_value);
+          }
+        },
+        pos_list);
+  });
+}
+
+template <typename T>
+void scan_dictionary_segment(const DictionarySegment<T>& segment, const ChunkID chunk_id, const ScanType scan_type,
+                             const T& search_value, PosList& pos_list) {
+  // The Bloom filter rules out most values that are not in the dictionary with a single cache line access, without
+  // searching the dictionary.
+  if ((scan_type == ScanType::OpEquals || scan_type == ScanType::OpNotEquals) && !segment.may_contain(search_value)) {
+    if (scan_type == ScanType::OpNotEquals) emit_all(chunk_id, segment.size(), pos_list);
+    return;
+  }
+
+  // The dictionary is sorted, so every predicate on the values becomes a predicate on the value ids. If the search
+  // value is not part of the dictionary, lower_bound and upper_bound are equal.
+  const auto lower_bound = segment.lower_bound(search_value);
+  const auto upper_bound = segment.upper_bound(search_value);
+  const auto search_value_found = lower_bound != upper_bound;
+
+  auto value_id_scan_type = ScanType::OpEquals;
+  auto bound = ValueID{};
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      if (!search_value_found) return;
+      value_id_scan_type = ScanType::OpEquals;
+      bound = lower_bound;
+      break;
+    case ScanType::OpNotEquals:
+      if (!search_value_found) {
+        emit_all(chunk_id, segment.size(), pos_list);
+        return;
+      }
+      value_id_scan_type = ScanType::OpNotEquals;
+      bound = lower_bound;
+      break;
+    case ScanType::OpLessThan:
+      value_id_scan_type = ScanType::OpLessThan;
+      bound = lower_bound;
+      break;
+    case ScanType::OpLessThanEquals:
+      value_id_scan_type = ScanType::OpLessThan;
+      bound = upper_bound;
+      break;
+    case ScanType::OpGreaterThan:
+      value_id_scan_type = ScanType::OpGreaterThanEquals;
+      bound = upper_bound;
+      break;
+    case ScanType::OpGreaterThanEquals:
+      value_id_scan_type = ScanType::OpGreaterThanEquals;
+      bound = lower_bound;
+      break;
+  }
+
+  // INVALID_VALUE_ID is greater than all value ids. Bounds at either end of the dictionary match all or no rows.
+  if (value_id_scan_type == ScanType::OpLessThan) {
+    if (bound == INVALID_VALUE_ID) {
+      emit_all(chunk_id, segment.size(), pos_list);
+      return;
+    }
+    if (bound == ValueID{0}) return;
+  } else if (value_id_scan_type == ScanType::OpGreaterThanEquals) {
+    if (bound == ValueID{0}) {
+      emit_all(chunk_id, segment.size(), pos_list);
+      return;
+    }
+    if (bound == INVALID_VALUE_ID) return;
+  }
+
+  const auto& attribute_vector = *segment.attribute_vector();
+  const auto raw_bound = ValueID::base_type{bound};
+  auto value_ids = std::array<ValueID, BLOCK_SIZE>{};
+  with_comparator(value_id_scan_type, [&](const auto comparator) {
+    emit_matches(
+        chunk_id, segment.size(),
+        [&](const ChunkOffset begin, const ChunkOffset length, uint8_t* matches) {
+          attribute_vector.decode(begin, length, value_ids.data());
+          for (auto offset = ChunkOffset{0}; offset < length; ++offset) {
+            matches[offset] = comparator(ValueID::base_type{value_ids[offset]}, raw_bound);
+          }
+        },
+        pos_list);
+  });
+}
+
+template <typename T>
+void scan_run_length_segment(const RunLengthSegment<T>& segment, const ChunkID chunk_id, const ScanType scan_type,
+                             const T& search_value, PosList& pos_list) {
+  // The predicate is evaluated once per run. The positions of matching runs are written without further comparisons.
+  const auto& values = segment.values();
+  const auto& end_positions = segment.end_positions();
+  with_comparator(scan_type, [&](const auto comparator) {
+    auto run_begin = ChunkOffset{0};
+    for (auto run_index = size_t{0}; run_index < values.size(); ++run_index) {
+      const auto run_end = end_positions[run_index];
+      if (comparator(values[run_index], search_value)) emit_range(chunk_id, run_begin, run_end, pos_list);
+      run_begin = run_end;
+    }
+  });
+}
+
+template <typename T>
+void scan_frame_of_reference_segment(const FrameOfReferenceSegment<T>& segment, const ChunkID chunk_id,
+                                     const ScanType scan_type, const T& search_value, PosList& pos_list) {
+  using Offset = typename FrameOfReferenceSegment<T>::Offset;
+  static_assert(FrameOfReferenceSegment<T>::FRAME_SIZE % BLOCK_SIZE == 0, "Blocks must not span frames");
+
+  // Every frame holds values in [minimum, minimum + max_offset]. If the search value lies in that range, the predicate
+  // is evaluated on the offsets from the minimum, so that the minimum does not have to be added to every value.
+  // Otherwise, all values of the frame compare to the search value like the minimum does.
+  auto offsets = std::array<Offset, BLOCK_SIZE>{};
+  with_comparator(scan_type, [&](const auto comparator) {
+    emit_matches(
+        chunk_id, segment.size(),
+        [&](const ChunkOffset begin, const ChunkOffset length, uint8_t* matches) {
+          const auto frame = begin / FrameOfReferenceSegment<T>::FRAME_SIZE;
+          const auto minimum = segment.minima()[frame];
+          const auto search_offset =
+              static_cast<Offset>(static_cast<Offset>(search_value) - static_cast<Offset>(minimum));
+          if (search_value < minimum || search_offset > segment.max_offset(frame)) {
+            std::fill_n(matches, length, comparator(minimum, search_value));
+            return;
+          }
+
+          segment.decode_offsets(begin, length, offsets.data());
+          for (auto offset = ChunkOffset{0}; offset < length; ++offset) {
+            matches[offset] = comparator(offsets[offset], search_offset);
+          }
+        },
+        pos_list);
+  });
+}
+
+template <typename T>
+void scan_delta_segment(const DeltaSegment<T>& segment, const ChunkID chunk_id, const ScanType scan_type,
+                        const T& search_value, PosList& pos_list) {
+  if (segment.is_sorted()) {
+    // The matches of sorted values form at most two ranges, whose bounds are found by binary searches over the first
+    // values of the blocks. Nothing else is decoded.
+    const auto size = segment.size();
+    const auto lower_bound = segment.lower_bound(search_value);
+    const auto upper_bound = segment.upper_bound(search_value);
+    switch (scan_type) {
+      case ScanType::OpEquals:
+        return emit_range(chunk_id, lower_bound, upper_bound, pos_list);
+      case ScanType::OpNotEquals:
+        emit_range(chunk_id, 0, lower_bound, pos_list);
+        return emit_range(chunk_id, upper_bound, size, pos_list);
+      case ScanType::OpLessThan:
+        return emit_range(chunk_id, 0, lower_bound, pos_list);
+      case ScanType::OpLessThanEquals:
+        return emit_range(chunk_id, 0, upper_bound, pos_list);
+      case ScanType::OpGreaterThan:
+        return emit_range(chunk_id, upper_bound, size, pos_list);
+      case ScanType::OpGreaterThanEquals:
+        return emit_range(chunk_id, lower_bound, size, pos_list);
+    }
+    Fail("Unsupported scan type");
+  }
+
+  auto values = std::array<T, BLOCK_SIZE>{};
+  with_comparator(scan_type, [&](const auto comparator) {
+    emit_matches(
+        chunk_id, segment.size(),
+        [&](const ChunkOffset begin, const ChunkOffset length, uint8_t* matches) {
+          segment.decode(begin, length, values.data());
+          for (auto offset = ChunkOffset{0}; offset < length; ++offset) {
+            matches[offset] = comparator(values[offset], search_value);
+          }
+        },
+        pos_list);
+  });
+}
+
+void scan_fsst_segment(const FsstSegment& segment, const ChunkID chunk_id, const ScanType scan_type,
+                       const std::string& search_value, PosList& pos_list) {
+  if (scan_type == ScanType::OpEquals || scan_type == ScanType::OpNotEquals) {
+    // Equal strings have equal compressed bytes, so equality is decided without decompressing any value.
+    const auto compressed_search_value = segment.compress(search_value);
+    const auto search_value_size = compressed_search_value.size();
+    const auto is_equals = scan_type == ScanType::OpEquals;
+    emit_matches(
+        chunk_id, segment.size(),
+        [&](const ChunkOffset begin, const ChunkOffset length, uint8_t* matches) {
+          for (auto offset = ChunkOffset{0}; offset < length; ++offset) {
+            const auto value = segment.compressed_value(begin + offset);
+            const auto equals = value.size() == search_value_size &&
+                                std::memcmp(value.data(), compressed_search_value.data(), search_value_size) == 0;
+            matches[offset] = equals == is_equals;
+          }
+        },
+        pos_list);
+    return;
+  }
+
+  // The codes do not preserve the order of the strings, so range predicates need the decompressed values.
+  auto value = std::string{};
+  with_comparator(scan_type, [&](const auto comparator) {
+    emit_matches(
+        chunk_id, segment.size(),
+        [&](const ChunkOffset begin, const ChunkOffset length, uint8_t* matches) {
+          for (auto offset = ChunkOffset{0}; offset < length; ++offset) {
+            segment.get(begin + offset, value);
+            matches[offset] = comparator(value, search_value);
+          }
+        },
+        pos_list);
+  });
+}
+
+template <typename T>
+void scan_reference_segment(const ReferenceSegment& segment, const ChunkID chunk_id, const ScanType scan_type,
+                            const T& search_value, PosList& pos_list) {
+  // As in emit_matches, every position is written, but the output only advances for matches.
+  const auto previous_size = pos_list.size();
+  pos_list.resize(previous_size + segment.size());
+  auto* const output = pos_list.data() + previous_size;
+  auto match_count = size_t{0};
+  with_comparator(scan_type, [&](const auto comparator) {
+    segment_iterate<T>(segment, [&](const SegmentPosition<T>& position) {
+      output[match_count] = RowID{chunk_id, position.chunk_offset()};
+      match_count += comparator(position.value(), search_value);
+    });
+  });
+  pos_list.resize(previous_size + match_count);
+}
+
+// Creates the output chunk for an input chunk of data segments. All output segments share the positions of the scan.
+std::shared_ptr<Chunk> reference_data_chunk(const std::shared_ptr<const Table>& input_table,
+                                            const std::shared_ptr<const PosList>& pos_list) {
+  auto chunk = std::make_shared<Chunk>();
+  const auto column_count = input_table->column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    chunk->add_segment(std::make_shared<ReferenceSegment>(input_table, column_id, pos_list));
+  }
+  return chunk;
+}
+
+// Creates the output chunk for an input chunk of ReferenceSegments. The matching input positions are translated into
+// positions in the referenced tables, so that the output never references another ReferenceSegment. Input segments
+// that shared a position list share the translated one as well.
+std::shared_ptr<Chunk> reference_reference_chunk(const Chunk& input_chunk, const PosList& matches) {
+  auto chunk = std::make_shared<Chunk>();
+  auto input_pos_list = std::shared_ptr<const PosList>{};
+  auto output_pos_list = std::shared_ptr<const PosList>{};
+
+  const auto column_count = input_chunk.column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto segment = std::dynamic_pointer_cast<const ReferenceSegment>(input_chunk.get_segment(column_id));
+    Assert(segment, "Chunks must not mix ReferenceSegments and data segments");
+
+    if (segment->pos_list() != input_pos_list) {
+      input_pos_list = segment->pos_list();
+      auto translated_pos_list = std::make_shared<PosList>();
+      translated_pos_list->reserve(matches.size());
+      for (const auto& match : matches) {
+        translated_pos_list->push_back((*input_pos_list)[match.chunk_offset]);
+      }
+      output_pos_list = translated_pos_list;
+    }
+
+    const auto& referenced_table = segment->referenced_table();
+    chunk->add_segment(
+        std::make_shared<ReferenceSegment>(referenced_table, segment->referenced_column_id(), output_pos_list));
+  }
+  return chunk;
+}
+
+}  // namespace
+
+TableScan::TableScan(const std::shared_ptr<const AbstractOperator>& in, const ColumnID column_id,
+                     const ScanType scan_type, const AllTypeVariant search_value)
+    : AbstractOperator{in}, _column_id{column_id}, _scan_type{scan_type}, _search_value{search_value} {}
+
+ColumnID TableScan::column_id() const { return _column_id; }
+
+ScanType TableScan::scan_type() const { return _scan_type; }
+
+const AllTypeVariant& TableScan::search_value() const { return _search_value; }
+
+std::shared_ptr<const Table> TableScan::_on_execute() {
+  const auto input_table = _input_table_left();
+  auto output_table = std::make_shared<Table>(input_table->target_chunk_size());
+  const auto column_count = input_table->column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    output_table->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id));
+  }
+
+  resolve_data_type(input_table->column_type(_column_id), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    const auto search_value = type_cast<ColumnDataType>(_search_value);
+
+    const auto chunk_count = input_table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto& chunk = input_table->get_chunk(chunk_id);
+      // The chunks of an empty table might be missing actual segments.
+      if (chunk.size() == 0) continue;
+
+      const auto segment = chunk.get_segment(_column_id);
+      auto matches = std::make_shared<PosList>();
+
+      // The zone map is loaded after the segment, so that it describes this segment or one that the segment has been
+      // compressed into, which holds the same values.
+      const auto zone_map = std::static_pointer_cast<const ZoneMap<ColumnDataType>>(chunk.get_zone_map(_column_id));
+      if (zone_map && zone_map->can_prune(_scan_type, search_value)) continue;
+      if (zone_map && zone_map->matches_all(_scan_type, search_value)) {
+        emit_all(chunk_id, segment->size(), *matches);
+        output_table->emplace_chunk(reference_data_chunk(input_table, matches));
+        continue;
+      }
+
+      resolve_segment_type<ColumnDataType>(*segment, [&](const auto& typed_segment) {
+        using SegmentType = std::decay_t<decltype(typed_segment)>;
+        if constexpr (std::is_same_v<SegmentType, ValueSegment<ColumnDataType>>) {
+          scan_value_segment(typed_segment, chunk_id, _scan_type, search_value, *matches);
+        } else if constexpr (std::is_same_v<SegmentType, DictionarySegment<ColumnDataType>>) {
+          scan_dictionary_segment(typed_segment, chunk_id, _scan_type, search_value, *matches);
+        } else if constexpr (std::is_same_v<SegmentType, RunLengthSegment<ColumnDataType>>) {
+          scan_run_length_segment(typed_segment, chunk_id, _scan_type, search_value, *matches);
+        } else if constexpr (std::is_same_v<SegmentType, FrameOfReferenceSegment<ColumnDataType>>) {
+          scan_frame_of_reference_segment(typed_segment, chunk_id, _scan_type, search_value, *matches);
+        } else if constexpr (std::is_same_v<SegmentType, DeltaSegment<ColumnDataType>>) {
+          scan_delta_segment(typed_segment, chunk_id, _scan_type, search_value, *matches);
+        } else if constexpr (std::is_same_v<SegmentType, FsstSegment>) {
+          scan_fsst_segment(typed_segment, chunk_id, _scan_type, search_value, *matches);
+        } else {
+          scan_reference_segment<ColumnDataType>(typed_segment, chunk_id, _scan_type, search_value, *matches);
+        }
+      });
+
+      if (matches->empty()) continue;
+
+      if (std::dynamic_pointer_cast<const ReferenceSegment>(segment)) {
+        output_table->emplace_chunk(reference_reference_chunk(chunk, *matches));
+      } else {
+        output_table->emplace_chunk(reference_data_chunk(input_table, matches));
+      }
+    }
+  });
+
+  return output_table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <memory>
+
+#include "abstract_operator.hpp"
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// TableScan evaluates the predicate "column <scan_type> search_value" on every chunk of its input table. It outputs a
+// table of ReferenceSegments that point to the matching rows. For every input chunk with matches, there is one output
+// chunk whose segments share a single position list. If the input consists of ReferenceSegments, the output
+// references the table they point to, so that chained scans never create references to references.
+//
+// On ValueSegments, the values are compared block-wise against the search value in a tight loop that the compiler
+// vectorizes. On DictionarySegments, the search value is translated into a ValueID range once per segment, so that
+// only the value ids in the attribute vector have to be compared - the dictionary is not accessed per row. If the
+// segment has a Bloom filter, equality predicates on values it does not contain are decided without the search. On
+// RunLengthSegments, the predicate is evaluated once per run and all positions of a matching run are emitted at once.
+// On FrameOfReferenceSegments, frames whose value range does not contain the search value are decided as a whole, and
+// in all other frames, the bit-packed offsets are compared against the offset of the search value. On sorted
+// DeltaSegments, the matching positions are found with binary searches over the skip pointers of the segment. On
+// FsstSegments, equality predicates compare the compressed bytes against the compressed search value.
+//
+// Before a chunk is scanned, the zone map of its segment (see ZoneMap) is checked. Chunks whose value range cannot
+// match are skipped, and all rows of chunks whose values all match are emitted without reading the segment.
+class TableScan : public AbstractOperator {
+ public:
+  TableScan(const std::shared_ptr<const AbstractOperator>& in, const ColumnID column_id, const ScanType scan_type,
+            const AllTypeVariant search_value);
+
+  ColumnID column_id() const;
+  ScanType scan_type() const;
+  const AllTypeVariant& search_value() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const ColumnID _column_id;
+  const ScanType _scan_type;
+  const AllTypeVariant _search_value;
+};
+
+}  // namespace opossum
@@ -0,0 +1,15 @@
+#include "table_wrapper.hpp"
+
+#include <memory>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+TableWrapper::TableWrapper(const std::shared_ptr<const Table>& table) : _table{table} {
+  Assert(_table, "TableWrapper needs a table");
+}
+
+std::shared_ptr<const Table> TableWrapper::_on_execute() { return _table; }
+
+}  // namespace opossum
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <memory>
+
+#include "abstract_operator.hpp"
+
+namespace opossum {
+
+// operator to wrap a table, so it can be used as input to other operators
+class TableWrapper : public AbstractOperator {
+ public:
+  explicit TableWrapper(const std::shared_ptr<const Table>& table);
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  // table to return
+  const std::shared_ptr<const Table> _table;
+};
+
+}  // namespace opossum
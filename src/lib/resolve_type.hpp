@@ -12,6 +12,14 @@
 #include "all_type_variant.hpp"
 #include "utils/assert.hpp"
 
+#include "storage/bit_packed_attribute_vector.hpp"
+#include "storage/delta_segment.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/fixed_size_attribute_vector.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/fsst_segment.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/run_length_segment.hpp"
 #include "storage/value_segment.hpp"
 
 namespace opossum {
@@ -78,4 +86,69 @@ void resolve_data_type(const std::string& type_string, const Functor& func) {
   });
 }
 
+/**
+ * Resolves the concrete type of a segment whose data type T is already known (e.g., from resolve_data_type) by
+ * passing a const reference to the ValueSegment<T>, DictionarySegment<T>, RunLengthSegment<T>,
+ * FrameOfReferenceSegment<T> or DeltaSegment<T> (only for int and long), FsstSegment (only for strings), or
+ * ReferenceSegment on to a generic lambda.
+ * Inside the lambda, the segment can be accessed without virtual calls and without AllTypeVariant.
+ *
+ * Example:
+ *
+ *   resolve_segment_type<T>(*segment, [&](const auto& typed_segment) {
+ *     using SegmentType = std::decay_t<decltype(typed_segment)>;
+ *     if constexpr (std::is_same_v<SegmentType, ValueSegment<T>>) { ... }
+ *   });
+ */
+template <typename T, typename Functor>
+void resolve_segment_type(const BaseSegment& segment, const Functor& func) {
+  if (const auto* value_segment = dynamic_cast<const ValueSegment<T>*>(&segment)) {
+    func(*value_segment);
+  } else if (const auto* dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+    func(*dictionary_segment);
+  } else if (const auto* run_length_segment = dynamic_cast<const RunLengthSegment<T>*>(&segment)) {
+    func(*run_length_segment);
+  } else if (const auto* reference_segment = dynamic_cast<const ReferenceSegment*>(&segment)) {
+    func(*reference_segment);
+  } else {
+    // FrameOfReferenceSegment<T> and DeltaSegment<T> can only be instantiated for the integer types, FsstSegments
+    // only hold strings.
+    if constexpr (is_frame_of_reference_encodable_v<T>) {
+      if (const auto* frame_of_reference_segment = dynamic_cast<const FrameOfReferenceSegment<T>*>(&segment)) {
+        func(*frame_of_reference_segment);
+        return;
+      }
+    }
+    if constexpr (is_delta_encodable_v<T>) {
+      if (const auto* delta_segment = dynamic_cast<const DeltaSegment<T>*>(&segment)) {
+        func(*delta_segment);
+        return;
+      }
+    }
+    if constexpr (std::is_same_v<T, std::string>) {
+      if (const auto* fsst_segment = dynamic_cast<const FsstSegment*>(&segment)) {
+        func(*fsst_segment);
+        return;
+      }
+    }
+    Fail("Unrecognized segment type");
+  }
+}
+
+// Resolves the concrete type of an attribute vector by passing a const reference to it on to a generic lambda
+template <typename Functor>
+void resolve_attribute_vector_type(const BaseAttributeVector& attribute_vector, const Functor& func) {
+  if (const auto* uint8_vector = dynamic_cast<const FixedSizeAttributeVector<uint8_t>*>(&attribute_vector)) {
+    func(*uint8_vector);
+  } else if (const auto* uint16_vector = dynamic_cast<const FixedSizeAttributeVector<uint16_t>*>(&attribute_vector)) {
+    func(*uint16_vector);
+  } else if (const auto* uint32_vector = dynamic_cast<const FixedSizeAttributeVector<uint32_t>*>(&attribute_vector)) {
+    func(*uint32_vector);
+  } else if (const auto* bit_packed_vector = dynamic_cast<const BitPackedAttributeVector*>(&attribute_vector)) {
+    func(*bit_packed_vector);
+  } else {
+    Fail("Unrecognized attribute vector type");
+  }
+}
+
 }  // namespace opossum
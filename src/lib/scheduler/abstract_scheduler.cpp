@@ -0,0 +1,15 @@
+#include "abstract_scheduler.hpp"
+
+#include <memory>
+
+#include "abstract_task.hpp"
+
+namespace opossum {
+
+void AbstractScheduler::schedule(const std::shared_ptr<AbstractTask>& task) {
+  if (task->_mark_as_scheduled(*this)) {
+    _enqueue(task);
+  }
+}
+
+}  // namespace opossum
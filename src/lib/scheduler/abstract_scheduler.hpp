@@ -0,0 +1,36 @@
+#pragma once
+
+#include <memory>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTask;
+
+// AbstractScheduler is the abstract super class for all schedulers. A scheduler receives tasks via schedule() and
+// executes each of them once all its predecessors are done.
+class AbstractScheduler : private Noncopyable {
+ public:
+  virtual ~AbstractScheduler() = default;
+
+  // prepares the scheduler, e.g., by starting worker threads
+  virtual void begin() = 0;
+
+  // waits for all scheduled tasks and releases the resources of the scheduler, e.g., its worker threads
+  virtual void finish() = 0;
+
+  // blocks until all tasks that have been scheduled so far are done
+  virtual void wait_for_all_tasks() = 0;
+
+  // schedules the task, which is enqueued right away if all its predecessors are done or otherwise once they are
+  void schedule(const std::shared_ptr<AbstractTask>& task);
+
+ protected:
+  friend class AbstractTask;
+
+  // hands a ready task to the scheduler's queues (or executes it)
+  virtual void _enqueue(const std::shared_ptr<AbstractTask>& task) = 0;
+};
+
+}  // namespace opossum
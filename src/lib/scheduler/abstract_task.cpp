@@ -0,0 +1,93 @@
+#include "abstract_task.hpp"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "abstract_scheduler.hpp"
+#include "current_scheduler.hpp"
+#include "utils/assert.hpp"
+#include "worker.hpp"
+
+namespace opossum {
+
+namespace {
+
+std::atomic<TaskID> next_task_id{0};
+
+}  // namespace
+
+AbstractTask::AbstractTask() : _id{next_task_id++} {}
+
+TaskID AbstractTask::id() const { return _id; }
+
+bool AbstractTask::is_ready() const { return _pending_predecessor_count == 0; }
+
+bool AbstractTask::is_scheduled() const { return _is_scheduled; }
+
+bool AbstractTask::is_done() const { return _is_done; }
+
+void AbstractTask::set_as_predecessor_of(const std::shared_ptr<AbstractTask>& successor) {
+  Assert(!_is_scheduled && !successor->_is_scheduled, "Dependencies must be set up before the tasks are scheduled");
+  _successors.push_back(successor);
+  ++successor->_pending_predecessor_count;
+  ++successor->_pending_blocker_count;
+}
+
+const std::vector<std::shared_ptr<AbstractTask>>& AbstractTask::successors() const { return _successors; }
+
+void AbstractTask::schedule() { CurrentScheduler::get()->schedule(shared_from_this()); }
+
+void AbstractTask::join() {
+  if (!_is_done) {
+    if (auto* const worker = Worker::get_this_thread_worker()) {
+      worker->execute_tasks_until_done(*this);
+    } else {
+      _wait_until_done();
+    }
+  }
+
+  if (_exception) std::rethrow_exception(_exception);
+}
+
+void AbstractTask::execute() {
+  DebugAssert(is_ready(), "Task must not be executed before its predecessors are done");
+  Assert(!_is_done, "Tasks must not be executed twice");
+
+  try {
+    _on_execute();
+  } catch (...) {
+    _exception = std::current_exception();
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(_done_mutex);
+    _is_done = true;
+  }
+  _done_condition_variable.notify_all();
+
+  for (const auto& successor : _successors) {
+    successor->_on_predecessor_done();
+  }
+}
+
+bool AbstractTask::_mark_as_scheduled(AbstractScheduler& scheduler) {
+  Assert(!_is_scheduled.exchange(true), "Tasks must not be scheduled twice");
+  _scheduler = &scheduler;
+  return --_pending_blocker_count == 0;
+}
+
+void AbstractTask::_on_predecessor_done() {
+  --_pending_predecessor_count;
+  if (--_pending_blocker_count == 0) {
+    _scheduler->_enqueue(shared_from_this());
+  }
+}
+
+void AbstractTask::_wait_until_done() {
+  auto lock = std::unique_lock<std::mutex>{_done_mutex};
+  _done_condition_variable.wait(lock, [&] { return _is_done.load(); });
+}
+
+}  // namespace opossum
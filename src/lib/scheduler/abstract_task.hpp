@@ -0,0 +1,82 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractScheduler;
+
+// AbstractTask is the abstract super class for everything that is executed by a scheduler, e.g., JobTask.
+//
+// Tasks can depend on other tasks: a task is only executed once all its predecessors are done. Dependencies have to
+// be set up before the tasks are scheduled. A task is handed to its scheduler's queues as soon as it is scheduled and
+// all its predecessors are done, so queues only ever contain tasks that are ready to run.
+class AbstractTask : public std::enable_shared_from_this<AbstractTask>, private Noncopyable {
+ public:
+  AbstractTask();
+  virtual ~AbstractTask() = default;
+
+  // returns a process-wide unique id, mainly for debugging
+  TaskID id() const;
+
+  // returns whether all predecessors are done
+  bool is_ready() const;
+
+  bool is_scheduled() const;
+  bool is_done() const;
+
+  // makes this task a predecessor of the successor, i.e., the successor will not run before this task is done
+  // neither task may have been scheduled yet
+  void set_as_predecessor_of(const std::shared_ptr<AbstractTask>& successor);
+
+  const std::vector<std::shared_ptr<AbstractTask>>& successors() const;
+
+  // schedules the task with the CurrentScheduler
+  void schedule();
+
+  // blocks until the task is done and rethrows the exception the task has thrown, if any
+  // on a worker thread, the worker executes other tasks in the meantime, so that waiting tasks do not block workers
+  void join();
+
+  // runs the task, called by the scheduler
+  void execute();
+
+ protected:
+  // abstract method to actually execute the task
+  virtual void _on_execute() = 0;
+
+ private:
+  friend class AbstractScheduler;
+
+  // marks the task as scheduled by the scheduler and returns whether it is ready to be enqueued
+  bool _mark_as_scheduled(AbstractScheduler& scheduler);
+
+  // enqueues the task once its last predecessor is done
+  void _on_predecessor_done();
+
+  // waits for the task without executing other tasks
+  void _wait_until_done();
+
+  const TaskID _id;
+  std::vector<std::shared_ptr<AbstractTask>> _successors;
+
+  // number of predecessors that are not done yet, plus one until the task is scheduled
+  std::atomic<uint32_t> _pending_blocker_count{1};
+  std::atomic<uint32_t> _pending_predecessor_count{0};
+  std::atomic_bool _is_scheduled{false};
+  std::atomic_bool _is_done{false};
+  AbstractScheduler* _scheduler = nullptr;
+
+  std::exception_ptr _exception;
+  std::mutex _done_mutex;
+  std::condition_variable _done_condition_variable;
+};
+
+}  // namespace opossum
@@ -0,0 +1,74 @@
+#include "current_scheduler.hpp"
+
+#include <cstdlib>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "abstract_scheduler.hpp"
+#include "abstract_task.hpp"
+#include "immediate_execution_scheduler.hpp"
+#include "node_queue_scheduler.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+std::shared_ptr<AbstractScheduler> CurrentScheduler::_instance;
+std::mutex CurrentScheduler::_instance_mutex;
+
+std::shared_ptr<AbstractScheduler> CurrentScheduler::get() {
+  std::lock_guard<std::mutex> lock(_instance_mutex);
+  if (!_instance) {
+    const auto* const scheduler_name = std::getenv("OPOSSUM_SCHEDULER");
+    if (scheduler_name && std::string{scheduler_name} == "immediate") {
+      _instance = std::make_shared<ImmediateExecutionScheduler>();
+    } else {
+      _instance = std::make_shared<NodeQueueScheduler>();
+    }
+    _instance->begin();
+  }
+  return _instance;
+}
+
+void CurrentScheduler::set(const std::shared_ptr<AbstractScheduler>& instance) {
+  Assert(instance, "CurrentScheduler needs a scheduler");
+  auto previous_instance = std::shared_ptr<AbstractScheduler>{};
+  {
+    std::lock_guard<std::mutex> lock(_instance_mutex);
+    instance->begin();
+    previous_instance = std::exchange(_instance, instance);
+  }
+  // The previous scheduler is finished without holding the lock, as its remaining tasks may still call get(), e.g., to
+  // schedule subtasks, which then run on the new scheduler.
+  if (previous_instance) previous_instance->finish();
+}
+
+void CurrentScheduler::schedule_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks) {
+  const auto scheduler = get();
+  for (const auto& task : tasks) {
+    scheduler->schedule(task);
+  }
+}
+
+void CurrentScheduler::wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks) {
+  // Wait for all tasks before rethrowing, so that no task is still running once the caller handles the exception.
+  auto exception = std::exception_ptr{};
+  for (const auto& task : tasks) {
+    try {
+      task->join();
+    } catch (...) {
+      if (!exception) exception = std::current_exception();
+    }
+  }
+  if (exception) std::rethrow_exception(exception);
+}
+
+void CurrentScheduler::schedule_and_wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks) {
+  schedule_tasks(tasks);
+  wait_for_tasks(tasks);
+}
+
+}  // namespace opossum
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractScheduler;
+class AbstractTask;
+
+// CurrentScheduler holds the process-wide scheduler that all components submit their tasks to.
+//
+// Unless a scheduler is set explicitly, a NodeQueueScheduler with one worker per core is started on first use. If the
+// environment variable OPOSSUM_SCHEDULER is set to "immediate", an ImmediateExecutionScheduler is used instead, which
+// executes all tasks single-threaded on the calling thread. This is meant for debugging.
+class CurrentScheduler {
+ public:
+  static std::shared_ptr<AbstractScheduler> get();
+
+  // starts the given scheduler and finishes the previous one, whose remaining tasks submit new tasks to the given one
+  static void set(const std::shared_ptr<AbstractScheduler>& instance);
+
+  static void schedule_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks);
+
+  // blocks until all given tasks are done and rethrows the first exception thrown by one of them, if any
+  static void wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks);
+
+  static void schedule_and_wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks);
+
+ private:
+  static std::shared_ptr<AbstractScheduler> _instance;
+  static std::mutex _instance_mutex;
+};
+
+}  // namespace opossum
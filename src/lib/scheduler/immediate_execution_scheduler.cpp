@@ -0,0 +1,17 @@
+#include "immediate_execution_scheduler.hpp"
+
+#include <memory>
+
+#include "abstract_task.hpp"
+
+namespace opossum {
+
+void ImmediateExecutionScheduler::begin() {}
+
+void ImmediateExecutionScheduler::finish() {}
+
+void ImmediateExecutionScheduler::wait_for_all_tasks() {}
+
+void ImmediateExecutionScheduler::_enqueue(const std::shared_ptr<AbstractTask>& task) { task->execute(); }
+
+}  // namespace opossum
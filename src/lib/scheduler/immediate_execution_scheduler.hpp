@@ -0,0 +1,21 @@
+#pragma once
+
+#include <memory>
+
+#include "abstract_scheduler.hpp"
+
+namespace opossum {
+
+// ImmediateExecutionScheduler executes every task on the calling thread as soon as it is ready. As nothing runs in
+// parallel, it is useful for debugging and for deterministic tests.
+class ImmediateExecutionScheduler : public AbstractScheduler {
+ public:
+  void begin() override;
+  void finish() override;
+  void wait_for_all_tasks() override;
+
+ protected:
+  void _enqueue(const std::shared_ptr<AbstractTask>& task) override;
+};
+
+}  // namespace opossum
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <functional>
+
+#include "abstract_task.hpp"
+
+namespace opossum {
+
+// JobTask runs an arbitrary function, e.g., a lambda that processes one partition of a larger job
+class JobTask : public AbstractTask {
+ public:
+  explicit JobTask(const std::function<void()>& function);
+
+ protected:
+  void _on_execute() override;
+
+  const std::function<void()> _function;
+};
+
+}  // namespace opossum
@@ -0,0 +1,132 @@
+#include "node_queue_scheduler.hpp"
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "abstract_task.hpp"
+#include "task_queue.hpp"
+#include "utils/assert.hpp"
+#include "worker.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Idle workers wake up regularly even if they are not notified, e.g., to steal tasks that were enqueued while they
+// were falling asleep.
+constexpr auto IDLE_TIMEOUT = std::chrono::milliseconds{10};
+
+}  // namespace
+
+NodeQueueScheduler::NodeQueueScheduler(const size_t worker_count) : _worker_count{std::max(worker_count, size_t{1})} {}
+
+NodeQueueScheduler::~NodeQueueScheduler() { finish(); }
+
+void NodeQueueScheduler::begin() {
+  Assert(!_active, "Scheduler has already been started");
+  _shutdown = false;
+
+  const auto cpu_ids = _available_cpu_ids();
+  for (auto worker_id = WorkerID{0}; worker_id < _worker_count; ++worker_id) {
+    _queues.push_back(std::make_shared<TaskQueue>());
+    _workers.push_back(std::make_shared<Worker>(*this, worker_id, cpu_ids[worker_id % cpu_ids.size()]));
+  }
+  for (const auto& worker : _workers) {
+    worker->start();
+  }
+  _active = true;
+}
+
+void NodeQueueScheduler::finish() {
+  if (!_active) return;
+  wait_for_all_tasks();
+
+  {
+    std::lock_guard<std::mutex> lock(_idle_mutex);
+    _shutdown = true;
+  }
+  _idle_condition_variable.notify_all();
+
+  for (const auto& worker : _workers) {
+    worker->join();
+  }
+  _workers.clear();
+  _queues.clear();
+  _active = false;
+}
+
+void NodeQueueScheduler::wait_for_all_tasks() {
+  auto lock = std::unique_lock<std::mutex>{_all_tasks_done_mutex};
+  _all_tasks_done_condition_variable.wait(lock, [&] { return _unfinished_task_count == 0; });
+}
+
+size_t NodeQueueScheduler::worker_count() const { return _worker_count; }
+
+const std::vector<std::shared_ptr<Worker>>& NodeQueueScheduler::workers() const { return _workers; }
+
+const std::vector<std::shared_ptr<TaskQueue>>& NodeQueueScheduler::queues() const { return _queues; }
+
+void NodeQueueScheduler::_enqueue(const std::shared_ptr<AbstractTask>& task) {
+  Assert(_active, "Scheduler has not been started");
+  ++_unfinished_task_count;
+
+  // Tasks scheduled by a task go to the queue of the worker that runs it, other tasks are distributed round-robin.
+  const auto* const worker = Worker::get_this_thread_worker();
+  const auto is_own_worker = worker && worker->id() < _workers.size() && _workers[worker->id()].get() == worker;
+  const auto queue_id = is_own_worker ? worker->id() : _next_queue_id++ % _worker_count;
+  _queues[queue_id]->push(task);
+
+  {
+    std::lock_guard<std::mutex> lock(_idle_mutex);
+    ++_queued_task_count;
+  }
+  _idle_condition_variable.notify_one();
+}
+
+std::shared_ptr<AbstractTask> NodeQueueScheduler::_get_task(const WorkerID worker_id) {
+  auto task = _queues[worker_id]->pull();
+  for (auto offset = size_t{1}; !task && offset < _worker_count; ++offset) {
+    task = _queues[(worker_id + offset) % _worker_count]->steal();
+  }
+
+  if (task) --_queued_task_count;
+  return task;
+}
+
+void NodeQueueScheduler::_wait_for_tasks() {
+  auto lock = std::unique_lock<std::mutex>{_idle_mutex};
+  _idle_condition_variable.wait_for(lock, IDLE_TIMEOUT, [&] { return _shutdown || _queued_task_count > 0; });
+}
+
+void NodeQueueScheduler::_on_task_done() {
+  if (--_unfinished_task_count > 0) return;
+  // Taking the lock ensures that a waiter either sees the count of zero or is already waiting to be notified.
+  { std::lock_guard<std::mutex> lock(_all_tasks_done_mutex); }
+  _all_tasks_done_condition_variable.notify_all();
+}
+
+bool NodeQueueScheduler::_is_shutting_down() const { return _shutdown; }
+
+std::vector<CpuID> NodeQueueScheduler::_available_cpu_ids() {
+  auto cpu_ids = std::vector<CpuID>{};
+#ifdef __linux__
+  auto cpu_set = cpu_set_t{};
+  if (sched_getaffinity(0, sizeof(cpu_set_t), &cpu_set) == 0) {
+    for (auto cpu_id = CpuID{0}; cpu_id < CPU_SETSIZE; ++cpu_id) {
+      if (CPU_ISSET(cpu_id, &cpu_set)) cpu_ids.push_back(cpu_id);
+    }
+  }
+#endif
+  if (cpu_ids.empty()) cpu_ids.push_back(0);
+  return cpu_ids;
+}
+
+}  // namespace opossum
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "abstract_scheduler.hpp"
+
+namespace opossum {
+
+class TaskQueue;
+class Worker;
+
+// NodeQueueScheduler runs a fixed number of worker threads, each pinned to one of the CPUs the process may use. Every
+// worker has its own queue: tasks scheduled from a worker go to its queue, tasks scheduled from other threads are
+// distributed round-robin. Idle workers steal tasks from the other queues.
+class NodeQueueScheduler : public AbstractScheduler {
+ public:
+  explicit NodeQueueScheduler(const size_t worker_count = std::thread::hardware_concurrency());
+  ~NodeQueueScheduler() override;
+
+  void begin() override;
+  void finish() override;
+
+  // blocks until all tasks that have been scheduled so far are done
+  // must not be called from within a task, as the calling task would wait for itself
+  void wait_for_all_tasks() override;
+
+  size_t worker_count() const;
+  const std::vector<std::shared_ptr<Worker>>& workers() const;
+  const std::vector<std::shared_ptr<TaskQueue>>& queues() const;
+
+ protected:
+  friend class Worker;
+
+  void _enqueue(const std::shared_ptr<AbstractTask>& task) override;
+
+  // returns a task from the worker's queue or one stolen from another queue, or nullptr if all queues are empty
+  std::shared_ptr<AbstractTask> _get_task(const WorkerID worker_id);
+
+  // blocks an idle worker until tasks are enqueued or the scheduler shuts down
+  void _wait_for_tasks();
+
+  void _on_task_done();
+  bool _is_shutting_down() const;
+
+  // returns the ids of the CPUs that the process may run on
+  static std::vector<CpuID> _available_cpu_ids();
+
+  const size_t _worker_count;
+  std::vector<std::shared_ptr<Worker>> _workers;
+  std::vector<std::shared_ptr<TaskQueue>> _queues;
+  bool _active = false;
+
+  std::atomic<size_t> _next_queue_id{0};
+  std::atomic<size_t> _queued_task_count{0};
+  std::atomic<size_t> _unfinished_task_count{0};
+  std::atomic_bool _shutdown{false};
+
+  std::mutex _idle_mutex;
+  std::condition_variable _idle_condition_variable;
+
+  // notified when the last unfinished task is done
+  std::mutex _all_tasks_done_mutex;
+  std::condition_variable _all_tasks_done_condition_variable;
+};
+
+}  // namespace opossum
@@ -0,0 +1,18 @@
+#include "operator_task.hpp"
+
+#include <memory>
+
+#include "operators/abstract_operator.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+OperatorTask::OperatorTask(const std::shared_ptr<AbstractOperator>& op) : _operator{op} {
+  Assert(_operator, "OperatorTask needs an operator");
+}
+
+const std::shared_ptr<AbstractOperator>& OperatorTask::get_operator() const { return _operator; }
+
+void OperatorTask::_on_execute() { _operator->execute(); }
+
+}  // namespace opossum
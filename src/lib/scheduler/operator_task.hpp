@@ -0,0 +1,25 @@
+#pragma once
+
+#include <memory>
+
+#include "abstract_task.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+
+// OperatorTask executes an operator. To run a chain of operators, make the task of each input operator a predecessor
+// of the task of the consuming operator.
+class OperatorTask : public AbstractTask {
+ public:
+  explicit OperatorTask(const std::shared_ptr<AbstractOperator>& op);
+
+  const std::shared_ptr<AbstractOperator>& get_operator() const;
+
+ protected:
+  void _on_execute() override;
+
+  const std::shared_ptr<AbstractOperator> _operator;
+};
+
+}  // namespace opossum
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <deque>
+#include <memory>
+#include <mutex>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTask;
+
+// TaskQueue holds the ready tasks of one worker. The worker takes the most recently pushed task, which is likely to
+// work on data that is still in the core's caches. Other workers steal the oldest task, which is usually the largest
+// remaining piece of work.
+class TaskQueue : private Noncopyable {
+ public:
+  void push(const std::shared_ptr<AbstractTask>& task);
+
+  // returns the most recently pushed task or nullptr if the queue is empty
+  std::shared_ptr<AbstractTask> pull();
+
+  // returns the oldest task or nullptr if the queue is empty
+  std::shared_ptr<AbstractTask> steal();
+
+  size_t size() const;
+
+ protected:
+  std::deque<std::shared_ptr<AbstractTask>> _tasks;
+  mutable std::mutex _mutex;
+};
+
+}  // namespace opossum
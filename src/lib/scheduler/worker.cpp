@@ -0,0 +1,75 @@
+#include "worker.hpp"
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include <memory>
+#include <thread>
+
+#include "abstract_task.hpp"
+#include "node_queue_scheduler.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+thread_local Worker* this_thread_worker = nullptr;
+
+}  // namespace
+
+Worker* Worker::get_this_thread_worker() { return this_thread_worker; }
+
+Worker::Worker(NodeQueueScheduler& scheduler, const WorkerID id, const CpuID cpu_id)
+    : _scheduler{scheduler}, _id{id}, _cpu_id{cpu_id} {}
+
+WorkerID Worker::id() const { return _id; }
+
+CpuID Worker::cpu_id() const { return _cpu_id; }
+
+void Worker::start() {
+  Assert(!_thread.joinable(), "Worker has already been started");
+  _thread = std::thread(&Worker::_work_loop, this);
+  _pin_to_cpu();
+}
+
+void Worker::join() {
+  if (_thread.joinable()) _thread.join();
+}
+
+void Worker::execute_tasks_until_done(const AbstractTask& task) {
+  while (!task.is_done()) {
+    if (!_execute_next_task()) std::this_thread::yield();
+  }
+}
+
+void Worker::_work_loop() {
+  this_thread_worker = this;
+  while (!_scheduler._is_shutting_down()) {
+    if (!_execute_next_task()) _scheduler._wait_for_tasks();
+  }
+  this_thread_worker = nullptr;
+}
+
+bool Worker::_execute_next_task() {
+  const auto task = _scheduler._get_task(_id);
+  if (!task) return false;
+
+  task->execute();
+  _scheduler._on_task_done();
+  return true;
+}
+
+void Worker::_pin_to_cpu() {
+#ifdef __linux__
+  auto cpu_set = cpu_set_t{};
+  CPU_ZERO(&cpu_set);
+  CPU_SET(_cpu_id, &cpu_set);
+  const auto result = pthread_setaffinity_np(_thread.native_handle(), sizeof(cpu_set_t), &cpu_set);
+  Assert(result == 0, "Could not pin worker to CPU " + std::to_string(_cpu_id));
+#endif
+}
+
+}  // namespace opossum
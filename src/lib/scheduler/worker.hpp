@@ -0,0 +1,48 @@
+#pragma once
+
+#include <memory>
+#include <thread>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTask;
+class NodeQueueScheduler;
+
+// A Worker runs a thread of the NodeQueueScheduler. It executes the tasks of its own queue and steals tasks from the
+// queues of the other workers when its own queue is empty.
+class Worker : private Noncopyable {
+ public:
+  // returns the worker running on the calling thread or nullptr if the thread is not a worker
+  static Worker* get_this_thread_worker();
+
+  Worker(NodeQueueScheduler& scheduler, const WorkerID id, const CpuID cpu_id);
+
+  WorkerID id() const;
+  CpuID cpu_id() const;
+
+  // starts the thread and pins it to the worker's CPU
+  void start();
+
+  // waits for the thread to end, which happens once the scheduler shuts down
+  void join();
+
+  // executes queued tasks until the given task is done, so that a task waiting for other tasks does not block a worker
+  void execute_tasks_until_done(const AbstractTask& task);
+
+ protected:
+  void _work_loop();
+
+  // executes a single task from the worker's queue or stolen from another queue, returns false if there is none
+  bool _execute_next_task();
+
+  void _pin_to_cpu();
+
+  NodeQueueScheduler& _scheduler;
+  const WorkerID _id;
+  const CpuID _cpu_id;
+  std::thread _thread;
+};
+
+}  // namespace opossum
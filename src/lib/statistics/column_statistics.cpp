@@ -0,0 +1,118 @@
+#include "column_statistics.hpp"
+
+#include <algorithm>
+#include <array>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "storage/dictionary_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "type_cast.hpp"
+#include "utils/hash.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Returns the sorted, distinct values of a segment and how often each of them occurs
+template <typename T>
+std::pair<std::vector<T>, std::vector<size_t>> value_distribution(const BaseSegment& segment) {
+  auto values = std::vector<T>{};
+  auto counts = std::vector<size_t>{};
+
+  // The dictionary already holds the sorted, distinct values, only the value ids have to be counted.
+  if (const auto* dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+    const auto unique_values_count = dictionary_segment->unique_values_count();
+    values.reserve(unique_values_count);
+    for (auto value_id = ValueID{0}; value_id < unique_values_count; ++value_id) {
+      values.emplace_back(dictionary_segment->value_by_value_id(value_id));
+    }
+
+    counts.resize(unique_values_count);
+    const auto& attribute_vector = *dictionary_segment->attribute_vector();
+    auto value_ids = std::array<ValueID, 1024>{};
+    for (auto begin = size_t{0}; begin < attribute_vector.size(); begin += value_ids.size()) {
+      const auto length = std::min(value_ids.size(), attribute_vector.size() - begin);
+      attribute_vector.decode(begin, length, value_ids.data());
+      for (auto index = size_t{0}; index < length; ++index) {
+        ++counts[value_ids[index]];
+      }
+    }
+    return {std::move(values), std::move(counts)};
+  }
+
+  auto all_values = std::vector<T>{};
+  all_values.reserve(segment.size());
+  segment_iterate<T>(segment, [&](const SegmentPosition<T>& position) { all_values.push_back(position.value()); });
+  std::sort(all_values.begin(), all_values.end());
+  for (auto& value : all_values) {
+    if (values.empty() || values.back() < value) {
+      values.push_back(std::move(value));
+      counts.push_back(0);
+    }
+    ++counts.back();
+  }
+  return {std::move(values), std::move(counts)};
+}
+
+}  // namespace
+
+template <typename T>
+void ColumnStatistics<T>::add_segment(const BaseSegment& segment) {
+  const auto [values, counts] = value_distribution<T>(segment);
+  auto histogram = EquiHeightHistogram<T>{values, counts};
+  auto sketch = HyperLogLog{};
+  for (const auto& value : values) {
+    sketch.add(mixed_hash(value));
+  }
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  _histograms.push_back(std::move(histogram));
+  _distinct_count_sketch.merge(sketch);
+  _row_count += segment.size();
+}
+
+template <typename T>
+double ColumnStatistics<T>::estimate_cardinality(const ScanType scan_type, const AllTypeVariant& search_value) const {
+  const auto typed_search_value = type_cast<T>(search_value);
+  std::lock_guard<std::mutex> lock(_mutex);
+  auto cardinality = 0.0;
+  for (const auto& histogram : _histograms) {
+    cardinality += histogram.estimate_cardinality(scan_type, typed_search_value);
+  }
+  return cardinality;
+}
+
+template <typename T>
+double ColumnStatistics<T>::estimate_distinct_count() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return std::min(_distinct_count_sketch.estimate(), static_cast<double>(_row_count));
+}
+
+template <typename T>
+uint64_t ColumnStatistics<T>::row_count() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _row_count;
+}
+
+template <typename T>
+std::vector<EquiHeightHistogram<T>> ColumnStatistics<T>::histograms() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _histograms;
+}
+
+template <typename T>
+size_t ColumnStatistics<T>::estimate_memory_usage() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  auto memory_usage = _distinct_count_sketch.estimate_memory_usage();
+  for (const auto& histogram : _histograms) {
+    memory_usage += histogram.estimate_memory_usage();
+  }
+  return memory_usage;
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(ColumnStatistics);
+
+}  // namespace opossum
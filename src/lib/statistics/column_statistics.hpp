@@ -0,0 +1,65 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "equi_height_histogram.hpp"
+#include "hyper_log_log.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+
+// BaseColumnStatistics is the abstract super class of ColumnStatistics<T>, so that TableStatistics can hold the
+// statistics of columns of all types.
+class BaseColumnStatistics : private Noncopyable {
+ public:
+  BaseColumnStatistics() = default;
+  virtual ~BaseColumnStatistics() = default;
+
+  // adds the values of the column's segment in a new chunk
+  virtual void add_segment(const BaseSegment& segment) = 0;
+
+  // returns the estimated number of rows that satisfy "value <scan_type> search_value"
+  virtual double estimate_cardinality(const ScanType scan_type, const AllTypeVariant& search_value) const = 0;
+
+  // returns the estimated number of distinct values
+  virtual double estimate_distinct_count() const = 0;
+
+  // returns the number of rows of the added segments
+  virtual uint64_t row_count() const = 0;
+
+  virtual size_t estimate_memory_usage() const = 0;
+};
+
+// ColumnStatistics holds one EquiHeightHistogram per added segment and a HyperLogLog sketch of all their values.
+// Adding a segment only reads that segment: its histogram and sketch are built without holding the lock, then the
+// histogram is appended and the sketch is merged into the one of the column. Estimates sum up the histograms.
+template <typename T>
+class ColumnStatistics : public BaseColumnStatistics {
+ public:
+  void add_segment(const BaseSegment& segment) final;
+
+  double estimate_cardinality(const ScanType scan_type, const AllTypeVariant& search_value) const final;
+
+  double estimate_distinct_count() const final;
+
+  uint64_t row_count() const final;
+
+  // returns the histograms of the added segments
+  std::vector<EquiHeightHistogram<T>> histograms() const;
+
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  std::vector<EquiHeightHistogram<T>> _histograms;
+  HyperLogLog _distinct_count_sketch;
+  uint64_t _row_count = 0;
+  // segments may be added by concurrent compressions while estimates are read
+  mutable std::mutex _mutex;
+};
+
+}  // namespace opossum
@@ -0,0 +1,126 @@
+#include "equi_height_histogram.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+template <typename T>
+EquiHeightHistogram<T>::EquiHeightHistogram(const std::vector<T>& values, const std::vector<size_t>& counts,
+                                            const size_t max_bin_count) {
+  Assert(values.size() == counts.size(), "Every value needs a count");
+  Assert(max_bin_count > 0, "Histograms need at least one bin");
+  DebugAssert(std::adjacent_find(values.begin(), values.end(), std::greater_equal<>{}) == values.end(),
+              "Values of a histogram must be sorted and distinct");
+
+  _total_count = std::accumulate(counts.begin(), counts.end(), size_t{0});
+
+  // A bin is closed once the rows up to it reach its share of all rows, so that heights do not drift when a frequent
+  // value makes one bin higher.
+  auto cumulative_count = size_t{0};
+  for (auto index = size_t{0}; index < values.size(); ++index) {
+    if (_bin_heights.empty() || cumulative_count * max_bin_count >= _bin_heights.size() * _total_count) {
+      _bin_minima.push_back(values[index]);
+      _bin_maxima.push_back(values[index]);
+      _bin_heights.push_back(0);
+      _bin_distinct_counts.push_back(0);
+    }
+    _bin_maxima.back() = values[index];
+    _bin_heights.back() += counts[index];
+    ++_bin_distinct_counts.back();
+    cumulative_count += counts[index];
+  }
+}
+
+template <typename T>
+double EquiHeightHistogram<T>::estimate_cardinality(const ScanType scan_type, const T& search_value) const {
+  const auto total_count = static_cast<double>(_total_count);
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return _estimate_equals(search_value);
+    case ScanType::OpNotEquals:
+      return total_count - _estimate_equals(search_value);
+    case ScanType::OpLessThan:
+      return _estimate_less_than(search_value);
+    case ScanType::OpLessThanEquals:
+      return _estimate_less_than(search_value) + _estimate_equals(search_value);
+    case ScanType::OpGreaterThan:
+      return total_count - _estimate_less_than(search_value) - _estimate_equals(search_value);
+    case ScanType::OpGreaterThanEquals:
+      return total_count - _estimate_less_than(search_value);
+  }
+  Fail("Unsupported scan type");
+}
+
+template <typename T>
+double EquiHeightHistogram<T>::_estimate_equals(const T& search_value) const {
+  const auto bin = static_cast<size_t>(std::lower_bound(_bin_maxima.begin(), _bin_maxima.end(), search_value) -
+                                       _bin_maxima.begin());
+  if (bin == _bin_maxima.size() || search_value < _bin_minima[bin]) return 0.0;
+  return static_cast<double>(_bin_heights[bin]) / static_cast<double>(_bin_distinct_counts[bin]);
+}
+
+template <typename T>
+double EquiHeightHistogram<T>::_estimate_less_than(const T& search_value) const {
+  // All bins before the first one that reaches the search value match completely.
+  const auto bin = static_cast<size_t>(std::lower_bound(_bin_maxima.begin(), _bin_maxima.end(), search_value) -
+                                       _bin_maxima.begin());
+  const auto lower_bins_height = std::accumulate(_bin_heights.begin(), _bin_heights.begin() + bin, size_t{0});
+  if (bin == _bin_maxima.size() || !(_bin_minima[bin] < search_value)) return static_cast<double>(lower_bins_height);
+
+  // The search value lies behind the smallest and up to the largest value of the bin, so the bin matches partly.
+  auto share = 0.5;
+  if constexpr (!std::is_same_v<T, std::string>) {
+    const auto minimum = static_cast<double>(_bin_minima[bin]);
+    share = (static_cast<double>(search_value) - minimum) / (static_cast<double>(_bin_maxima[bin]) - minimum);
+    // The search value itself is counted as equal, not as smaller.
+    share = std::min(share, 1.0 - 1.0 / static_cast<double>(_bin_distinct_counts[bin]));
+  }
+  return static_cast<double>(lower_bins_height) + share * static_cast<double>(_bin_heights[bin]);
+}
+
+template <typename T>
+size_t EquiHeightHistogram<T>::bin_count() const {
+  return _bin_heights.size();
+}
+
+template <typename T>
+const T& EquiHeightHistogram<T>::bin_minimum(const size_t bin) const {
+  return _bin_minima.at(bin);
+}
+
+template <typename T>
+const T& EquiHeightHistogram<T>::bin_maximum(const size_t bin) const {
+  return _bin_maxima.at(bin);
+}
+
+template <typename T>
+size_t EquiHeightHistogram<T>::bin_height(const size_t bin) const {
+  return _bin_heights.at(bin);
+}
+
+template <typename T>
+size_t EquiHeightHistogram<T>::bin_distinct_count(const size_t bin) const {
+  return _bin_distinct_counts.at(bin);
+}
+
+template <typename T>
+size_t EquiHeightHistogram<T>::total_count() const {
+  return _total_count;
+}
+
+template <typename T>
+size_t EquiHeightHistogram<T>::estimate_memory_usage() const {
+  return bin_count() * (2 * sizeof(T) + 2 * sizeof(size_t));
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(EquiHeightHistogram);
+
+}  // namespace opossum
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// EquiHeightHistogram summarizes the values of a segment in bins that hold about the same number of rows. Every bin
+// stores its smallest and largest value, its number of rows (height), and its number of distinct values. A value never
+// spans two bins, so bins of frequent values may be higher than the others.
+//
+// Within a bin, the distinct values are assumed to occur equally often. For range predicates on numbers, they are
+// also assumed to be spread evenly between the smallest and the largest value of the bin. For strings, half of the
+// bin is assumed to match.
+template <typename T>
+class EquiHeightHistogram {
+ public:
+  static constexpr auto DEFAULT_BIN_COUNT = size_t{32};
+
+  // creates a histogram of sorted, distinct values that occur counts[i] times each
+  EquiHeightHistogram(const std::vector<T>& values, const std::vector<size_t>& counts,
+                      const size_t max_bin_count = DEFAULT_BIN_COUNT);
+
+  // returns the estimated number of rows that satisfy "value <scan_type> search_value"
+  double estimate_cardinality(const ScanType scan_type, const T& search_value) const;
+
+  size_t bin_count() const;
+  const T& bin_minimum(const size_t bin) const;
+  const T& bin_maximum(const size_t bin) const;
+  size_t bin_height(const size_t bin) const;
+  size_t bin_distinct_count(const size_t bin) const;
+
+  // returns the number of rows
+  size_t total_count() const;
+
+  size_t estimate_memory_usage() const;
+
+ protected:
+  double _estimate_equals(const T& search_value) const;
+  double _estimate_less_than(const T& search_value) const;
+
+  std::vector<T> _bin_minima;
+  std::vector<T> _bin_maxima;
+  std::vector<size_t> _bin_heights;
+  std::vector<size_t> _bin_distinct_counts;
+  size_t _total_count = 0;
+};
+
+}  // namespace opossum
@@ -0,0 +1,49 @@
+#include "hyper_log_log.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <vector>
+
+namespace opossum {
+
+HyperLogLog::HyperLogLog() : _registers(REGISTER_COUNT) {}
+
+void HyperLogLog::add(const uint64_t hash) {
+  const auto index = hash >> (64 - PRECISION);
+  // The remaining bits are shifted to the top. The lowest bit is set, so that the rank is at most 64 - PRECISION + 1.
+  const auto remaining_bits = (hash << PRECISION) | (uint64_t{1} << (PRECISION - 1));
+  const auto rank = static_cast<uint8_t>(std::countl_zero(remaining_bits) + 1);
+  _registers[index] = std::max(_registers[index], rank);
+}
+
+void HyperLogLog::merge(const HyperLogLog& other) {
+  for (auto index = size_t{0}; index < REGISTER_COUNT; ++index) {
+    _registers[index] = std::max(_registers[index], other._registers[index]);
+  }
+}
+
+double HyperLogLog::estimate() const {
+  auto inverse_sum = 0.0;
+  auto zero_count = size_t{0};
+  for (const auto rank : _registers) {
+    inverse_sum += std::ldexp(1.0, -rank);
+    zero_count += rank == 0;
+  }
+
+  const auto register_count = static_cast<double>(REGISTER_COUNT);
+  const auto alpha = 0.7213 / (1.0 + 1.079 / register_count);
+  const auto estimate = alpha * register_count * register_count / inverse_sum;
+
+  // For few values, many registers are still empty, and counting them is more accurate (linear counting).
+  if (estimate <= 2.5 * register_count && zero_count > 0) {
+    return register_count * std::log(register_count / static_cast<double>(zero_count));
+  }
+  return estimate;
+}
+
+size_t HyperLogLog::estimate_memory_usage() const {
+  return _registers.size() * sizeof(uint8_t);
+}
+
+}  // namespace opossum
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace opossum {
+
+// HyperLogLog estimates the number of distinct values of a multiset from their hashes (Flajolet et al., 2007). Each
+// hash selects one of REGISTER_COUNT registers by its first PRECISION bits and keeps the maximum number of leading
+// zeros of its remaining bits in it. The standard error of the estimate is about 1.04 / sqrt(REGISTER_COUNT), i.e.,
+// 1.6%.
+//
+// Sketches of disjoint or overlapping parts of a column, e.g., of its chunks, are merged by taking the maximum of each
+// register, which yields the sketch of all their values without looking at the values again.
+class HyperLogLog {
+ public:
+  static constexpr auto PRECISION = 12;
+  static constexpr auto REGISTER_COUNT = size_t{1} << PRECISION;
+
+  HyperLogLog();
+
+  // adds the value of a hash as returned by mixed_hash (see utils/hash.hpp)
+  void add(const uint64_t hash);
+
+  // adds all values of the other sketch
+  void merge(const HyperLogLog& other);
+
+  // returns the estimated number of distinct values that have been added
+  double estimate() const;
+
+  // returns the memory used by the registers
+  size_t estimate_memory_usage() const;
+
+ protected:
+  std::vector<uint8_t> _registers;
+};
+
+}  // namespace opossum
@@ -0,0 +1,66 @@
+#include "table_statistics.hpp"
+
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+void TableStatistics::add_column(const std::string& type) {
+  Assert(chunk_count() == 0, "Columns can only be added to statistics without chunks");
+  resolve_data_type(type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    _column_statistics.push_back(std::make_unique<ColumnStatistics<ColumnDataType>>());
+  });
+}
+
+void TableStatistics::add_chunk(const Chunk& chunk) {
+  Assert(chunk.column_count() == _column_statistics.size(), "Chunk does not match the columns of the statistics");
+  {
+    std::lock_guard<std::mutex> lock(_added_chunks_mutex);
+    if (!_added_chunks.insert(&chunk).second) return;
+  }
+
+  for (auto column_id = ColumnID{0}; column_id < _column_statistics.size(); ++column_id) {
+    _column_statistics[column_id]->add_segment(*chunk.get_segment(column_id));
+  }
+}
+
+uint64_t TableStatistics::row_count() const {
+  return _column_statistics.empty() ? 0 : _column_statistics.front()->row_count();
+}
+
+size_t TableStatistics::chunk_count() const {
+  std::lock_guard<std::mutex> lock(_added_chunks_mutex);
+  return _added_chunks.size();
+}
+
+double TableStatistics::estimate_selectivity(const ColumnID column_id, const ScanType scan_type,
+                                             const AllTypeVariant& search_value) const {
+  const auto& column_statistics = this->column_statistics(column_id);
+  const auto row_count = column_statistics.row_count();
+  if (row_count == 0) return 1.0;
+  return column_statistics.estimate_cardinality(scan_type, search_value) / static_cast<double>(row_count);
+}
+
+double TableStatistics::estimate_distinct_count(const ColumnID column_id) const {
+  return column_statistics(column_id).estimate_distinct_count();
+}
+
+const BaseColumnStatistics& TableStatistics::column_statistics(const ColumnID column_id) const {
+  return *_column_statistics.at(column_id);
+}
+
+size_t TableStatistics::estimate_memory_usage() const {
+  auto memory_usage = size_t{0};
+  for (const auto& column_statistics : _column_statistics) {
+    memory_usage += column_statistics->estimate_memory_usage();
+  }
+  return memory_usage;
+}
+
+}  // namespace opossum
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "column_statistics.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+
+// TableStatistics estimate the selectivity of predicates and the number of distinct values per column, e.g., to order
+// filters or to size joins. They cover the full chunks of a table and are updated incrementally: whenever a chunk is
+// compressed or loaded, the statistics of its segments are added (see ColumnStatistics), without reading any other
+// chunk again.
+class TableStatistics : private Noncopyable {
+ public:
+  // adds a column of the given type, which has to happen before any chunk is added
+  void add_column(const std::string& type);
+
+  // adds the segments of a chunk to the statistics of their columns
+  // every chunk is only added once, so a chunk that is compressed concurrently, e.g., in the background and by
+  // compress_chunk, is not counted twice
+  void add_chunk(const Chunk& chunk);
+
+  // returns the number of rows covered by the statistics
+  uint64_t row_count() const;
+
+  // returns the number of chunks covered by the statistics
+  size_t chunk_count() const;
+
+  // returns the estimated share of the covered rows that satisfy "column <scan_type> search_value"
+  // without covered rows, all rows are assumed to match
+  double estimate_selectivity(const ColumnID column_id, const ScanType scan_type,
+                              const AllTypeVariant& search_value) const;
+
+  // returns the estimated number of distinct values in the covered rows of a column
+  double estimate_distinct_count(const ColumnID column_id) const;
+
+  const BaseColumnStatistics& column_statistics(const ColumnID column_id) const;
+
+  size_t estimate_memory_usage() const;
+
+ protected:
+  std::vector<std::unique_ptr<BaseColumnStatistics>> _column_statistics;
+  std::unordered_set<const Chunk*> _added_chunks;
+  mutable std::mutex _added_chunks_mutex;
+};
+
+}  // namespace opossum
@@ -5,7 +5,7 @@
 namespace opossum {
 
 // BaseAttributeVector is the abstract super class for all attribute vectors,
-// e.g., FixedSizeAttributeVector
+// e.g., FixedSizeAttributeVector or BitPackedAttributeVector
 class BaseAttributeVector : private Noncopyable {
  public:
   BaseAttributeVector() = default;
@@ -19,13 +19,24 @@ class BaseAttributeVector : private Noncopyable {
   // returns the value id at a given position
   virtual ValueID get(const size_t i) const = 0;
 
+  // writes the value ids at the positions [begin, begin + length) to output
+  // this is the preferred method to read many values, as implementations can decode them block-wise
+  virtual void decode(const size_t begin, const size_t length, ValueID* output) const = 0;
+
   // sets the value id at a given position
   virtual void set(const size_t i, const ValueID value_id) = 0;
 
   // returns the number of values
   virtual size_t size() const = 0;
 
-  // returns the width of biggest value id in bytes
+  // returns the number of bits used to store a single value id
   virtual AttributeVectorWidth width() const = 0;
+
+  // returns the calculated memory usage
+  virtual size_t estimate_memory_usage() const = 0;
+
+  // returns the memory actually allocated for the vector, including the vector object and unused capacity (see
+  // BaseSegment::memory_usage)
+  virtual size_t memory_usage() const = 0;
 };
 }  // namespace opossum
@@ -29,7 +29,12 @@ class BaseSegment : private Noncopyable {
   // returns the number of values
   virtual ChunkOffset size() const = 0;
 
-  // returns the calculated memory usage
+  // returns the calculated memory usage of the stored data, e.g., to compare encodings
   virtual size_t estimate_memory_usage() const = 0;
+
+  // returns the memory actually allocated for the segment: the segment object, the full capacity of its containers,
+  // heap-allocated strings, and the objects it owns, including their shared pointer control blocks
+  // memory of a memory-mapped file that the segment reads from is not included
+  virtual size_t memory_usage() const = 0;
 };
 }  // namespace opossum
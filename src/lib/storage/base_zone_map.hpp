@@ -0,0 +1,20 @@
+#pragma once
+
+#include "types.hpp"
+
+namespace opossum {
+
+// BaseZoneMap is the abstract super class of ZoneMap<T>, so that chunks can hold the zone maps of all their columns
+class BaseZoneMap : private Noncopyable {
+ public:
+  BaseZoneMap() = default;
+  virtual ~BaseZoneMap() = default;
+
+  // returns the estimated memory usage
+  virtual size_t estimate_memory_usage() const = 0;
+
+  // returns the memory actually allocated for the zone map, including heap-allocated strings
+  virtual size_t memory_usage() const = 0;
+};
+
+}  // namespace opossum
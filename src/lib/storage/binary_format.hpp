@@ -0,0 +1,51 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace opossum {
+
+// Layout of the files written by BinaryWriter and read by BinaryParser. Segments are stored column by column in their
+// encoded form. Integers are stored in the byte order of the writing machine. Arrays are aligned to
+// BINARY_FORMAT_ALIGNMENT bytes, so that they can be read in place from a memory-mapped file.
+//
+// Dictionaries have to be sorted and distinct, and all ValueIDs have to be smaller than the size of their dictionary.
+// The parser checks both once per segment, also for segments that are used in place, so that reading them later does
+// not need any bounds checks.
+//
+//   file:             magic, version (uint32_t), target chunk size (uint32_t), column count (uint16_t),
+//                     column count x (name: string, type: string), chunk count (uint32_t), chunk count x chunk
+//   chunk:            column count x segment, all of the same size, which is at most the target chunk size
+//   segment:          BinarySegmentType (uint8_t), followed by
+//                     - Value: values
+//                     - Dictionary: dictionary values, or for strings: value count (uint32_t), array of uint64_t
+//                       block offsets, array of char front-coded blocks (see FrontCodedDictionary), symbol table,
+//                       followed by BinaryAttributeVectorType (uint8_t), followed by
+//                       - FixedSize*: array of uint8_t, uint16_t, or uint32_t
+//                       - BitPacked: width (uint8_t), size (uint64_t), array of uint64_t
+//                       followed by the Bloom filter: hash count (uint8_t, zero if there is none), array of uint64_t
+//                       words of the blocks (see BloomFilter) for the values hashed with mixed_hash (see
+//                       utils/hash.hpp)
+//                     - RunLength: values of the runs, array of uint32_t end positions
+//                     - FrameOfReference: size (uint32_t), array of T minima, array of uint8_t widths, array of
+//                       uint64_t words, only for int and long columns
+//                     - Delta: size (uint32_t), array of T first values of the blocks, array of uint64_t byte offsets
+//                       of the blocks, array of uint8_t varints, only for int and long columns
+//                     - Fsst: symbol table, array of uint8_t compressed values, array of uint32_t offsets of the
+//                       values, only for string columns
+//   symbol table:     array of uint64_t symbols, array of uint8_t symbol lengths (see FsstSymbolTable), empty if the
+//                     values are not compressed
+//   values:           array of T, or for strings: array of uint32_t lengths, array of char
+//   array:            element count (uint64_t), padding up to the alignment, elements
+//   string:           length (uint32_t), characters
+
+constexpr auto BINARY_FORMAT_MAGIC = std::array<char, 8>{'O', 'P', 'O', 'S', 'S', 'U', 'M', 'T'};
+constexpr auto BINARY_FORMAT_VERSION = uint32_t{5};
+constexpr auto BINARY_FORMAT_ALIGNMENT = size_t{8};
+
+enum class BinarySegmentType : uint8_t { Value, Dictionary, RunLength, FrameOfReference, Delta, Fsst };
+
+enum class BinaryAttributeVectorType : uint8_t { FixedSize8, FixedSize16, FixedSize32, BitPacked };
+
+}  // namespace opossum
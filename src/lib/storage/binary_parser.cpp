@@ -0,0 +1,264 @@
+#include "binary_parser.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <memory>
+#include <numeric>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "binary_format.hpp"
+#include "resolve_type.hpp"
+#include "storage/table.hpp"
+#include "storage/zone_map.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+std::shared_ptr<Table> BinaryParser::parse(const std::string& file_name, const bool memory_map) {
+  auto parser = BinaryParser{file_name, memory_map};
+  const auto magic = parser._read<std::decay_t<decltype(BINARY_FORMAT_MAGIC)>>();
+  Assert(magic == BINARY_FORMAT_MAGIC, file_name + " is not a binary table file");
+  const auto version = parser._read<uint32_t>();
+  Assert(version == BINARY_FORMAT_VERSION, file_name + " has version " + std::to_string(version) +
+                                               ", but only version " + std::to_string(BINARY_FORMAT_VERSION) +
+                                               " is supported");
+
+  auto table = std::make_shared<Table>(parser._read<ChunkOffset>());
+  const auto column_count = parser._read<ColumnCount::base_type>();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto name = parser._read_string();
+    table->add_column(name, parser._read_string());
+  }
+
+  const auto chunk_count = parser._read<ChunkID::base_type>();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    table->emplace_chunk(parser._read_chunk(*table));
+  }
+  Assert(parser._position == parser._file->size(), file_name + " has trailing data");
+  return table;
+}
+
+BinaryParser::BinaryParser(const std::string& file_name, const bool memory_map)
+    : _file_name{file_name}, _memory_map{memory_map}, _file{std::make_shared<const MemoryMappedFile>(file_name)} {}
+
+std::shared_ptr<Chunk> BinaryParser::_read_chunk(const Table& table) {
+  const auto chunk = std::make_shared<Chunk>();
+  for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+    resolve_data_type(table.column_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      const auto segment = _read_segment<ColumnDataType>();
+      // Rows are accessed by their offset in every segment, so all segments of a chunk must have the same size.
+      Assert(column_id == 0 || segment->size() == chunk->size(),
+             _file_name + " has a chunk whose segments differ in size");
+      Assert(segment->size() <= table.target_chunk_size(),
+             _file_name + " has a chunk larger than the target chunk size");
+      chunk->add_segment(segment);
+      // Like compressed chunks, loaded ones get zone maps for their encoded segments.
+      if (segment->size() > 0 && !std::dynamic_pointer_cast<ValueSegment<ColumnDataType>>(segment)) {
+        chunk->set_zone_map(column_id, ZoneMap<ColumnDataType>::from_segment(*segment));
+      }
+    });
+  }
+  return chunk;
+}
+
+template <typename T>
+std::shared_ptr<BaseSegment> BinaryParser::_read_segment() {
+  switch (_read<BinarySegmentType>()) {
+    case BinarySegmentType::Value:
+      return std::make_shared<ValueSegment<T>>(_read_values<T, pmr_vector<T>>());
+    case BinarySegmentType::Dictionary: {
+      if constexpr (std::is_same_v<T, std::string>) {
+        const auto size = _read<ValueID::base_type>();
+        auto block_offsets = _read_array<uint64_t, pmr_vector<uint64_t>>();
+        auto bytes = _read_array<char, pmr_vector<char>>();
+        auto dictionary = FrontCodedDictionary{std::move(bytes), std::move(block_offsets), size, _read_symbol_table()};
+        auto attribute_vector = _read_attribute_vector();
+        _validate_attribute_vector(*attribute_vector, dictionary.size());
+        return std::make_shared<DictionarySegment<T>>(std::move(dictionary), nullptr, std::move(attribute_vector),
+                                                      _read_bloom_filter());
+      } else {
+        if (_memory_map) {
+          const auto [dictionary_data, dictionary_size] = _read_array_data<T>();
+          const auto dictionary = std::span<const T>{dictionary_data, dictionary_size};
+          _validate_dictionary(dictionary);
+          auto attribute_vector = _read_attribute_vector();
+          _validate_attribute_vector(*attribute_vector, dictionary.size());
+          return std::make_shared<DictionarySegment<T>>(dictionary, _file, std::move(attribute_vector),
+                                                        _read_bloom_filter());
+        }
+        auto dictionary = _read_values<T, pmr_vector<T>>();
+        _validate_dictionary(std::span<const T>{dictionary});
+        auto attribute_vector = _read_attribute_vector();
+        _validate_attribute_vector(*attribute_vector, dictionary.size());
+        return std::make_shared<DictionarySegment<T>>(std::move(dictionary), std::move(attribute_vector),
+                                                      _read_bloom_filter());
+      }
+    }
+    case BinarySegmentType::RunLength: {
+      auto values = _read_values<T>();
+      return std::make_shared<RunLengthSegment<T>>(std::move(values), _read_array<ChunkOffset>());
+    }
+    case BinarySegmentType::FrameOfReference: {
+      if constexpr (is_frame_of_reference_encodable_v<T>) {
+        const auto size = _read<ChunkOffset>();
+        auto minima = _read_array<T>();
+        auto widths = _read_array<AttributeVectorWidth>();
+        return std::make_shared<FrameOfReferenceSegment<T>>(std::move(minima), std::move(widths),
+                                                            _read_array<uint64_t>(), size);
+      }
+      break;
+    }
+    case BinarySegmentType::Delta: {
+      if constexpr (is_delta_encodable_v<T>) {
+        const auto size = _read<ChunkOffset>();
+        auto block_first_values = _read_array<T>();
+        auto block_byte_offsets = _read_array<uint64_t>();
+        return std::make_shared<DeltaSegment<T>>(std::move(block_first_values), std::move(block_byte_offsets),
+                                                 _read_array<uint8_t>(), size);
+      }
+      break;
+    }
+    case BinarySegmentType::Fsst: {
+      if constexpr (std::is_same_v<T, std::string>) {
+        auto symbol_table = _read_symbol_table();
+        auto bytes = _read_array<uint8_t>();
+        return std::make_shared<FsstSegment>(std::move(symbol_table), std::move(bytes), _read_array<uint32_t>());
+      }
+      break;
+    }
+  }
+  Fail(_file_name + " contains an unknown segment type");
+}
+
+std::shared_ptr<BaseAttributeVector> BinaryParser::_read_attribute_vector() {
+  switch (_read<BinaryAttributeVectorType>()) {
+    case BinaryAttributeVectorType::FixedSize8:
+      return _read_fixed_size_attribute_vector<uint8_t>();
+    case BinaryAttributeVectorType::FixedSize16:
+      return _read_fixed_size_attribute_vector<uint16_t>();
+    case BinaryAttributeVectorType::FixedSize32:
+      return _read_fixed_size_attribute_vector<uint32_t>();
+    case BinaryAttributeVectorType::BitPacked: {
+      const auto width = _read<AttributeVectorWidth>();
+      const auto size = _read<uint64_t>();
+      if (_memory_map) {
+        const auto [words, word_count] = _read_array_data<uint64_t>();
+        return std::make_shared<BitPackedAttributeVector>(std::span<const uint64_t>{words, word_count}, size, width,
+                                                          _file);
+      }
+      return std::make_shared<BitPackedAttributeVector>(_read_array<uint64_t, pmr_vector<uint64_t>>(), size, width);
+    }
+  }
+  Fail(_file_name + " contains an unknown attribute vector type");
+}
+
+template <typename T>
+std::shared_ptr<BaseAttributeVector> BinaryParser::_read_fixed_size_attribute_vector() {
+  if (_memory_map) {
+    const auto [values, size] = _read_array_data<T>();
+    return std::make_shared<FixedSizeAttributeVector<T>>(std::span<const T>{values, size}, _file);
+  }
+  return std::make_shared<FixedSizeAttributeVector<T>>(_read_array<T, pmr_vector<T>>());
+}
+
+FsstSymbolTable BinaryParser::_read_symbol_table() {
+  auto symbols = _read_array<uint64_t>();
+  return FsstSymbolTable{std::move(symbols), _read_array<uint8_t>()};
+}
+
+template <typename T>
+void BinaryParser::_validate_dictionary(const std::span<const T> dictionary) const {
+  const auto unsorted = std::adjacent_find(dictionary.begin(), dictionary.end(),
+                                           [](const T& previous, const T& value) { return !(previous < value); });
+  Assert(unsorted == dictionary.end(), _file_name + " contains a dictionary that is not sorted and distinct");
+}
+
+void BinaryParser::_validate_attribute_vector(const BaseAttributeVector& attribute_vector,
+                                              const size_t dictionary_size) const {
+  // Decoding block-wise reads the attribute vector once, at about the speed of a scan.
+  constexpr auto BLOCK_SIZE = size_t{1024};
+  auto value_ids = std::array<ValueID, BLOCK_SIZE>{};
+  const auto size = attribute_vector.size();
+  for (auto begin = size_t{0}; begin < size; begin += BLOCK_SIZE) {
+    const auto length = std::min(BLOCK_SIZE, size - begin);
+    attribute_vector.decode(begin, length, value_ids.data());
+    const auto max_value_id = *std::max_element(value_ids.begin(), value_ids.begin() + length);
+    Assert(max_value_id < dictionary_size, _file_name + " contains a ValueID that exceeds its dictionary");
+  }
+}
+
+std::shared_ptr<const BloomFilter> BinaryParser::_read_bloom_filter() {
+  const auto hash_count = _read<uint8_t>();
+  const auto [words, word_count] = _read_array_data<uint64_t>();
+  if (hash_count == 0) {
+    Assert(word_count == 0, "Bloom filter without hash functions");
+    return nullptr;
+  }
+  return std::make_shared<const BloomFilter>(std::span<const uint64_t>{words, word_count}, hash_count);
+}
+
+template <typename T, typename Values>
+Values BinaryParser::_read_values() {
+  if constexpr (std::is_same_v<T, std::string>) {
+    const auto lengths = _read_array<uint32_t>();
+    const auto [characters, characters_size] = _read_array_data<char>();
+    Assert(characters_size == std::accumulate(lengths.begin(), lengths.end(), uint64_t{0}),
+           _file_name + " contains inconsistent string lengths");
+
+    auto values = Values{};
+    values.reserve(lengths.size());
+    auto offset = size_t{0};
+    for (const auto length : lengths) {
+      values.emplace_back(characters + offset, length);
+      offset += length;
+    }
+    return values;
+  } else {
+    return _read_array<T, Values>();
+  }
+}
+
+template <typename T, typename Values>
+Values BinaryParser::_read_array() {
+  const auto [data, size] = _read_array_data<T>();
+  auto values = Values(size);
+  std::memcpy(values.data(), data, size * sizeof(T));
+  return values;
+}
+
+template <typename T>
+std::pair<const T*, size_t> BinaryParser::_read_array_data() {
+  static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be read as an array");
+  const auto size = _read<uint64_t>();
+  _read_bytes((BINARY_FORMAT_ALIGNMENT - _position % BINARY_FORMAT_ALIGNMENT) % BINARY_FORMAT_ALIGNMENT);
+  Assert(size <= (_file->size() - _position) / sizeof(T), _file_name + " is truncated");
+  return {reinterpret_cast<const T*>(_read_bytes(size * sizeof(T))), size};
+}
+
+template <typename T>
+T BinaryParser::_read() {
+  static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be read directly");
+  auto value = T{};
+  std::memcpy(&value, _read_bytes(sizeof(T)), sizeof(T));
+  return value;
+}
+
+std::string BinaryParser::_read_string() {
+  const auto size = _read<uint32_t>();
+  return std::string(_read_bytes(size), size);
+}
+
+const char* BinaryParser::_read_bytes(const size_t count) {
+  Assert(count <= _file->size() - _position, _file_name + " is truncated");
+  const auto* const bytes = _file->data() + _position;
+  _position += count;
+  return bytes;
+}
+
+}  // namespace opossum
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <memory>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/memory_mapped_file.hpp"
+
+namespace opossum {
+
+class BaseAttributeVector;
+class BaseSegment;
+class BloomFilter;
+class Chunk;
+class FsstSymbolTable;
+class Table;
+
+// Reads tables from the binary format described in binary_format.hpp. The file is memory-mapped and the encoded
+// segments are copied as they are, i.e., nothing is parsed from text or encoded again.
+//
+// With memory_map set, dictionaries of non-string types and attribute vectors are not even copied, but used in place
+// from the mapped file, which stays mapped as long as any of these segments lives. Multiple processes that map the
+// same file then share its pages in the page cache. Loading still reads them once to validate the dictionaries and
+// ValueIDs (see binary_format.hpp), as segments trust them and do not check bounds when reading.
+//
+// The zone maps of the encoded segments are not stored, but created while loading. For DictionarySegments, this only
+// reads the first and the last dictionary entry.
+class BinaryParser : private Noncopyable {
+ public:
+  static std::shared_ptr<Table> parse(const std::string& file_name, const bool memory_map = false);
+
+ protected:
+  BinaryParser(const std::string& file_name, const bool memory_map);
+
+  std::shared_ptr<Chunk> _read_chunk(const Table& table);
+
+  template <typename T>
+  std::shared_ptr<BaseSegment> _read_segment();
+
+  std::shared_ptr<BaseAttributeVector> _read_attribute_vector();
+
+  template <typename T>
+  std::shared_ptr<BaseAttributeVector> _read_fixed_size_attribute_vector();
+
+  FsstSymbolTable _read_symbol_table();
+
+  // checks that the values of a dictionary are sorted and distinct, which its bound searches rely on
+  template <typename T>
+  void _validate_dictionary(const std::span<const T> dictionary) const;
+
+  // checks that all ValueIDs of an attribute vector point into a dictionary of the given size
+  void _validate_attribute_vector(const BaseAttributeVector& attribute_vector, const size_t dictionary_size) const;
+
+  // returns nullptr if the segment has no Bloom filter
+  std::shared_ptr<const BloomFilter> _read_bloom_filter();
+
+  template <typename T, typename Values = std::vector<T>>
+  Values _read_values();
+
+  template <typename T, typename Values = std::vector<T>>
+  Values _read_array();
+
+  // returns the elements of an array in the file without copying them, and their number
+  template <typename T>
+  std::pair<const T*, size_t> _read_array_data();
+
+  template <typename T>
+  T _read();
+
+  std::string _read_string();
+
+  // returns a pointer to the next count bytes of the file and advances the read position
+  const char* _read_bytes(const size_t count);
+
+  const std::string _file_name;
+  const bool _memory_map;
+  const std::shared_ptr<const MemoryMappedFile> _file;
+  size_t _position = 0;
+};
+
+}  // namespace opossum
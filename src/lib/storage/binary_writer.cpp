@@ -0,0 +1,181 @@
+#include "binary_writer.hpp"
+
+#include <cstdio>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "binary_format.hpp"
+#include "resolve_type.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+void BinaryWriter::write(const Table& table, const std::string& file_name) {
+  const auto temporary_file_name = file_name + ".tmp";
+  {
+    auto writer = BinaryWriter{temporary_file_name};
+    writer._write(BINARY_FORMAT_MAGIC);
+    writer._write(BINARY_FORMAT_VERSION);
+    writer._write(table.target_chunk_size());
+    writer._write(static_cast<ColumnCount::base_type>(table.column_count()));
+    for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+      writer._write_string(table.column_name(column_id));
+      writer._write_string(table.column_type(column_id));
+    }
+
+    const auto chunk_count = table.chunk_count();
+    writer._write(static_cast<ChunkID::base_type>(chunk_count));
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      writer._write_chunk(table, table.get_chunk(chunk_id));
+    }
+
+    writer._stream.close();
+    Assert(writer._stream, "Could not write file " + temporary_file_name);
+  }
+  Assert(std::rename(temporary_file_name.c_str(), file_name.c_str()) == 0, "Could not write file " + file_name);
+}
+
+BinaryWriter::BinaryWriter(const std::string& file_name) : _stream{file_name, std::ios::binary | std::ios::trunc} {
+  Assert(_stream.is_open(), "Could not open file " + file_name);
+}
+
+void BinaryWriter::_write_chunk(const Table& table, const Chunk& chunk) {
+  for (auto column_id = ColumnID{0}; column_id < chunk.column_count(); ++column_id) {
+    resolve_data_type(table.column_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      _write_segment<ColumnDataType>(*chunk.get_segment(column_id));
+    });
+  }
+}
+
+template <typename T>
+void BinaryWriter::_write_segment(const BaseSegment& segment) {
+  resolve_segment_type<T>(segment, [&](const auto& typed_segment) {
+    using SegmentType = std::decay_t<decltype(typed_segment)>;
+    if constexpr (std::is_same_v<SegmentType, ValueSegment<T>>) {
+      _write(BinarySegmentType::Value);
+      _write_values<T>(typed_segment.values());
+    } else if constexpr (std::is_same_v<SegmentType, DictionarySegment<T>>) {
+      _write(BinarySegmentType::Dictionary);
+      if constexpr (std::is_same_v<T, std::string>) {
+        const auto& dictionary = typed_segment.dictionary();
+        _write(static_cast<ValueID::base_type>(dictionary.size()));
+        _write_array(dictionary.block_offsets().data(), dictionary.block_offsets().size());
+        _write_array(dictionary.bytes().data(), dictionary.bytes().size());
+        _write_symbol_table(dictionary.symbol_table());
+      } else {
+        _write_values<T>(typed_segment.dictionary());
+      }
+      _write_attribute_vector(*typed_segment.attribute_vector());
+      _write_bloom_filter(typed_segment.bloom_filter().get());
+    } else if constexpr (std::is_same_v<SegmentType, RunLengthSegment<T>>) {
+      _write(BinarySegmentType::RunLength);
+      _write_values<T>(typed_segment.values());
+      _write_array(typed_segment.end_positions().data(), typed_segment.end_positions().size());
+    } else if constexpr (std::is_same_v<SegmentType, FrameOfReferenceSegment<T>>) {
+      _write(BinarySegmentType::FrameOfReference);
+      _write(typed_segment.size());
+      _write_array(typed_segment.minima().data(), typed_segment.minima().size());
+      _write_array(typed_segment.widths().data(), typed_segment.widths().size());
+      _write_array(typed_segment.words().data(), typed_segment.words().size());
+    } else if constexpr (std::is_same_v<SegmentType, DeltaSegment<T>>) {
+      _write(BinarySegmentType::Delta);
+      _write(typed_segment.size());
+      _write_array(typed_segment.block_first_values().data(), typed_segment.block_first_values().size());
+      _write_array(typed_segment.block_byte_offsets().data(), typed_segment.block_byte_offsets().size());
+      _write_array(typed_segment.bytes().data(), typed_segment.bytes().size());
+    } else if constexpr (std::is_same_v<SegmentType, FsstSegment>) {
+      _write(BinarySegmentType::Fsst);
+      _write_symbol_table(typed_segment.symbol_table());
+      _write_array(typed_segment.bytes().data(), typed_segment.bytes().size());
+      _write_array(typed_segment.offsets().data(), typed_segment.offsets().size());
+    } else {
+      Fail("ReferenceSegments cannot be written, only the tables they reference");
+    }
+  });
+}
+
+void BinaryWriter::_write_attribute_vector(const BaseAttributeVector& attribute_vector) {
+  resolve_attribute_vector_type(attribute_vector, [&](const auto& typed_attribute_vector) {
+    using AttributeVectorType = std::decay_t<decltype(typed_attribute_vector)>;
+    if constexpr (std::is_same_v<AttributeVectorType, BitPackedAttributeVector>) {
+      _write(BinaryAttributeVectorType::BitPacked);
+      _write(typed_attribute_vector.width());
+      _write(uint64_t{typed_attribute_vector.size()});
+      _write_array(typed_attribute_vector.words().data(), typed_attribute_vector.words().size());
+    } else {
+      const auto& values = typed_attribute_vector.values();
+      using AttributeType = typename std::decay_t<decltype(values)>::value_type;
+      if constexpr (std::is_same_v<AttributeType, uint8_t>) {
+        _write(BinaryAttributeVectorType::FixedSize8);
+      } else if constexpr (std::is_same_v<AttributeType, uint16_t>) {
+        _write(BinaryAttributeVectorType::FixedSize16);
+      } else {
+        _write(BinaryAttributeVectorType::FixedSize32);
+      }
+      _write_array(values.data(), values.size());
+    }
+  });
+}
+
+void BinaryWriter::_write_symbol_table(const FsstSymbolTable& symbol_table) {
+  _write_array(symbol_table.symbols().data(), symbol_table.symbols().size());
+  _write_array(symbol_table.symbol_lengths().data(), symbol_table.symbol_lengths().size());
+}
+
+void BinaryWriter::_write_bloom_filter(const BloomFilter* bloom_filter) {
+  if (!bloom_filter) {
+    _write(uint8_t{0});
+    _write_array(static_cast<const uint64_t*>(nullptr), 0);
+    return;
+  }
+  _write(bloom_filter->hash_count());
+  _write_array(bloom_filter->words().data(), bloom_filter->words().size());
+}
+
+template <typename T>
+void BinaryWriter::_write_values(const std::span<const T> values) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    auto lengths = std::vector<uint32_t>{};
+    lengths.reserve(values.size());
+    auto characters = std::string{};
+    for (const auto& value : values) {
+      Assert(value.size() <= std::numeric_limits<uint32_t>::max(), "String is too long to be written");
+      lengths.push_back(static_cast<uint32_t>(value.size()));
+      characters += value;
+    }
+    _write_array(lengths.data(), lengths.size());
+    _write_array(characters.data(), characters.size());
+  } else {
+    _write_array(values.data(), values.size());
+  }
+}
+
+template <typename T>
+void BinaryWriter::_write_array(const T* data, const size_t size) {
+  static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be written as an array");
+  _write(uint64_t{size});
+  static constexpr auto padding = std::array<char, BINARY_FORMAT_ALIGNMENT>{};
+  const auto padding_size = (BINARY_FORMAT_ALIGNMENT - _position % BINARY_FORMAT_ALIGNMENT) % BINARY_FORMAT_ALIGNMENT;
+  _stream.write(padding.data(), static_cast<std::streamsize>(padding_size));
+  _stream.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(size * sizeof(T)));
+  _position += padding_size + size * sizeof(T);
+}
+
+template <typename T>
+void BinaryWriter::_write(const T& value) {
+  static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be written directly");
+  _stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+  _position += sizeof(T);
+}
+
+void BinaryWriter::_write_string(const std::string& string) {
+  _write(static_cast<uint32_t>(string.size()));
+  _stream.write(string.data(), static_cast<std::streamsize>(string.size()));
+  _position += string.size();
+}
+
+}  // namespace opossum
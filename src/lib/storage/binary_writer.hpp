@@ -0,0 +1,54 @@
+#pragma once
+
+#include <fstream>
+#include <span>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseAttributeVector;
+class BaseSegment;
+class BloomFilter;
+class Chunk;
+class FsstSymbolTable;
+class Table;
+
+// Writes tables into the binary format described in binary_format.hpp.
+class BinaryWriter : private Noncopyable {
+ public:
+  // writes the table into the file, replacing it if it exists
+  // the file is written under a temporary name first, so that an interrupted write does not destroy the previous file
+  static void write(const Table& table, const std::string& file_name);
+
+ protected:
+  explicit BinaryWriter(const std::string& file_name);
+
+  void _write_chunk(const Table& table, const Chunk& chunk);
+
+  template <typename T>
+  void _write_segment(const BaseSegment& segment);
+
+  void _write_attribute_vector(const BaseAttributeVector& attribute_vector);
+
+  void _write_symbol_table(const FsstSymbolTable& symbol_table);
+
+  void _write_bloom_filter(const BloomFilter* bloom_filter);
+
+  template <typename T>
+  void _write_values(const std::span<const T> values);
+
+  template <typename T>
+  void _write_array(const T* data, const size_t size);
+
+  template <typename T>
+  void _write(const T& value);
+
+  void _write_string(const std::string& string);
+
+  std::ofstream _stream;
+  size_t _position = 0;
+};
+
+}  // namespace opossum
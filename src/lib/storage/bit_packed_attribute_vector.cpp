@@ -0,0 +1,166 @@
+#include "bit_packed_attribute_vector.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <memory_resource>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+#include "utils/memory_usage.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Extracts the value id at position Index of a block. All shifts and word offsets are compile-time constants.
+template <AttributeVectorWidth Width, size_t Index>
+inline ValueID::base_type extract(const uint64_t* words) {
+  constexpr auto first_bit = Index * Width;
+  constexpr auto word = first_bit / 64;
+  constexpr auto shift = first_bit % 64;
+  constexpr auto mask = (uint64_t{1} << Width) - 1;
+
+  auto value = words[word] >> shift;
+  if constexpr (shift + Width > 64) {
+    value |= words[word + 1] << (64 - shift);
+  }
+  return static_cast<ValueID::base_type>(value & mask);
+}
+
+// Decodes a full block of BLOCK_SIZE value ids. The fold expression unrolls the loop so that the compiler can
+// vectorize the independent shift-and-mask operations.
+template <AttributeVectorWidth Width, size_t... Indices>
+void decode_block(const uint64_t* words, ValueID* output, std::index_sequence<Indices...>) {
+  ((output[Indices] = ValueID{extract<Width, Indices>(words)}), ...);
+}
+
+template <AttributeVectorWidth Width>
+void decode_block(const uint64_t* words, ValueID* output) {
+  decode_block<Width>(words, output, std::make_index_sequence<BitPackedAttributeVector::BLOCK_SIZE>{});
+}
+
+template <size_t... Widths>
+constexpr auto make_block_decoders(std::index_sequence<Widths...>) {
+  return std::array<void (*)(const uint64_t*, ValueID*), sizeof...(Widths)>{
+      &decode_block<static_cast<AttributeVectorWidth>(Widths + 1)>...};
+}
+
+// Decoders for the widths 1 to 32, the decoder for width w is stored at position w - 1.
+constexpr auto block_decoders = make_block_decoders(std::make_index_sequence<32>{});
+
+}  // namespace
+
+BitPackedAttributeVector::BitPackedAttributeVector(const size_t size, const AttributeVectorWidth width,
+                                                   std::pmr::memory_resource* memory_resource)
+    : _size{size}, _width{width}, _mask{(uint64_t{1} << width) - 1}, _words{memory_resource} {
+  Assert(width >= 1 && width <= 32, "Bit-packed value ids must have a width between 1 and 32 bits");
+  _decode_block = block_decoders[width - 1];
+  _words.resize((size * width + 63) / 64);
+  _word_data = _words.data();
+}
+
+BitPackedAttributeVector::BitPackedAttributeVector(const std::vector<ValueID>& value_ids,
+                                                   const AttributeVectorWidth width,
+                                                   std::pmr::memory_resource* memory_resource)
+    : BitPackedAttributeVector(value_ids.size(), width, memory_resource) {
+  // Fill the words sequentially instead of calling set() so that every word is written only once.
+  auto bit = size_t{0};
+  for (const auto value_id : value_ids) {
+    DebugAssert(value_id <= _mask, "Value id does not fit into the width of the attribute vector");
+    const auto word = bit / 64;
+    const auto shift = bit % 64;
+    _words[word] |= uint64_t{value_id} << shift;
+    if (shift + _width > 64) {
+      _words[word + 1] |= uint64_t{value_id} >> (64 - shift);
+    }
+    bit += _width;
+  }
+}
+
+BitPackedAttributeVector::BitPackedAttributeVector(pmr_vector<uint64_t>&& words, const size_t size,
+                                                   const AttributeVectorWidth width)
+    : BitPackedAttributeVector(0, width) {
+  Assert(words.size() == (size * width + 63) / 64, "Number of words does not match the size and width");
+  _size = size;
+  _words = std::move(words);
+  _word_data = _words.data();
+}
+
+BitPackedAttributeVector::BitPackedAttributeVector(const std::span<const uint64_t> words, const size_t size,
+                                                   const AttributeVectorWidth width, std::shared_ptr<const void> owner)
+    : BitPackedAttributeVector(0, width) {
+  Assert(words.size() == (size * width + 63) / 64, "Number of words does not match the size and width");
+  _size = size;
+  _word_data = words.data();
+  _owner = std::move(owner);
+}
+
+AttributeVectorWidth BitPackedAttributeVector::required_width(const size_t unique_values_count) {
+  if (unique_values_count <= 1) return 1;
+  return static_cast<AttributeVectorWidth>(std::bit_width(unique_values_count - 1));
+}
+
+ValueID BitPackedAttributeVector::get(const size_t i) const {
+  DebugAssert(i < _size, "Position exceeds the attribute vector");
+  const auto bit = i * _width;
+  const auto word = bit / 64;
+  const auto shift = bit % 64;
+
+  auto value = _word_data[word] >> shift;
+  if (shift + _width > 64) {
+    value |= _word_data[word + 1] << (64 - shift);
+  }
+  return ValueID{static_cast<ValueID::base_type>(value & _mask)};
+}
+
+void BitPackedAttributeVector::decode(const size_t begin, const size_t length, ValueID* output) const {
+  DebugAssert(begin + length <= _size, "Decoded range exceeds the attribute vector");
+  const auto end = begin + length;
+
+  // Decode single values up to the first block boundary, then whole blocks, then the remaining values.
+  const auto first_block_begin = std::min((begin + BLOCK_SIZE - 1) / BLOCK_SIZE * BLOCK_SIZE, end);
+  const auto last_block_end = std::max(end / BLOCK_SIZE * BLOCK_SIZE, first_block_begin);
+
+  auto position = begin;
+  for (; position < first_block_begin; ++position) {
+    *output++ = get(position);
+  }
+  for (; position < last_block_end; position += BLOCK_SIZE) {
+    _decode_block(_word_data + position / BLOCK_SIZE * _width, output);
+    output += BLOCK_SIZE;
+  }
+  for (; position < end; ++position) {
+    *output++ = get(position);
+  }
+}
+
+void BitPackedAttributeVector::set(const size_t i, const ValueID value_id) {
+  Assert(!_owner, "Attribute vectors in memory owned by other objects are read-only");
+  Assert(i < _size, "Position exceeds the attribute vector");
+  Assert(value_id <= _mask, "Value id does not fit into the width of the attribute vector");
+  const auto bit = i * _width;
+  const auto word = bit / 64;
+  const auto shift = bit % 64;
+
+  _words[word] = (_words[word] & ~(_mask << shift)) | (uint64_t{value_id} << shift);
+  if (shift + _width > 64) {
+    const auto high_shift = 64 - shift;
+    _words[word + 1] = (_words[word + 1] & ~(_mask >> high_shift)) | (uint64_t{value_id} >> high_shift);
+  }
+}
+
+size_t BitPackedAttributeVector::size() const { return _size; }
+
+AttributeVectorWidth BitPackedAttributeVector::width() const { return _width; }
+
+size_t BitPackedAttributeVector::estimate_memory_usage() const {
+  return std::max(_words.capacity(), (_size * _width + 63) / 64) * sizeof(uint64_t);
+}
+
+size_t BitPackedAttributeVector::memory_usage() const { return sizeof(*this) + heap_memory_usage(_words); }
+
+std::span<const uint64_t> BitPackedAttributeVector::words() const { return {_word_data, (_size * _width + 63) / 64}; }
+
+}  // namespace opossum
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <span>
+#include <vector>
+
+#include "base_attribute_vector.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// BitPackedAttributeVector stores each value id with a fixed number of bits (1 to 32) in a sequence of 64-bit words.
+// Value ids may span two words. Every block of 64 value ids starts at a word boundary and occupies exactly width()
+// words, so that bulk reads can decode whole blocks with width-specific, unrolled code.
+class BitPackedAttributeVector : public BaseAttributeVector {
+ public:
+  // number of value ids that are decoded together
+  static constexpr auto BLOCK_SIZE = size_t{64};
+
+  // creates a vector of size value ids that are all zero
+  // the words are allocated from the given memory resource, which has to outlive the vector
+  BitPackedAttributeVector(const size_t size, const AttributeVectorWidth width,
+                           std::pmr::memory_resource* memory_resource = std::pmr::get_default_resource());
+
+  // creates a vector holding the given value ids
+  BitPackedAttributeVector(const std::vector<ValueID>& value_ids, const AttributeVectorWidth width,
+                           std::pmr::memory_resource* memory_resource = std::pmr::get_default_resource());
+
+  // creates a vector from its packed words, e.g., as returned by words()
+  BitPackedAttributeVector(pmr_vector<uint64_t>&& words, const size_t size, const AttributeVectorWidth width);
+
+  // creates a read-only vector whose words are stored in memory owned by another object, e.g., a memory-mapped file,
+  // which is kept alive as long as the vector
+  BitPackedAttributeVector(const std::span<const uint64_t> words, const size_t size, const AttributeVectorWidth width,
+                           std::shared_ptr<const void> owner);
+
+  // returns the minimal width that can hold all value ids of a dictionary with the given number of entries
+  static AttributeVectorWidth required_width(const size_t unique_values_count);
+
+  ValueID get(const size_t i) const final;
+
+  void decode(const size_t begin, const size_t length, ValueID* output) const final;
+
+  void set(const size_t i, const ValueID value_id) final;
+
+  size_t size() const final;
+
+  AttributeVectorWidth width() const final;
+
+  size_t estimate_memory_usage() const final;
+
+  size_t memory_usage() const final;
+
+  // returns the packed value ids, e.g., for persisting them
+  std::span<const uint64_t> words() const;
+
+ protected:
+  using BlockDecoder = void (*)(const uint64_t* words, ValueID* output);
+
+  size_t _size;
+  AttributeVectorWidth _width;
+  uint64_t _mask;
+  BlockDecoder _decode_block;
+  // the packed words, unless they are stored in memory owned by _owner. All reads go through _word_data.
+  pmr_vector<uint64_t> _words;
+  const uint64_t* _word_data;
+  std::shared_ptr<const void> _owner;
+};
+
+}  // namespace opossum
@@ -0,0 +1,95 @@
+#include "bloom_filter.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include "utils/assert.hpp"
+#include "utils/memory_usage.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Blocking concentrates the bits of similar numbers of values in the same block, which raises the false-positive rate
+// of a given size. Adding a few bits per value brings it back to about the requested rate.
+constexpr auto BLOCKING_OVERHEAD = 1.2;
+
+// odd multipliers that derive the bit positions of the hash functions from a single hash
+constexpr auto BIT_SALTS = std::array<uint32_t, BloomFilter::MAX_HASH_COUNT>{
+    0x47b6137bu, 0x44974d91u, 0x8824ad5bu, 0xa2b7289du, 0x705495c7u, 0x2df1424bu, 0x9efc4947u, 0x5c6bfb31u,
+    0x7a1b3c5du, 0xc2b2ae35u, 0x27d4eb2fu, 0x165667b1u, 0x85ebca6bu, 0xcc9e2d51u, 0x1b873593u, 0xe6546b65u};
+
+}  // namespace
+
+BloomFilter::BloomFilter(const size_t value_count, const double false_positive_rate) {
+  Assert(false_positive_rate > 0.0 && false_positive_rate < 1.0, "False-positive rate must be between 0 and 1");
+
+  // A standard Bloom filter needs -log2(p) / ln(2) bits per value and -log2(p) hash functions.
+  _hash_count =
+      static_cast<uint8_t>(std::clamp(std::lround(-std::log2(false_positive_rate)), 1L, long{MAX_HASH_COUNT}));
+  const auto bits_per_value = -std::log2(false_positive_rate) / std::log(2.0) * BLOCKING_OVERHEAD;
+  const auto bit_count = static_cast<double>(std::max(value_count, size_t{1})) * bits_per_value;
+  _blocks.resize(static_cast<size_t>(std::ceil(bit_count / BLOCK_BITS)));
+}
+
+BloomFilter::BloomFilter(const std::span<const uint64_t> words, const uint8_t hash_count)
+    : _blocks(words.size() / (BLOCK_BITS / 64)), _hash_count{hash_count} {
+  Assert(!words.empty() && words.size() % (BLOCK_BITS / 64) == 0, "Bloom filters consist of whole blocks");
+  Assert(_hash_count >= 1 && _hash_count <= MAX_HASH_COUNT, "Invalid number of hash functions");
+  std::memcpy(_blocks.data(), words.data(), words.size_bytes());
+}
+
+void BloomFilter::insert(const uint64_t hash) {
+  auto& block = _blocks[_block_index(hash)];
+  const auto masks = _masks(hash);
+  for (auto word = size_t{0}; word < masks.size(); ++word) {
+    block.words[word] |= masks[word];
+  }
+}
+
+bool BloomFilter::may_contain(const uint64_t hash) const {
+  const auto& block = _blocks[_block_index(hash)];
+  const auto masks = _masks(hash);
+  auto missing_bits = uint64_t{0};
+  for (auto word = size_t{0}; word < masks.size(); ++word) {
+    missing_bits |= masks[word] & ~block.words[word];
+  }
+  return missing_bits == 0;
+}
+
+uint8_t BloomFilter::hash_count() const {
+  return _hash_count;
+}
+
+std::span<const uint64_t> BloomFilter::words() const {
+  return {reinterpret_cast<const uint64_t*>(_blocks.data()), _blocks.size() * (BLOCK_BITS / 64)};
+}
+
+size_t BloomFilter::estimate_memory_usage() const {
+  return _blocks.size() * sizeof(Block);
+}
+
+size_t BloomFilter::heap_memory_usage() const {
+  return opossum::heap_memory_usage(_blocks);
+}
+
+size_t BloomFilter::_block_index(const uint64_t hash) const {
+  // The upper 32 bits are mapped to the blocks by multiplication instead of a modulo.
+  return static_cast<size_t>(((hash >> 32) * _blocks.size()) >> 32);
+}
+
+std::array<uint64_t, BloomFilter::BLOCK_BITS / 64> BloomFilter::_masks(const uint64_t hash) const {
+  // The bit positions within the block are taken from the upper bits of the lower 32 bits multiplied by a different
+  // odd constant per hash function.
+  const auto lower_hash = static_cast<uint32_t>(hash);
+  auto masks = std::array<uint64_t, BLOCK_BITS / 64>{};
+  for (auto index = uint8_t{0}; index < _hash_count; ++index) {
+    const auto bit = (lower_hash * BIT_SALTS[index]) >> (32 - 9);
+    masks[bit / 64] |= uint64_t{1} << (bit % 64);
+  }
+  return masks;
+}
+
+}  // namespace opossum
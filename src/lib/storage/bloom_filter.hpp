@@ -0,0 +1,59 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace opossum {
+
+// BloomFilter is a cache-blocked Bloom filter over 64-bit hashes (Putze et al., "Cache-, Hash- and Space-Efficient
+// Bloom Filters"). The first bits of a hash select one block of 512 bits, i.e., one cache line, and all bits of the
+// hash are set and tested in that block. Hence, a lookup touches a single cache line, at the cost of a slightly higher
+// false-positive rate than a standard Bloom filter of the same size, which the sizing compensates for.
+//
+// DictionarySegments use it to rule out equality predicates without searching their dictionary.
+class BloomFilter {
+ public:
+  static constexpr auto BLOCK_BITS = size_t{512};
+  static constexpr auto MAX_HASH_COUNT = uint8_t{16};
+
+  // creates a filter for value_count distinct values that reports values it does not contain with about the given
+  // probability
+  BloomFilter(const size_t value_count, const double false_positive_rate);
+
+  // creates a filter from its words and number of hash functions, e.g., as returned by words() and hash_count()
+  BloomFilter(const std::span<const uint64_t> words, const uint8_t hash_count);
+
+  // inserts the value of a hash as returned by mixed_hash (see utils/hash.hpp)
+  void insert(const uint64_t hash);
+
+  // returns false if the value of the hash has certainly not been inserted
+  bool may_contain(const uint64_t hash) const;
+
+  // returns the number of bits set and tested per value
+  uint8_t hash_count() const;
+
+  // returns the bits of all blocks
+  std::span<const uint64_t> words() const;
+
+  // returns the memory used by the blocks
+  size_t estimate_memory_usage() const;
+
+  // returns the memory allocated for the blocks, i.e., without the filter object itself
+  size_t heap_memory_usage() const;
+
+ protected:
+  struct alignas(64) Block {
+    std::array<uint64_t, BLOCK_BITS / 64> words;
+  };
+
+  // returns the block of a hash and the mask of the bits in each of its words
+  size_t _block_index(const uint64_t hash) const;
+  std::array<uint64_t, BLOCK_BITS / 64> _masks(const uint64_t hash) const;
+
+  std::vector<Block> _blocks;
+  uint8_t _hash_count;
+};
+
+}  // namespace opossum
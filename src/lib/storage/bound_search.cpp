@@ -0,0 +1,135 @@
+#include "bound_search.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "utils/assert.hpp"
+#include "utils/memory_usage.hpp"
+
+namespace opossum {
+
+template <typename T>
+BoundSearch<T>::BoundSearch(const T* values, const size_t size) : _values{values}, _size{size} {
+  if constexpr (std::is_arithmetic_v<T>) {
+    if (_size >= EYTZINGER_THRESHOLD) {
+      Assert(_size < std::numeric_limits<uint32_t>::max(), "Too many values for the Eytzinger layout");
+      _eytzinger.resize(_size + 1);
+      _eytzinger_positions.resize(_size + 1);
+      auto sorted_position = size_t{0};
+      _build_eytzinger(sorted_position, 1);
+    }
+  }
+}
+
+template <typename T>
+size_t BoundSearch<T>::lower_bound(const T& value) const {
+  if (uses_eytzinger_layout()) return _eytzinger_search<false>(value);
+  return _binary_search<false>(value);
+}
+
+template <typename T>
+size_t BoundSearch<T>::upper_bound(const T& value) const {
+  if (uses_eytzinger_layout()) return _eytzinger_search<true>(value);
+  return _binary_search<true>(value);
+}
+
+template <typename T>
+size_t BoundSearch<T>::size() const {
+  return _size;
+}
+
+template <typename T>
+bool BoundSearch<T>::uses_eytzinger_layout() const {
+  return !_eytzinger.empty();
+}
+
+template <typename T>
+size_t BoundSearch<T>::estimate_memory_usage() const {
+  return _eytzinger.capacity() * sizeof(T) + _eytzinger_positions.capacity() * sizeof(uint32_t);
+}
+
+template <typename T>
+size_t BoundSearch<T>::heap_memory_usage() const {
+  return opossum::heap_memory_usage(_eytzinger) + opossum::heap_memory_usage(_eytzinger_positions);
+}
+
+template <typename T>
+template <bool Upper>
+size_t BoundSearch<T>::_binary_search(const T& value) const {
+  // For lower_bound, we look for the first value that is not less than the search value. For upper_bound, we look for
+  // the first value that is greater than the search value. In both cases, everything before it is "left" of it.
+  const auto is_left = [&value](const T& candidate) {
+    if constexpr (Upper) {
+      return !(value < candidate);
+    } else {
+      return candidate < value;
+    }
+  };
+
+  // Halve the window [base, base + length] that contains the result until only a few candidates are left. Moving the
+  // base is written as a conditional expression so that the compiler can emit a conditional move instead of a branch,
+  // which would be mispredicted every second step.
+  constexpr auto final_length = std::is_arithmetic_v<T> ? PROBE_WIDTH : size_t{1};
+  const auto* base = _values;
+  auto length = _size;
+  while (length > final_length) {
+    const auto half = length / 2;
+    base = is_left(base[half]) ? base + half : base;
+    length -= half;
+  }
+
+  // The result lies within the remaining window. Counting the values left of it has a fixed amount of work per
+  // candidate and is vectorized for arithmetic types.
+  auto left_count = size_t{0};
+  for (auto offset = size_t{0}; offset < length; ++offset) {
+    left_count += is_left(base[offset]);
+  }
+
+  return static_cast<size_t>(base - _values) + left_count;
+}
+
+template <typename T>
+template <bool Upper>
+size_t BoundSearch<T>::_eytzinger_search(const T& value) const {
+  // Number of nodes per cache line. With n nodes per cache line, the descendants of node k that are log2(n) levels
+  // further down are stored next to each other at [n * k, n * k + n - 1]. Thus, we can fetch them with a single
+  // prefetch while we are still comparing the nodes in between.
+  constexpr auto nodes_per_cache_line = std::max(size_t{64} / sizeof(T), size_t{1});
+
+  const auto* const nodes = _eytzinger.data();
+  const auto last_node = _size;
+  auto node = size_t{1};
+  while (node <= last_node) {
+    __builtin_prefetch(nodes + std::min(node * nodes_per_cache_line, last_node));
+    if constexpr (Upper) {
+      node = 2 * node + !(value < nodes[node]);
+    } else {
+      node = 2 * node + (nodes[node] < value);
+    }
+  }
+
+  // Each step to the right appended a 1 to node, each step to the left a 0. The result is the node where we last went
+  // left, i.e., we remove the trailing ones and the final zero. If we never went left, node becomes 0.
+  node >>= __builtin_ffsll(static_cast<int64_t>(~node));
+  return node == 0 ? _size : _eytzinger_positions[node];
+}
+
+template <typename T>
+void BoundSearch<T>::_build_eytzinger(size_t& sorted_position, const size_t node) {
+  // An in-order traversal of the implicit tree visits the nodes in sorted order.
+  if (node > _size) return;
+
+  _build_eytzinger(sorted_position, 2 * node);
+  _eytzinger[node] = _values[sorted_position];
+  _eytzinger_positions[node] = static_cast<uint32_t>(sorted_position);
+  ++sorted_position;
+  _build_eytzinger(sorted_position, 2 * node + 1);
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(BoundSearch);
+
+}  // namespace opossum
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace opossum {
+
+// BoundSearch answers lower_bound/upper_bound queries on a sorted, immutable array of values, e.g., the dictionary of
+// a DictionarySegment. It does not own the searched values - the caller has to make sure that they outlive the search.
+//
+// Depending on the data type and the number of values, one of two strategies is used:
+//  - Branch-free binary search that shrinks the search window without data-dependent branches. For arithmetic types,
+//    the last few candidates are resolved by counting the smaller values in a single, vectorizable pass.
+//  - For large arithmetic dictionaries, an additional copy of the values is stored in Eytzinger (BFS) order. This
+//    places the nodes of the first search steps next to each other and allows prefetching the cache lines of the
+//    following levels, which cuts the cache misses of searches in dictionaries that do not fit into the caches.
+template <typename T>
+class BoundSearch {
+ public:
+  // Below this number of values, the final candidates are compared linearly instead of halving the window further.
+  static constexpr auto PROBE_WIDTH = size_t{16};
+
+  // Starting at this number of values, arithmetic dictionaries are searched using the Eytzinger layout.
+  static constexpr auto EYTZINGER_THRESHOLD = size_t{1} << 14;
+
+  BoundSearch(const T* values, const size_t size);
+
+  // returns the position of the first value >= the search value, or size() if there is none
+  size_t lower_bound(const T& value) const;
+
+  // returns the position of the first value > the search value, or size() if there is none
+  size_t upper_bound(const T& value) const;
+
+  // returns the number of searchable values
+  size_t size() const;
+
+  // returns whether the Eytzinger layout is used for searching
+  bool uses_eytzinger_layout() const;
+
+  // returns the memory used by the auxiliary search structures (i.e., not counting the searched values)
+  size_t estimate_memory_usage() const;
+
+  // returns the memory allocated for the Eytzinger layout, i.e., without the search object itself
+  size_t heap_memory_usage() const;
+
+ protected:
+  const T* _values;
+  size_t _size;
+
+  // 1-based Eytzinger layout of _values and the position in _values of each Eytzinger node
+  std::vector<T> _eytzinger;
+  std::vector<uint32_t> _eytzinger_positions;
+
+  template <bool Upper>
+  size_t _binary_search(const T& value) const;
+
+  template <bool Upper>
+  size_t _eytzinger_search(const T& value) const;
+
+  void _build_eytzinger(size_t& sorted_position, const size_t node);
+};
+
+}  // namespace opossum
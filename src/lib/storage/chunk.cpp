@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <iomanip>
 #include <memory>
 #include <mutex>
@@ -6,15 +7,19 @@
 #include <vector>
 
 #include "base_segment.hpp"
+#include "base_zone_map.hpp"
 #include "chunk.hpp"
+#include "reference_segment.hpp"
 
 #include "utils/assert.hpp"
+#include "utils/memory_usage.hpp"
 
 namespace opossum {
 
 void Chunk::add_segment(std::shared_ptr<BaseSegment> segment) {
   std::lock_guard<std::mutex> lock(_add_segment_lock);
   _segments.push_back(segment);
+  _zone_maps.emplace_back();
 }
 
 void Chunk::append(const std::vector<AllTypeVariant>& values) {
@@ -22,22 +27,72 @@ void Chunk::append(const std::vector<AllTypeVariant>& values) {
 
   int size = _segments.size();
   for (int column_index = 0; column_index < size; column_index++) {
-    _segments[column_index]->append(values[column_index]);
+    get_segment(ColumnID(column_index))->append(values[column_index]);
   }
 }
 
-std::shared_ptr<BaseSegment> Chunk::get_segment(ColumnID column_id) const { return _segments.at(column_id); }
+// Segments may be replaced while they are read, so they are always accessed atomically.
+std::shared_ptr<BaseSegment> Chunk::get_segment(ColumnID column_id) const {
+  return std::atomic_load(&_segments.at(column_id));
+}
+
+bool Chunk::replace_segment(ColumnID column_id, const std::shared_ptr<BaseSegment>& expected_segment,
+                            const std::shared_ptr<BaseSegment>& segment) {
+  auto expected = expected_segment;
+  return std::atomic_compare_exchange_strong(&_segments.at(column_id), &expected, segment);
+}
+
+// Zone maps are set by the compression while scans read them, so they are accessed atomically like the segments.
+std::shared_ptr<const BaseZoneMap> Chunk::get_zone_map(ColumnID column_id) const {
+  return std::atomic_load(&_zone_maps.at(column_id));
+}
+
+void Chunk::set_zone_map(ColumnID column_id, const std::shared_ptr<const BaseZoneMap>& zone_map) {
+  std::atomic_store(&_zone_maps.at(column_id), zone_map);
+}
+
+size_t Chunk::memory_usage(ColumnID column_id) const {
+  const auto segment = get_segment(column_id);
+  auto allocated_bytes = segment->memory_usage() + SHARED_POINTER_CONTROL_BLOCK_SIZE;
+  if (const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment)) {
+    allocated_bytes += reference_segment->pos_list_memory_usage();
+  }
+  if (const auto zone_map = get_zone_map(column_id)) {
+    allocated_bytes += zone_map->memory_usage() + SHARED_POINTER_CONTROL_BLOCK_SIZE;
+  }
+  return allocated_bytes;
+}
+
+size_t Chunk::memory_usage() const {
+  auto allocated_bytes = sizeof(*this) + heap_memory_usage(_segments) + heap_memory_usage(_zone_maps);
+  // The ReferenceSegments of a chunk usually share their position list, which memory_usage(column_id) includes for
+  // each of them.
+  auto pos_lists = std::vector<const PosList*>{};
+  for (auto column_id = ColumnID{0}; column_id < _segments.size(); ++column_id) {
+    allocated_bytes += memory_usage(column_id);
+    const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(get_segment(column_id));
+    if (!reference_segment) continue;
+    const auto* const pos_list = reference_segment->pos_list().get();
+    if (std::find(pos_lists.begin(), pos_lists.end(), pos_list) == pos_lists.end()) {
+      pos_lists.push_back(pos_list);
+    } else {
+      allocated_bytes -= reference_segment->pos_list_memory_usage();
+    }
+  }
+  return allocated_bytes;
+}
 
 ColumnCount Chunk::column_count() const {
   uint16_t count = _segments.size();
   return ColumnCount{count};
 }
 
-ChunkOffset Chunk::size() const { return _segments.empty() ? 0 : _segments[0]->size(); }
+ChunkOffset Chunk::size() const { return _segments.empty() ? 0 : get_segment(ColumnID{0})->size(); }
 
 void Chunk::print(int col_size, std::ostream& out) const {
   for (ChunkOffset i = 0; i < size(); i++) {
-    for (auto segment : _segments) {
+    for (ColumnID column_id{0}; column_id < _segments.size(); ++column_id) {
+      const auto segment = get_segment(column_id);
       std::string line;
       AllTypeVariant value = (*segment)[i];
       std::stringstream ss;
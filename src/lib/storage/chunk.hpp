@@ -15,6 +15,7 @@ namespace opossum {
 
 class BaseIndex;
 class BaseSegment;
+class BaseZoneMap;
 
 // A chunk is a horizontal partition of a table.
 // For each column in the table, it holds one segment. The _segments across all chunks constitute the column.
@@ -40,11 +41,34 @@ class Chunk : private Noncopyable {
   // Returns the segment at a given position
   std::shared_ptr<BaseSegment> get_segment(ColumnID column_id) const;
 
+  // Replaces the segment at the given position if it is still the expected one, e.g., by its compressed version.
+  // Returns false if the segment has been replaced in the meantime. Readers are not blocked: a reader that obtained
+  // the previous segment via get_segment keeps it alive until it is done with it.
+  bool replace_segment(ColumnID column_id, const std::shared_ptr<BaseSegment>& expected_segment,
+                       const std::shared_ptr<BaseSegment>& segment);
+
+  // returns the zone map of a column, or nullptr if there is none, e.g., because the segment is not compressed yet
+  std::shared_ptr<const BaseZoneMap> get_zone_map(ColumnID column_id) const;
+
+  // sets the zone map of a column, which has to describe its current segment
+  void set_zone_map(ColumnID column_id, const std::shared_ptr<const BaseZoneMap>& zone_map);
+
+  // returns the memory actually allocated for the segment and the zone map of a column, including their shared
+  // pointer control blocks (see BaseSegment::memory_usage) and the position list of a ReferenceSegment, even if other
+  // columns share it
+  size_t memory_usage(ColumnID column_id) const;
+
+  // returns the memory actually allocated for the chunk, i.e., the chunk object and all its segments and zone maps
+  // position lists shared by several ReferenceSegments are counted once
+  size_t memory_usage() const;
+
   // Prints chunk
   void print(int col_size, std::ostream& out = std::cout) const;
 
  protected:
   std::vector<std::shared_ptr<BaseSegment>> _segments;
+  // one entry per segment, set once the segment is immutable
+  std::vector<std::shared_ptr<const BaseZoneMap>> _zone_maps;
   std::mutex _add_segment_lock;
 };
 
@@ -0,0 +1,56 @@
+#include "chunk_directory.hpp"
+
+#include <atomic>
+#include <bit>
+#include <cstdint>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ChunkDirectory::~ChunkDirectory() {
+  for (auto& block : _blocks) {
+    delete[] block.load();
+  }
+}
+
+ChunkID ChunkDirectory::size() const { return ChunkID{_size.load(std::memory_order_acquire)}; }
+
+Chunk& ChunkDirectory::get(const ChunkID chunk_id) const {
+  Assert(chunk_id < size(), "Chunk does not exist");
+  return *_slot(chunk_id).load(std::memory_order_acquire);
+}
+
+void ChunkDirectory::push_back(Chunk& chunk) {
+  const auto chunk_id = _size.load(std::memory_order_relaxed);
+  Assert(chunk_id < INVALID_CHUNK_ID, "Too many chunks");
+
+  // Block b holds the ids [2^b - 1, 2^(b + 1) - 1), so the first id of a block is one less than a power of two.
+  const auto block = std::bit_width(uint64_t{chunk_id} + 1) - 1;
+  if (std::has_single_bit(uint64_t{chunk_id} + 1)) {
+    _blocks[block].store(new Slot[size_t{1} << block], std::memory_order_release);
+  }
+  _slot(ChunkID{chunk_id}).store(&chunk, std::memory_order_release);
+  _size.store(chunk_id + 1, std::memory_order_release);
+}
+
+void ChunkDirectory::replace(const ChunkID chunk_id, Chunk& chunk) {
+  Assert(chunk_id < size(), "Chunk does not exist");
+  _slot(chunk_id).store(&chunk, std::memory_order_release);
+}
+
+size_t ChunkDirectory::heap_memory_usage() const {
+  // The blocks up to the one of the last chunk have been allocated, which are 2^(b + 1) - 1 slots for block b.
+  const auto chunk_count = uint64_t{size()};
+  if (chunk_count == 0) return 0;
+  const auto last_block = std::bit_width(chunk_count) - 1;
+  return ((size_t{1} << (last_block + 1)) - 1) * sizeof(Slot);
+}
+
+ChunkDirectory::Slot& ChunkDirectory::_slot(const ChunkID chunk_id) const {
+  const auto index = uint64_t{chunk_id} + 1;
+  const auto block = std::bit_width(index) - 1;
+  return _blocks[block].load(std::memory_order_acquire)[index - (uint64_t{1} << block)];
+}
+
+}  // namespace opossum
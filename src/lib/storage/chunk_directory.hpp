@@ -0,0 +1,54 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+
+// ChunkDirectory maps chunk ids to the chunks of a table, so that readers never wait for writers. Looking up a chunk
+// and the number of chunks is wait-free, i.e., it takes a fixed number of atomic loads and no locks.
+//
+// The slots are split into blocks of 1, 2, 4, 8, ... slots. A block is allocated when its first slot is used and never
+// moved, so readers can keep reading a slot while chunks are added. A chunk is published by storing it in its slot
+// before increasing the size with release semantics. 32 blocks cover every ChunkID.
+//
+// The directory does not own the chunks. Writers have to be serialized, and chunks that are replaced have to stay
+// alive as long as readers may still use them (see Table::emplace_chunk and Table::compress_chunk).
+class ChunkDirectory : private Noncopyable {
+ public:
+  ChunkDirectory() = default;
+  ~ChunkDirectory();
+
+  // returns the number of chunks
+  ChunkID size() const;
+
+  // returns the chunk with the given id, which has to be smaller than size()
+  Chunk& get(const ChunkID chunk_id) const;
+
+  // adds a chunk to the end
+  void push_back(Chunk& chunk);
+
+  // replaces the chunk with the given id. Readers see either the old or the new chunk.
+  void replace(const ChunkID chunk_id, Chunk& chunk);
+
+  // returns the memory allocated for the blocks, i.e., without the directory object itself
+  size_t heap_memory_usage() const;
+
+ protected:
+  static constexpr auto BLOCK_COUNT = size_t{32};
+
+  using Slot = std::atomic<Chunk*>;
+
+  // returns the slot of a chunk whose block has already been allocated
+  Slot& _slot(const ChunkID chunk_id) const;
+
+  std::array<std::atomic<Slot*>, BLOCK_COUNT> _blocks{};
+  std::atomic<ChunkID::base_type> _size{0};
+};
+
+}  // namespace opossum
@@ -0,0 +1,212 @@
+#include "delta_segment.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+#include "utils/memory_usage.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Appends the difference of value to previous as a zigzag-encoded varint.
+template <typename T>
+void append_delta(std::vector<uint8_t>& bytes, const T previous, const T value) {
+  using Unsigned = std::make_unsigned_t<T>;
+  const auto delta = static_cast<Unsigned>(static_cast<Unsigned>(value) - static_cast<Unsigned>(previous));
+  // Zigzag encoding maps the differences 0, -1, 1, -2, ... to 0, 1, 2, 3, ..., so that small negative ones stay small.
+  const auto sign = static_cast<Unsigned>(static_cast<T>(delta) >> (std::numeric_limits<Unsigned>::digits - 1));
+  auto zigzag = uint64_t{static_cast<Unsigned>(static_cast<Unsigned>(delta << 1) ^ sign)};
+  while (zigzag >= 0x80) {
+    bytes.push_back(static_cast<uint8_t>(zigzag | 0x80));
+    zigzag >>= 7;
+  }
+  bytes.push_back(static_cast<uint8_t>(zigzag));
+}
+
+}  // namespace
+
+template <typename T>
+DeltaSegment<T>::DeltaSegment(const std::shared_ptr<BaseSegment>& base_segment) {
+  const auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(base_segment);
+  Assert(value_segment, "DeltaSegments can only be created from ValueSegments of the same type");
+
+  const auto& values = value_segment->values();
+  _size = static_cast<ChunkOffset>(values.size());
+  const auto block_count = (size_t{_size} + BLOCK_SIZE - 1) / BLOCK_SIZE;
+  _block_first_values.reserve(block_count);
+  _block_byte_offsets.reserve(block_count);
+  // Small deltas take a single byte.
+  _bytes.reserve(_size);
+
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _size; ++chunk_offset) {
+    if (chunk_offset % BLOCK_SIZE == 0) {
+      _block_first_values.push_back(values[chunk_offset]);
+      _block_byte_offsets.push_back(_bytes.size());
+    } else {
+      append_delta(_bytes, values[chunk_offset - 1], values[chunk_offset]);
+    }
+    if (chunk_offset > 0 && values[chunk_offset] < values[chunk_offset - 1]) _is_sorted = false;
+  }
+  _bytes.shrink_to_fit();
+}
+
+template <typename T>
+DeltaSegment<T>::DeltaSegment(std::vector<T>&& block_first_values, std::vector<uint64_t>&& block_byte_offsets,
+                              std::vector<uint8_t>&& bytes, const ChunkOffset size)
+    : _size{size},
+      _block_first_values{std::move(block_first_values)},
+      _block_byte_offsets{std::move(block_byte_offsets)},
+      _bytes{std::move(bytes)} {
+  Assert(_block_first_values.size() == (size_t{_size} + BLOCK_SIZE - 1) / BLOCK_SIZE,
+         "Number of blocks does not match the size");
+  Assert(_block_byte_offsets.size() == _block_first_values.size(), "Every block needs a first value and an offset");
+
+  // Check that the varints of every block end exactly where the next block begins, so that decoding them later can
+  // never read beyond the bytes.
+  auto previous = T{};
+  for (auto block = size_t{0}; block < _block_first_values.size(); ++block) {
+    const auto block_end = block + 1 < _block_byte_offsets.size() ? _block_byte_offsets[block + 1] : _bytes.size();
+    Assert(_block_byte_offsets[block] <= block_end && block_end <= _bytes.size(), "Invalid block offsets");
+
+    auto value = _block_first_values[block];
+    if (block > 0 && value < previous) _is_sorted = false;
+    const auto* position = _bytes.data() + _block_byte_offsets[block];
+    const auto* const end = _bytes.data() + block_end;
+    const auto block_size = std::min(BLOCK_SIZE, static_cast<ChunkOffset>(_size - block * BLOCK_SIZE));
+    for (auto index = ChunkOffset{1}; index < block_size; ++index) {
+      const auto* const varint_end = std::find_if(position, end, [](const auto byte) { return !(byte & 0x80); });
+      Assert(varint_end != end && varint_end - position < 10, "Invalid varint in delta segment");
+      previous = value;
+      value = next_value(position, value);
+      if (value < previous) _is_sorted = false;
+    }
+    Assert(position == end, "Blocks of the delta segment contain more bytes than deltas");
+    previous = value;
+  }
+}
+
+template <typename T>
+AllTypeVariant DeltaSegment<T>::operator[](const ChunkOffset chunk_offset) const {
+  Assert(chunk_offset < _size, "Position is out of range");
+  return get(chunk_offset);
+}
+
+template <typename T>
+T DeltaSegment<T>::get(const ChunkOffset chunk_offset) const {
+  DebugAssert(chunk_offset < _size, "Position is out of range");
+  const auto block = chunk_offset / BLOCK_SIZE;
+  const auto* position = _bytes.data() + _block_byte_offsets[block];
+  auto value = _block_first_values[block];
+  for (auto index = ChunkOffset{0}; index < chunk_offset % BLOCK_SIZE; ++index) {
+    value = next_value(position, value);
+  }
+  return value;
+}
+
+template <typename T>
+void DeltaSegment<T>::decode(const ChunkOffset begin, const ChunkOffset length, T* output) const {
+  DebugAssert(begin + length <= _size, "Decoded range exceeds the segment");
+  if (length == 0) return;
+
+  // Decode up to the first value of the range without writing, then every following value once.
+  const auto end = begin + length;
+  const auto block = begin / BLOCK_SIZE;
+  const auto* position = _bytes.data() + _block_byte_offsets[block];
+  auto value = _block_first_values[block];
+  for (auto chunk_offset = block * BLOCK_SIZE; chunk_offset < begin; ++chunk_offset) {
+    value = next_value(position, value);
+  }
+
+  *output++ = value;
+  for (auto chunk_offset = begin + 1; chunk_offset < end; ++chunk_offset) {
+    // The bytes of the blocks are stored consecutively, so only the first value of a block has to be looked up.
+    value = chunk_offset % BLOCK_SIZE == 0 ? _block_first_values[chunk_offset / BLOCK_SIZE]
+                                           : next_value(position, value);
+    *output++ = value;
+  }
+}
+
+template <typename T>
+bool DeltaSegment<T>::is_sorted() const {
+  return _is_sorted;
+}
+
+template <typename T>
+ChunkOffset DeltaSegment<T>::lower_bound(const T value) const {
+  return _partition_point([&](const T& element) { return element < value; });
+}
+
+template <typename T>
+ChunkOffset DeltaSegment<T>::upper_bound(const T value) const {
+  return _partition_point([&](const T& element) { return element <= value; });
+}
+
+template <typename T>
+template <typename Predicate>
+ChunkOffset DeltaSegment<T>::_partition_point(const Predicate& predicate) const {
+  Assert(_is_sorted, "Bounds can only be searched in sorted delta segments");
+
+  // Find the last block whose first value satisfies the predicate, then decode that block only.
+  const auto block_end = std::partition_point(_block_first_values.begin(), _block_first_values.end(), predicate);
+  if (block_end == _block_first_values.begin()) return 0;
+
+  const auto block = static_cast<ChunkOffset>(block_end - _block_first_values.begin() - 1);
+  const auto block_begin = block * BLOCK_SIZE;
+  const auto block_size = std::min(BLOCK_SIZE, _size - block_begin);
+  const auto* position = _bytes.data() + _block_byte_offsets[block];
+  auto value = _block_first_values[block];
+  for (auto index = ChunkOffset{1}; index < block_size; ++index) {
+    value = next_value(position, value);
+    if (!predicate(value)) return block_begin + index;
+  }
+  return block_begin + block_size;
+}
+
+template <typename T>
+void DeltaSegment<T>::append(const AllTypeVariant& val) {
+  throw std::runtime_error("Delta segments are immutable. You shall not append anything.");
+}
+
+template <typename T>
+ChunkOffset DeltaSegment<T>::size() const {
+  return _size;
+}
+
+template <typename T>
+const std::vector<T>& DeltaSegment<T>::block_first_values() const {
+  return _block_first_values;
+}
+
+template <typename T>
+const std::vector<uint64_t>& DeltaSegment<T>::block_byte_offsets() const {
+  return _block_byte_offsets;
+}
+
+template <typename T>
+const std::vector<uint8_t>& DeltaSegment<T>::bytes() const {
+  return _bytes;
+}
+
+template <typename T>
+size_t DeltaSegment<T>::estimate_memory_usage() const {
+  return _block_first_values.size() * sizeof(T) + _block_byte_offsets.size() * sizeof(uint64_t) +
+         _bytes.size() * sizeof(uint8_t);
+}
+
+template <typename T>
+size_t DeltaSegment<T>::memory_usage() const {
+  return sizeof(*this) + heap_memory_usage(_block_first_values) + heap_memory_usage(_block_byte_offsets) +
+         heap_memory_usage(_bytes);
+}
+
+template class DeltaSegment<int32_t>;
+template class DeltaSegment<int64_t>;
+
+}  // namespace opossum
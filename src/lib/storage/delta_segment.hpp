@@ -0,0 +1,109 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "base_segment.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// delta encoding is only implemented for the integer data types, i.e., int and long
+template <typename T>
+constexpr bool is_delta_encodable_v = std::is_same_v<T, int32_t> || std::is_same_v<T, int64_t>;
+
+// DeltaSegment is a segment type for integer columns whose values change little from row to row, e.g., increasing
+// keys or timestamps of append-only tables. Every value is stored as its difference to the previous value, zigzag
+// encoded so that negative differences stay small, and written as a varint of one to ten bytes.
+//
+// The values are split into blocks of BLOCK_SIZE. For every block, the first value and the position of its deltas are
+// stored as skip pointers, so that random access only decodes the deltas of a single block. If the values are sorted
+// (non-decreasing), the first values of the blocks also allow to find a value with a binary search, so that range
+// predicates are answered without decoding more than two blocks.
+template <typename T>
+class DeltaSegment : public BaseSegment {
+  static_assert(is_delta_encodable_v<T>, "Delta encoding requires int or long values");
+
+ public:
+  using Unsigned = std::make_unsigned_t<T>;
+
+  // number of values per skip pointer
+  static constexpr auto BLOCK_SIZE = ChunkOffset{128};
+
+  // creates a delta-encoded segment from a given value segment
+  explicit DeltaSegment(const std::shared_ptr<BaseSegment>& base_segment);
+
+  // creates a segment from already encoded blocks, e.g., when loading a table
+  // the deltas are decoded once to validate them and to find out whether the values are sorted
+  DeltaSegment(std::vector<T>&& block_first_values, std::vector<uint64_t>&& block_byte_offsets,
+               std::vector<uint8_t>&& bytes, const ChunkOffset size);
+
+  // reads the varint at position, advances position past it, and returns the value that follows previous
+  static T next_value(const uint8_t*& position, const T previous) {
+    auto zigzag = uint64_t{0};
+    auto shift = 0;
+    while (*position & 0x80) {
+      zigzag |= uint64_t{*position++ & 0x7fu} << shift;
+      shift += 7;
+    }
+    zigzag |= uint64_t{*position++} << shift;
+
+    const auto delta = static_cast<Unsigned>((zigzag >> 1) ^ (~(zigzag & 1) + 1));
+    return static_cast<T>(static_cast<Unsigned>(static_cast<Unsigned>(previous) + delta));
+  }
+
+  // return the value at a certain position. If you want to write efficient operators, back off!
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  // return the value at a certain position, decoding the deltas from the start of its block
+  T get(const ChunkOffset chunk_offset) const;
+
+  // writes the values at the positions [begin, begin + length) to output
+  // this is the preferred method to read many values, as every delta is decoded only once
+  void decode(const ChunkOffset begin, const ChunkOffset length, T* output) const;
+
+  // returns whether the values are non-decreasing, which is required for lower_bound and upper_bound
+  bool is_sorted() const;
+
+  // returns the first position whose value is >= the search value, or size() if there is none
+  ChunkOffset lower_bound(const T value) const;
+
+  // returns the first position whose value is > the search value, or size() if there is none
+  ChunkOffset upper_bound(const T value) const;
+
+  // delta segments are immutable
+  void append(const AllTypeVariant& val) final;
+
+  // return the number of entries
+  ChunkOffset size() const final;
+
+  // returns the first value of every block
+  const std::vector<T>& block_first_values() const;
+
+  // returns the position of the deltas of every block in bytes()
+  const std::vector<uint64_t>& block_byte_offsets() const;
+
+  // returns the varint-encoded deltas of all values but the first of every block
+  const std::vector<uint8_t>& bytes() const;
+
+  // returns the calculated memory usage
+  size_t estimate_memory_usage() const final;
+
+  size_t memory_usage() const final;
+
+ protected:
+  // returns the first position in [0, size()) for which the predicate is false, given that it is true for a prefix
+  template <typename Predicate>
+  ChunkOffset _partition_point(const Predicate& predicate) const;
+
+  ChunkOffset _size;
+  std::vector<T> _block_first_values;
+  std::vector<uint64_t> _block_byte_offsets;
+  std::vector<uint8_t> _bytes;
+  bool _is_sorted = true;
+};
+
+}  // namespace opossum
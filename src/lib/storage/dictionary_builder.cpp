@@ -0,0 +1,197 @@
+#include "dictionary_builder.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+template <typename T>
+DictionaryBuilder<T>::DictionaryBuilder(const size_t max_thread_count, const size_t min_rows_per_thread)
+    : _max_thread_count{std::max(max_thread_count, size_t{1})},
+      _min_rows_per_thread{std::max(min_rows_per_thread, size_t{1})} {}
+
+template <typename T>
+BuiltDictionary<T> DictionaryBuilder<T>::build(const std::span<const T> values) const {
+  const auto row_count = values.size();
+  auto built_dictionary = BuiltDictionary<T>{};
+  built_dictionary.value_ids.resize(row_count);
+
+  const auto partition_count = std::clamp(row_count / _min_rows_per_thread, size_t{1}, _max_thread_count);
+  if (partition_count == 1) {
+    built_dictionary.dictionary = _build_partition(values.data(), row_count, built_dictionary.value_ids.data());
+    return built_dictionary;
+  }
+
+  const auto rows_per_partition = (row_count + partition_count - 1) / partition_count;
+  const auto run_per_partition = [&](const auto& function) {
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(partition_count);
+    for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+      const auto begin = partition_id * rows_per_partition;
+      const auto end = std::min(begin + rows_per_partition, row_count);
+      jobs.push_back(std::make_shared<JobTask>([&, partition_id, begin, end] { function(partition_id, begin, end); }));
+    }
+    CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+  };
+
+  auto partition_dictionaries = std::vector<std::vector<T>>(partition_count);
+  run_per_partition([&](const size_t partition_id, const size_t begin, const size_t end) {
+    partition_dictionaries[partition_id] =
+        _build_partition(values.data() + begin, end - begin, built_dictionary.value_ids.data() + begin);
+  });
+
+  built_dictionary.dictionary = _merge_dictionaries(partition_dictionaries);
+
+  run_per_partition([&](const size_t partition_id, const size_t begin, const size_t end) {
+    _translate_value_ids(partition_dictionaries[partition_id], built_dictionary.dictionary,
+                         built_dictionary.value_ids.data() + begin, end - begin);
+  });
+
+  return built_dictionary;
+}
+
+template <typename T>
+std::vector<T> DictionaryBuilder<T>::_build_partition(const T* values, const size_t row_count, ValueID* value_ids) {
+  if (std::is_sorted(values, values + row_count)) {
+    return _build_sorted_partition(values, row_count, value_ids);
+  }
+
+  if constexpr (std::is_same_v<T, std::string>) {
+    return _build_partition_by_hashing(values, row_count, value_ids);
+  } else {
+    return _build_partition_by_sorting(values, row_count, value_ids);
+  }
+}
+
+template <typename T>
+std::vector<T> DictionaryBuilder<T>::_build_sorted_partition(const T* values, const size_t row_count,
+                                                             ValueID* value_ids) {
+  auto dictionary = std::vector<T>{};
+  for (auto row = size_t{0}; row < row_count; ++row) {
+    if (row == 0 || values[row - 1] < values[row]) {
+      dictionary.push_back(values[row]);
+    }
+    value_ids[row] = ValueID{static_cast<ValueID::base_type>(dictionary.size() - 1)};
+  }
+  dictionary.shrink_to_fit();
+  return dictionary;
+}
+
+template <typename T>
+std::vector<T> DictionaryBuilder<T>::_build_partition_by_sorting(const T* values, const size_t row_count,
+                                                                 ValueID* value_ids) {
+  // Sort the values together with their positions. Afterwards, equal values are adjacent and we know for each of them
+  // where its ValueID has to be written to.
+  auto sorted_rows = std::vector<std::pair<T, ChunkOffset>>{};
+  sorted_rows.reserve(row_count);
+  for (auto row = size_t{0}; row < row_count; ++row) {
+    sorted_rows.emplace_back(values[row], static_cast<ChunkOffset>(row));
+  }
+  std::sort(sorted_rows.begin(), sorted_rows.end(),
+            [](const auto& left, const auto& right) { return left.first < right.first; });
+
+  auto dictionary = std::vector<T>{};
+  for (const auto& [value, row] : sorted_rows) {
+    if (dictionary.empty() || dictionary.back() < value) {
+      dictionary.push_back(value);
+    }
+    value_ids[row] = ValueID{static_cast<ValueID::base_type>(dictionary.size() - 1)};
+  }
+  dictionary.shrink_to_fit();
+  return dictionary;
+}
+
+template <typename T>
+std::vector<T> DictionaryBuilder<T>::_build_partition_by_hashing(const T* values, const size_t row_count,
+                                                                 ValueID* value_ids) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    // Assign preliminary ids in the order in which the distinct values first occur. The views point into the input,
+    // so no string is copied until the dictionary is materialized.
+    auto preliminary_ids = std::unordered_map<std::string_view, ValueID>{};
+    auto distinct_values = std::vector<std::string_view>{};
+    for (auto row = size_t{0}; row < row_count; ++row) {
+      const auto preliminary_id = ValueID{static_cast<ValueID::base_type>(distinct_values.size())};
+      const auto& [iterator, inserted] = preliminary_ids.try_emplace(values[row], preliminary_id);
+      if (inserted) {
+        distinct_values.push_back(values[row]);
+      }
+      value_ids[row] = iterator->second;
+    }
+
+    // Sort only the distinct values and translate the preliminary ids into their sorted positions.
+    auto sorted_order = std::vector<ValueID>(distinct_values.size());
+    std::iota(sorted_order.begin(), sorted_order.end(), ValueID{0});
+    std::sort(sorted_order.begin(), sorted_order.end(), [&](const ValueID left, const ValueID right) {
+      return distinct_values[left] < distinct_values[right];
+    });
+
+    auto dictionary = std::vector<T>{};
+    dictionary.reserve(distinct_values.size());
+    auto final_ids = std::vector<ValueID>(distinct_values.size());
+    for (const auto preliminary_id : sorted_order) {
+      final_ids[preliminary_id] = ValueID{static_cast<ValueID::base_type>(dictionary.size())};
+      dictionary.emplace_back(distinct_values[preliminary_id]);
+    }
+
+    for (auto row = size_t{0}; row < row_count; ++row) {
+      value_ids[row] = final_ids[value_ids[row]];
+    }
+    return dictionary;
+  } else {
+    Fail("Hash-based dictionary encoding is only used for strings");
+  }
+}
+
+template <typename T>
+std::vector<T> DictionaryBuilder<T>::_merge_dictionaries(const std::vector<std::vector<T>>& partition_dictionaries) {
+  auto total_size = size_t{0};
+  for (const auto& partition_dictionary : partition_dictionaries) {
+    total_size += partition_dictionary.size();
+  }
+
+  auto dictionary = std::vector<T>{};
+  dictionary.reserve(total_size);
+  for (const auto& partition_dictionary : partition_dictionaries) {
+    const auto merged_size = dictionary.size();
+    dictionary.insert(dictionary.end(), partition_dictionary.begin(), partition_dictionary.end());
+    std::inplace_merge(dictionary.begin(), dictionary.begin() + merged_size, dictionary.end());
+  }
+  dictionary.erase(std::unique(dictionary.begin(), dictionary.end()), dictionary.end());
+  dictionary.shrink_to_fit();
+  return dictionary;
+}
+
+template <typename T>
+void DictionaryBuilder<T>::_translate_value_ids(const std::vector<T>& partition_dictionary,
+                                                const std::vector<T>& dictionary, ValueID* value_ids,
+                                                const size_t row_count) {
+  // Both dictionaries are sorted and the merged dictionary contains all partition values, so a single merge-like walk
+  // finds the merged position of every partition value.
+  auto translation = std::vector<ValueID>{};
+  translation.reserve(partition_dictionary.size());
+  auto position = size_t{0};
+  for (const auto& value : partition_dictionary) {
+    while (dictionary[position] < value) ++position;
+    translation.push_back(ValueID{static_cast<ValueID::base_type>(position)});
+  }
+
+  for (auto row = size_t{0}; row < row_count; ++row) {
+    value_ids[row] = translation[value_ids[row]];
+  }
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(DictionaryBuilder);
+
+}  // namespace opossum
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <span>
+#include <thread>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// The result of a DictionaryBuilder: the sorted, distinct values and, for every input row, the position of its value
+// in the dictionary.
+template <typename T>
+struct BuiltDictionary {
+  std::vector<T> dictionary;
+  std::vector<ValueID> value_ids;
+};
+
+// DictionaryBuilder encodes the values of a segment into a sorted dictionary and one ValueID per row.
+//
+// Numeric values are sorted together with their row ids, so that the ValueIDs can be assigned in the same pass that
+// removes the duplicates. Strings are deduplicated through a hash map first so that only the distinct values have to
+// be sorted. Already sorted input is detected and encoded in a single pass.
+//
+// Large inputs are split into at most max_thread_count partitions of at least min_rows_per_thread rows that are encoded
+// in parallel by the CurrentScheduler. The partition dictionaries are merged afterwards and the partition-local
+// ValueIDs are translated to the merged dictionary, again in parallel.
+template <typename T>
+class DictionaryBuilder {
+ public:
+  static constexpr auto DEFAULT_MIN_ROWS_PER_THREAD = size_t{1} << 20;
+
+  explicit DictionaryBuilder(const size_t max_thread_count = std::thread::hardware_concurrency(),
+                             const size_t min_rows_per_thread = DEFAULT_MIN_ROWS_PER_THREAD);
+
+  BuiltDictionary<T> build(const std::span<const T> values) const;
+
+ protected:
+  const size_t _max_thread_count;
+  const size_t _min_rows_per_thread;
+
+  // Encodes row_count values, writes their partition-local ValueIDs, and returns the partition's dictionary.
+  static std::vector<T> _build_partition(const T* values, const size_t row_count, ValueID* value_ids);
+  static std::vector<T> _build_sorted_partition(const T* values, const size_t row_count, ValueID* value_ids);
+  static std::vector<T> _build_partition_by_sorting(const T* values, const size_t row_count, ValueID* value_ids);
+  static std::vector<T> _build_partition_by_hashing(const T* values, const size_t row_count, ValueID* value_ids);
+
+  static std::vector<T> _merge_dictionaries(const std::vector<std::vector<T>>& partition_dictionaries);
+  static void _translate_value_ids(const std::vector<T>& partition_dictionary, const std::vector<T>& dictionary,
+                                   ValueID* value_ids, const size_t row_count);
+};
+
+}  // namespace opossum
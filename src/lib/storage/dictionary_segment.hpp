@@ -3,15 +3,26 @@
 #include <algorithm>
 #include <limits>
 #include <memory>
-#include <set>
+#include <memory_resource>
+#include <optional>
+#include <span>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "all_type_variant.hpp"
+#include "bit_packed_attribute_vector.hpp"
+#include "bloom_filter.hpp"
+#include "bound_search.hpp"
+#include "dictionary_builder.hpp"
 #include "fixed_size_attribute_vector.hpp"
+#include "front_coded_dictionary.hpp"
 #include "type_cast.hpp"
 #include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/hash.hpp"
+#include "utils/memory_usage.hpp"
 #include "value_segment.hpp"
 
 namespace opossum {
@@ -24,22 +35,65 @@ class BaseSegment;
 constexpr ValueID INVALID_VALUE_ID{std::numeric_limits<ValueID::base_type>::max()};
 
 // Dictionary is a specific segment type that stores all its values in a vector
+// for strings, the dictionary is a FrontCodedDictionary, which stores all values in a single buffer
 template <typename T>
 class DictionarySegment : public BaseSegment {
  public:
+  using Dictionary = std::conditional_t<std::is_same_v<T, std::string>, FrontCodedDictionary, std::span<const T>>;
+
   /**
-   * Creates a Dictionary segment from a given value segment.
+   * Creates a Dictionary segment from a given value segment. With a false-positive rate, a Bloom filter of the
+   * dictionary values is built, which rules out most equality predicates on values that the segment does not contain.
+   * With a memory resource, e.g., the MonotonicArena of a chunk, the dictionary and the attribute vector are allocated
+   * from it. The segment and its attribute vector keep the resource alive.
    */
-  explicit DictionarySegment(const std::shared_ptr<BaseSegment>& baseSegment) {
+  explicit DictionarySegment(const std::shared_ptr<BaseSegment>& baseSegment,
+                             const std::optional<double> bloom_filter_false_positive_rate = std::nullopt,
+                             std::shared_ptr<std::pmr::memory_resource> memory_resource = nullptr)
+      : _memory_resource{std::move(memory_resource)},
+        _owned_dictionary{_resource()},
+        _dictionary{_empty_dictionary(_resource())} {
     auto valueSegment = std::static_pointer_cast<ValueSegment<T>>(baseSegment);
-    _build_compressed_dictionary(valueSegment->values());
+    _build_compressed_dictionary(valueSegment->values(), bloom_filter_false_positive_rate);
+  }
+
+  /**
+   * Creates a Dictionary segment from an already encoded dictionary and attribute vector, e.g., when loading a table.
+   */
+  DictionarySegment(pmr_vector<T>&& dictionary, std::shared_ptr<BaseAttributeVector> attribute_vector,
+                    std::shared_ptr<const BloomFilter> bloom_filter = nullptr)
+      : _owned_dictionary{std::move(dictionary)},
+        _attribute_vector{std::move(attribute_vector)},
+        _bloom_filter{std::move(bloom_filter)} {
+    _set_dictionary();
+  }
+
+  /**
+   * Creates a Dictionary segment whose dictionary is stored in memory owned by another object, e.g., a memory-mapped
+   * file, which is kept alive as long as the segment. The dictionary is not copied. For strings, the front-coded
+   * dictionary owns its memory and owner may be empty.
+   */
+  DictionarySegment(Dictionary dictionary, std::shared_ptr<const void> owner,
+                    std::shared_ptr<BaseAttributeVector> attribute_vector,
+                    std::shared_ptr<const BloomFilter> bloom_filter = nullptr)
+      : _dictionary{std::move(dictionary)},
+        _owner{std::move(owner)},
+        _attribute_vector{std::move(attribute_vector)},
+        _bloom_filter{std::move(bloom_filter)} {
+    if constexpr (!std::is_same_v<T, std::string>) {
+      _bound_search = std::make_unique<const BoundSearch<T>>(_dictionary.data(), _dictionary.size());
+    }
   }
 
   // SEMINAR INFORMATION: Since most of these methods depend on the template parameter, you will have to implement
   // the DictionarySegment in this file. Replace the method signatures with actual implementations.
 
   // return the value represented by a given ValueID
-  const T& value_by_value_id(ValueID value_id) const { return _dictionary->at(value_id); }
+  // numbers are returned by reference, strings are decoded and returned by value
+  decltype(auto) value_by_value_id(ValueID value_id) const {
+    DebugAssert(value_id < _dictionary.size(), "Value id exceeds the dictionary");
+    return _dictionary[value_id];
+  }
 
   // return the value at a certain position. If you want to write efficient operators, back off!
   AllTypeVariant operator[](const ChunkOffset chunk_offset) const {
@@ -55,22 +109,27 @@ class DictionarySegment : public BaseSegment {
   }
 
   // returns an underlying dictionary
-  std::shared_ptr<const std::vector<T>> dictionary() { return _dictionary; }
+  const Dictionary& dictionary() const { return _dictionary; }
 
   // returns an underlying data structure
   std::shared_ptr<BaseAttributeVector> attribute_vector() const { return _attribute_vector; }
 
+  // returns the Bloom filter of the dictionary values, or nullptr if the segment has none
+  const std::shared_ptr<const BloomFilter>& bloom_filter() const { return _bloom_filter; }
+
+  // returns false if the segment certainly does not contain the value, which is only known with a Bloom filter
+  bool may_contain(const T& value) const {
+    return !_bloom_filter || _bloom_filter->may_contain(mixed_hash(value));
+  }
+
   // returns the first value ID that refers to a value >= the search value
   // returns INVALID_VALUE_ID if all values are smaller than the search value
   ValueID lower_bound(T value) const {
-    auto dictionary_size = _dictionary->size();
-    for (ValueID dictionary_index = ValueID{0}; dictionary_index < dictionary_size; ++dictionary_index) {
-      if (value_by_value_id(dictionary_index) >= value) {
-        return dictionary_index;
-      }
+    if constexpr (std::is_same_v<T, std::string>) {
+      return _to_value_id(_dictionary.lower_bound(value));
+    } else {
+      return _to_value_id(_bound_search->lower_bound(value));
     }
-
-    return INVALID_VALUE_ID;
   }
 
   // same as lower_bound(T), but accepts an AllTypeVariant
@@ -79,65 +138,155 @@ class DictionarySegment : public BaseSegment {
   // returns the first value ID that refers to a value > the search value
   // returns INVALID_VALUE_ID if all values are smaller than or equal to the search value
   ValueID upper_bound(T value) const {
-    auto dictionary_size = _dictionary->size();
-    for (ValueID dictionary_index = ValueID{0}; dictionary_index < dictionary_size; ++dictionary_index) {
-      if (value_by_value_id(dictionary_index) > value) {
-        return dictionary_index;
-      }
+    if constexpr (std::is_same_v<T, std::string>) {
+      return _to_value_id(_dictionary.upper_bound(value));
+    } else {
+      return _to_value_id(_bound_search->upper_bound(value));
     }
-
-    return INVALID_VALUE_ID;
   }
 
   // same as upper_bound(T), but accepts an AllTypeVariant
   ValueID upper_bound(const AllTypeVariant& value) const { return upper_bound(static_cast<T>(value)); }
 
   // return the number of _dictionary (dictionary entries)
-  size_t unique_values_count() const { return _dictionary->size(); }
+  size_t unique_values_count() const { return _dictionary.size(); }
 
   // return the number of entries
   ChunkOffset size() const { return _attribute_vector->size(); }
 
   // returns the calculated memory usage
   size_t estimate_memory_usage() const final {
-    auto attributeVecMem = _attribute_vector->width() * _attribute_vector->size();
-    auto dictionaryVecMem = _dictionary->size() * sizeof(T);
-    return static_cast<size_t>(attributeVecMem + dictionaryVecMem);
+    auto attributeVecMem = _attribute_vector->estimate_memory_usage();
+    if (_bloom_filter) attributeVecMem += _bloom_filter->estimate_memory_usage();
+    if constexpr (std::is_same_v<T, std::string>) {
+      return attributeVecMem + _dictionary.estimate_memory_usage();
+    } else {
+      auto dictionaryVecMem = _dictionary.size() * sizeof(T);
+      auto boundSearchMem = _bound_search->estimate_memory_usage();
+      return static_cast<size_t>(attributeVecMem + dictionaryVecMem + boundSearchMem);
+    }
+  }
+
+  // returns the memory actually allocated for the segment, including the attribute vector, the bound search, the
+  // Bloom filter, and their shared pointer control blocks (see BaseSegment::memory_usage)
+  size_t memory_usage() const final {
+    // Attribute vectors allocated from a memory resource have a deleter that keeps the resource alive.
+    const auto attribute_vector_control_block_size =
+        _memory_resource ? separate_shared_pointer_control_block_size<std::shared_ptr<std::pmr::memory_resource>>()
+                         : SHARED_POINTER_CONTROL_BLOCK_SIZE;
+    auto allocated_bytes = sizeof(*this) + _attribute_vector->memory_usage() + attribute_vector_control_block_size;
+    if (_bloom_filter) {
+      allocated_bytes += sizeof(BloomFilter) + _bloom_filter->heap_memory_usage() + SHARED_POINTER_CONTROL_BLOCK_SIZE;
+    }
+    if constexpr (std::is_same_v<T, std::string>) {
+      return allocated_bytes + _dictionary.heap_memory_usage();
+    } else {
+      return allocated_bytes + heap_memory_usage(_owned_dictionary) + sizeof(BoundSearch<T>) +
+             _bound_search->heap_memory_usage();
+    }
   }
 
  protected:
-  std::shared_ptr<std::vector<T>> _dictionary;
+  // the resource that the dictionary and the attribute vector are allocated from, or nullptr for the default heap
+  // declared first, so that it is destroyed after everything that is allocated from it
+  std::shared_ptr<std::pmr::memory_resource> _memory_resource;
+  // the dictionary, unless it is stored in memory owned by _owner. All reads go through _dictionary.
+  // empty for strings, whose _dictionary owns its memory
+  pmr_vector<T> _owned_dictionary;
+  Dictionary _dictionary;
+  std::shared_ptr<const void> _owner;
   std::shared_ptr<BaseAttributeVector> _attribute_vector;
+  // the front-coded dictionary of strings searches its blocks itself
+  std::unique_ptr<const BoundSearch<T>> _bound_search;
+  std::shared_ptr<const BloomFilter> _bloom_filter;
 
-  void _build_compressed_dictionary(const std::vector<T>& values) {
-    auto raw_dictionary_vector = std::move(values);
-    std::vector<T> raw_values = raw_dictionary_vector;
-
-    std::set<T> s(raw_dictionary_vector.begin(), raw_dictionary_vector.end());
-    raw_dictionary_vector.assign(s.begin(), s.end());
+  ValueID _to_value_id(const size_t dictionary_position) const {
+    if (dictionary_position == _dictionary.size()) return INVALID_VALUE_ID;
+    return ValueID{static_cast<ValueID::base_type>(dictionary_position)};
+  }
 
-    _dictionary = std::make_shared<std::vector<T>>(raw_dictionary_vector);
+  std::pmr::memory_resource* _resource() const {
+    return _memory_resource ? _memory_resource.get() : std::pmr::get_default_resource();
+  }
 
-    _build_attribute_vector(raw_dictionary_vector, raw_values);
+  // returns an empty dictionary that the built one can be moved to without leaving the memory resource
+  static Dictionary _empty_dictionary(std::pmr::memory_resource* memory_resource) {
+    if constexpr (std::is_same_v<T, std::string>) {
+      return FrontCodedDictionary{memory_resource};
+    } else {
+      return {};
+    }
   }
 
-  void _build_attribute_vector(std::vector<T>& raw_dictionary, std::vector<T>& all_values) {
-    size_t size = all_values.size();
+  void _build_compressed_dictionary(const std::span<const T> values,
+                                    const std::optional<double> bloom_filter_false_positive_rate) {
+    auto built_dictionary = DictionaryBuilder<T>{}.build(values);
+    if (bloom_filter_false_positive_rate) {
+      auto bloom_filter =
+          std::make_shared<BloomFilter>(built_dictionary.dictionary.size(), *bloom_filter_false_positive_rate);
+      for (const auto& value : built_dictionary.dictionary) {
+        bloom_filter->insert(mixed_hash(value));
+      }
+      _bloom_filter = std::move(bloom_filter);
+    }
+    if constexpr (std::is_same_v<T, std::string>) {
+      _dictionary = FrontCodedDictionary{built_dictionary.dictionary, _resource()};
+    } else {
+      // The dictionary is copied once, so that the memory resource only holds its final size.
+      _owned_dictionary.assign(built_dictionary.dictionary.begin(), built_dictionary.dictionary.end());
+      _set_dictionary();
+    }
+    _build_attribute_vector(built_dictionary.value_ids);
+  }
 
-    if (size < std::numeric_limits<uint8_t>::max()) {
-      _attribute_vector = std::make_shared<FixedSizeAttributeVector<uint8_t>>(size);
-    } else if (size < std::numeric_limits<uint16_t>::max()) {
-      _attribute_vector = std::make_shared<FixedSizeAttributeVector<uint16_t>>(size);
+  // makes _owned_dictionary the dictionary of the segment
+  void _set_dictionary() {
+    if constexpr (std::is_same_v<T, std::string>) {
+      _dictionary = FrontCodedDictionary{_owned_dictionary, _resource()};
+      _owned_dictionary = pmr_vector<T>{_resource()};
     } else {
-      _attribute_vector = std::make_shared<FixedSizeAttributeVector<uint32_t>>(size);
+      _dictionary = _owned_dictionary;
+      _bound_search = std::make_unique<const BoundSearch<T>>(_dictionary.data(), _dictionary.size());
+    }
+  }
+
+  // The width of the attribute vector is chosen based on the number of distinct values. If it matches a fixed-size
+  // integer type, a FixedSizeAttributeVector is used, since it can be read without shifting and masking.
+  void _build_attribute_vector(const std::vector<ValueID>& value_ids) {
+    const auto width = BitPackedAttributeVector::required_width(_dictionary.size());
+    switch (width) {
+      case 8:
+        _attribute_vector = _build_fixed_size_attribute_vector<uint8_t>(value_ids);
+        break;
+      case 16:
+        _attribute_vector = _build_fixed_size_attribute_vector<uint16_t>(value_ids);
+        break;
+      case 32:
+        _attribute_vector = _build_fixed_size_attribute_vector<uint32_t>(value_ids);
+        break;
+      default:
+        _attribute_vector = _make_attribute_vector<BitPackedAttributeVector>(value_ids, width);
     }
+  }
 
-    for (size_t all_values_index = 0; all_values_index < size; all_values_index++) {
-      const auto value = type_cast<T>(all_values[all_values_index]);
-      auto dictionary_iterator = std::lower_bound(raw_dictionary.begin(), raw_dictionary.end(), value);
-      uint32_t dictionary_index = std::distance(raw_dictionary.begin(), dictionary_iterator);
-      _attribute_vector->set(all_values_index, static_cast<ValueID>(dictionary_index));
+  template <typename AttributeType>
+  std::shared_ptr<BaseAttributeVector> _build_fixed_size_attribute_vector(const std::vector<ValueID>& value_ids) const {
+    const auto size = value_ids.size();
+    auto attribute_vector = _make_attribute_vector<FixedSizeAttributeVector<AttributeType>>(size);
+    for (auto row = size_t{0}; row < size; ++row) {
+      attribute_vector->set(row, value_ids[row]);
     }
+    return attribute_vector;
+  }
+
+  // allocates an attribute vector from the memory resource of the segment. As the attribute vector may outlive the
+  // segment, it keeps the resource alive as well.
+  template <typename AttributeVector, typename... Arguments>
+  std::shared_ptr<AttributeVector> _make_attribute_vector(Arguments&&... arguments) const {
+    if (!_memory_resource) return std::make_shared<AttributeVector>(std::forward<Arguments>(arguments)...);
+    return std::shared_ptr<AttributeVector>(
+        new AttributeVector(std::forward<Arguments>(arguments)..., _memory_resource.get()),
+        [memory_resource = _memory_resource](const AttributeVector* attribute_vector) { delete attribute_vector; });
   }
 };
 
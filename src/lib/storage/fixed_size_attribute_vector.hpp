@@ -1,18 +1,35 @@
 #pragma once
 
+#include <algorithm>
+#include <memory>
+#include <memory_resource>
+#include <span>
+#include <utility>
 #include <vector>
 
 #include "base_attribute_vector.hpp"
 #include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "utils/memory_usage.hpp"
 
 namespace opossum {
 
 template <typename T>
 class FixedSizeAttributeVector : public BaseAttributeVector {
  public:
-  explicit FixedSizeAttributeVector(size_t attribute_vector_size) {
-    _attributes = std::vector<T>(attribute_vector_size);
-  }
+  // the value ids are allocated from the given memory resource, which has to outlive the vector
+  explicit FixedSizeAttributeVector(size_t attribute_vector_size,
+                                    std::pmr::memory_resource* memory_resource = std::pmr::get_default_resource())
+      : _attributes(attribute_vector_size, memory_resource), _values{_attributes} {}
+
+  // creates a vector holding the given value ids
+  explicit FixedSizeAttributeVector(pmr_vector<T>&& attributes)
+      : _attributes(std::move(attributes)), _values{_attributes} {}
+
+  // creates a read-only vector whose value ids are stored in memory owned by another object, e.g., a memory-mapped
+  // file, which is kept alive as long as the vector
+  FixedSizeAttributeVector(const std::span<const T> attributes, std::shared_ptr<const void> owner)
+      : _values{attributes}, _owner{std::move(owner)} {}
 
   ~FixedSizeAttributeVector() = default;
 
@@ -22,18 +39,42 @@ class FixedSizeAttributeVector : public BaseAttributeVector {
   FixedSizeAttributeVector& operator=(FixedSizeAttributeVector&&) = default;
 
   // returns the value id at a given position
-  ValueID get(const size_t i) const { return static_cast<ValueID>(_attributes.at(i)); }
+  ValueID get(const size_t i) const {
+    DebugAssert(i < _values.size(), "Position exceeds the attribute vector");
+    return static_cast<ValueID>(_values[i]);
+  }
+
+  // writes the value ids at the positions [begin, begin + length) to output
+  void decode(const size_t begin, const size_t length, ValueID* output) const {
+    DebugAssert(begin + length <= _values.size(), "Decoded range exceeds the attribute vector");
+    std::copy_n(_values.begin() + begin, length, output);
+  }
 
   // sets the value id at a given position
-  void set(const size_t index, const ValueID value_id) { _attributes.at(index) = static_cast<T>(value_id); }
+  void set(const size_t index, const ValueID value_id) {
+    Assert(!_owner, "Attribute vectors in memory owned by other objects are read-only");
+    _attributes.at(index) = static_cast<T>(value_id);
+  }
+
+  // returns all value ids in their fixed-size representation, e.g., for iterating without bounds checks
+  std::span<const T> values() const { return _values; }
 
   // returns the number of values
-  size_t size() const { return _attributes.size(); }
+  size_t size() const { return _values.size(); }
+
+  // returns the number of bits used to store a single value id
+  AttributeVectorWidth width() const { return static_cast<AttributeVectorWidth>(sizeof(T) * 8); }
+
+  // returns the calculated memory usage
+  size_t estimate_memory_usage() const { return std::max(_attributes.capacity(), _values.size()) * sizeof(T); }
 
-  // returns the width of biggest value id in bytes
-  AttributeVectorWidth width() const { return static_cast<AttributeVectorWidth>(sizeof(T)); }
+  // returns the memory allocated for the vector, without value ids in memory owned by other objects
+  size_t memory_usage() const { return sizeof(*this) + heap_memory_usage(_attributes); }
 
  private:
-  std::vector<T> _attributes = {};
+  // the value ids, unless they are stored in memory owned by _owner
+  pmr_vector<T> _attributes = {};
+  std::span<const T> _values;
+  std::shared_ptr<const void> _owner;
 };
 }  // namespace opossum
@@ -0,0 +1,248 @@
+#include "frame_of_reference_segment.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+#include "utils/memory_usage.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Extracts the offset at position Index of a group. All shifts and word offsets are compile-time constants.
+template <typename Offset, AttributeVectorWidth Width, size_t Index>
+inline Offset extract(const uint64_t* words) {
+  if constexpr (Width == 0) {
+    return 0;
+  } else {
+    constexpr auto first_bit = Index * Width;
+    constexpr auto word = first_bit / 64;
+    constexpr auto shift = first_bit % 64;
+    constexpr auto mask = Width == 64 ? ~uint64_t{0} : (uint64_t{1} << Width) - 1;
+
+    auto value = words[word] >> shift;
+    if constexpr (shift + Width > 64) {
+      value |= words[word + 1] << (64 - shift);
+    }
+    return static_cast<Offset>(value & mask);
+  }
+}
+
+// Decodes a full group of GROUP_SIZE offsets. The fold expression unrolls the loop so that the compiler can vectorize
+// the independent shift-and-mask operations.
+template <typename Offset, AttributeVectorWidth Width, size_t... Indices>
+void decode_group(const uint64_t* words, Offset* output, std::index_sequence<Indices...>) {
+  ((output[Indices] = extract<Offset, Width, Indices>(words)), ...);
+}
+
+template <typename Offset, AttributeVectorWidth Width>
+void decode_group(const uint64_t* words, Offset* output) {
+  decode_group<Offset, Width>(words, output, std::make_index_sequence<64>{});
+}
+
+template <typename Offset, size_t... Widths>
+constexpr auto make_group_decoders(std::index_sequence<Widths...>) {
+  return std::array<void (*)(const uint64_t*, Offset*), sizeof...(Widths)>{
+      &decode_group<Offset, static_cast<AttributeVectorWidth>(Widths)>...};
+}
+
+// Decoders for the widths 0 to the number of bits of Offset, the decoder for width w is stored at position w.
+template <typename Offset>
+constexpr auto group_decoders = make_group_decoders<Offset>(std::make_index_sequence<sizeof(Offset) * 8 + 1>{});
+
+}  // namespace
+
+template <typename T>
+FrameOfReferenceSegment<T>::FrameOfReferenceSegment(const std::shared_ptr<BaseSegment>& base_segment) {
+  const auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(base_segment);
+  Assert(value_segment, "FrameOfReferenceSegments can only be created from ValueSegments of the same type");
+
+  const auto& values = value_segment->values();
+  _size = static_cast<ChunkOffset>(values.size());
+  const auto frame_count = (size_t{_size} + FRAME_SIZE - 1) / FRAME_SIZE;
+  _minima.reserve(frame_count);
+  _widths.reserve(frame_count);
+
+  for (auto frame = size_t{0}; frame < frame_count; ++frame) {
+    const auto frame_begin = values.begin() + frame * FRAME_SIZE;
+    const auto frame_end = values.begin() + std::min(size_t{_size}, (frame + 1) * FRAME_SIZE);
+    const auto [minimum, maximum] = std::minmax_element(frame_begin, frame_end);
+    _minima.push_back(*minimum);
+    const auto largest_offset = static_cast<Offset>(static_cast<Offset>(*maximum) - static_cast<Offset>(*minimum));
+    _widths.push_back(static_cast<AttributeVectorWidth>(std::bit_width(largest_offset)));
+  }
+  _words.resize(_initialize_frame_word_begins());
+
+  // Fill the words sequentially, so that every word is written only once.
+  for (auto frame = size_t{0}; frame < frame_count; ++frame) {
+    const auto width = _widths[frame];
+    if (width == 0) continue;
+
+    const auto minimum = static_cast<Offset>(_minima[frame]);
+    const auto frame_begin = static_cast<ChunkOffset>(frame * FRAME_SIZE);
+    const auto frame_end = std::min(frame_begin + FRAME_SIZE, _size);
+    auto* const words = _words.data() + _frame_word_begins[frame];
+    auto bit = size_t{0};
+    for (auto chunk_offset = frame_begin; chunk_offset < frame_end; ++chunk_offset) {
+      const auto offset = uint64_t{static_cast<Offset>(static_cast<Offset>(values[chunk_offset]) - minimum)};
+      const auto word = bit / 64;
+      const auto shift = bit % 64;
+      words[word] |= offset << shift;
+      if (shift + width > 64) {
+        words[word + 1] |= offset >> (64 - shift);
+      }
+      bit += width;
+    }
+  }
+}
+
+template <typename T>
+FrameOfReferenceSegment<T>::FrameOfReferenceSegment(std::vector<T>&& minima,
+                                                    std::vector<AttributeVectorWidth>&& widths,
+                                                    std::vector<uint64_t>&& words, const ChunkOffset size)
+    : _size{size}, _minima{std::move(minima)}, _widths{std::move(widths)} {
+  Assert(_minima.size() == (size_t{_size} + FRAME_SIZE - 1) / FRAME_SIZE, "Number of frames does not match the size");
+  Assert(_widths.size() == _minima.size(), "Every frame needs a minimum and a width");
+  Assert(std::all_of(_widths.begin(), _widths.end(), [](const auto width) { return width <= sizeof(Offset) * 8; }),
+         "Offsets must not be wider than the values");
+  Assert(_initialize_frame_word_begins() == words.size(),
+         "Number of words does not match the sizes and widths of the frames");
+  _words = std::move(words);
+}
+
+template <typename T>
+AllTypeVariant FrameOfReferenceSegment<T>::operator[](const ChunkOffset chunk_offset) const {
+  Assert(chunk_offset < _size, "Position is out of range");
+  return get(chunk_offset);
+}
+
+template <typename T>
+void FrameOfReferenceSegment<T>::decode(const ChunkOffset begin, const ChunkOffset length, T* output) const {
+  DebugAssert(begin + length <= _size, "Decoded range exceeds the segment");
+  const auto end = begin + length;
+
+  auto frame_begin = begin;
+  while (frame_begin < end) {
+    const auto frame_end = std::min((frame_begin / FRAME_SIZE + 1) * FRAME_SIZE, end);
+    // Decode the offsets in place. Accessing T through its unsigned type is allowed by the aliasing rules.
+    auto* const frame_output = reinterpret_cast<Offset*>(output + (frame_begin - begin));
+    decode_offsets(frame_begin, frame_end - frame_begin, frame_output);
+
+    const auto minimum = static_cast<Offset>(_minima[frame_begin / FRAME_SIZE]);
+    for (auto index = ChunkOffset{0}; index < frame_end - frame_begin; ++index) {
+      frame_output[index] += minimum;
+    }
+    frame_begin = frame_end;
+  }
+}
+
+template <typename T>
+void FrameOfReferenceSegment<T>::decode_offsets(const ChunkOffset begin, const ChunkOffset length,
+                                                Offset* output) const {
+  DebugAssert(begin + length <= _size, "Decoded range exceeds the segment");
+  DebugAssert(length == 0 || begin / FRAME_SIZE == (begin + length - 1) / FRAME_SIZE, "Range must lie in one frame");
+  if (length == 0) return;
+
+  const auto frame = begin / FRAME_SIZE;
+  const auto width = _widths[frame];
+  if (width == 0) {
+    std::fill_n(output, length, Offset{0});
+    return;
+  }
+
+  const auto end = begin + length;
+  // Decode single offsets up to the first group boundary, then whole groups, then the remaining offsets. Frames start
+  // at group boundaries, as FRAME_SIZE is a multiple of GROUP_SIZE.
+  const auto first_group_begin = std::min((begin + GROUP_SIZE - 1) / GROUP_SIZE * GROUP_SIZE, end);
+  const auto last_group_end = std::max(end / GROUP_SIZE * GROUP_SIZE, first_group_begin);
+  const auto decode_group = group_decoders<Offset>[width];
+  const auto* const frame_words = _words.data() + _frame_word_begins[frame];
+
+  auto position = begin;
+  for (; position < first_group_begin; ++position) {
+    *output++ = offset(position);
+  }
+  for (; position < last_group_end; position += GROUP_SIZE) {
+    decode_group(frame_words + (position % FRAME_SIZE) / GROUP_SIZE * width, output);
+    output += GROUP_SIZE;
+  }
+  for (; position < end; ++position) {
+    *output++ = offset(position);
+  }
+}
+
+template <typename T>
+void FrameOfReferenceSegment<T>::append(const AllTypeVariant& val) {
+  throw std::runtime_error("Frame-of-reference segments are immutable. You shall not append anything.");
+}
+
+template <typename T>
+ChunkOffset FrameOfReferenceSegment<T>::size() const {
+  return _size;
+}
+
+template <typename T>
+size_t FrameOfReferenceSegment<T>::frame_count() const {
+  return _minima.size();
+}
+
+template <typename T>
+const std::vector<T>& FrameOfReferenceSegment<T>::minima() const {
+  return _minima;
+}
+
+template <typename T>
+const std::vector<AttributeVectorWidth>& FrameOfReferenceSegment<T>::widths() const {
+  return _widths;
+}
+
+template <typename T>
+typename FrameOfReferenceSegment<T>::Offset FrameOfReferenceSegment<T>::max_offset(const size_t frame) const {
+  return static_cast<Offset>(_mask(_widths[frame]));
+}
+
+template <typename T>
+const std::vector<uint64_t>& FrameOfReferenceSegment<T>::words() const {
+  return _words;
+}
+
+template <typename T>
+size_t FrameOfReferenceSegment<T>::estimate_memory_usage() const {
+  return _minima.size() * sizeof(T) + _widths.size() * sizeof(AttributeVectorWidth) +
+         _frame_word_begins.size() * sizeof(size_t) + _words.size() * sizeof(uint64_t);
+}
+
+template <typename T>
+size_t FrameOfReferenceSegment<T>::memory_usage() const {
+  return sizeof(*this) + heap_memory_usage(_minima) + heap_memory_usage(_widths) +
+         heap_memory_usage(_frame_word_begins) + heap_memory_usage(_words);
+}
+
+template <typename T>
+size_t FrameOfReferenceSegment<T>::_word_count(const ChunkOffset count, const AttributeVectorWidth width) {
+  return (size_t{count} * width + 63) / 64;
+}
+
+template <typename T>
+size_t FrameOfReferenceSegment<T>::_initialize_frame_word_begins() {
+  _frame_word_begins.resize(_minima.size());
+  auto word_count = size_t{0};
+  for (auto frame = size_t{0}; frame < _minima.size(); ++frame) {
+    _frame_word_begins[frame] = word_count;
+    const auto frame_begin = static_cast<ChunkOffset>(frame * FRAME_SIZE);
+    word_count += _word_count(std::min(FRAME_SIZE, _size - frame_begin), _widths[frame]);
+  }
+  return word_count;
+}
+
+template class FrameOfReferenceSegment<int32_t>;
+template class FrameOfReferenceSegment<int64_t>;
+
+}  // namespace opossum
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "base_segment.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// frame-of-reference encoding is only implemented for the integer data types, i.e., int and long
+template <typename T>
+constexpr bool is_frame_of_reference_encodable_v = std::is_same_v<T, int32_t> || std::is_same_v<T, int64_t>;
+
+// FrameOfReferenceSegment is a segment type for integer columns whose values lie in narrow ranges but are mostly
+// distinct, e.g., timestamps or ids, for which a dictionary would be as large as the values themselves. The values are
+// split into frames of FRAME_SIZE values. Every frame stores its minimum and the offsets of its values from that
+// minimum, bit-packed with the smallest width that fits the largest offset of the frame.
+//
+// As in BitPackedAttributeVector, every group of GROUP_SIZE offsets starts at a word boundary and occupies exactly
+// width words, so that bulk reads decode whole groups with width-specific, unrolled code that the compiler vectorizes.
+template <typename T>
+class FrameOfReferenceSegment : public BaseSegment {
+  static_assert(is_frame_of_reference_encodable_v<T>, "Frame-of-reference encoding requires int or long values");
+
+ public:
+  // offsets from the minimum of a frame, which always fit into the unsigned type of the same size
+  using Offset = std::make_unsigned_t<T>;
+
+  // number of values that share a minimum and a width
+  static constexpr auto FRAME_SIZE = ChunkOffset{2048};
+
+  // number of offsets that are decoded together
+  static constexpr auto GROUP_SIZE = ChunkOffset{64};
+
+  // creates a frame-of-reference encoded segment from a given value segment
+  explicit FrameOfReferenceSegment(const std::shared_ptr<BaseSegment>& base_segment);
+
+  // creates a segment from already encoded frames, e.g., when loading a table
+  FrameOfReferenceSegment(std::vector<T>&& minima, std::vector<AttributeVectorWidth>&& widths,
+                          std::vector<uint64_t>&& words, const ChunkOffset size);
+
+  // return the value at a certain position. If you want to write efficient operators, back off!
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  // return the value at a certain position
+  T get(const ChunkOffset chunk_offset) const {
+    const auto minimum = static_cast<Offset>(_minima[chunk_offset / FRAME_SIZE]);
+    return static_cast<T>(static_cast<Offset>(minimum + offset(chunk_offset)));
+  }
+
+  // returns the offset of the value at a certain position from the minimum of its frame
+  Offset offset(const ChunkOffset chunk_offset) const {
+    DebugAssert(chunk_offset < _size, "Position is out of range");
+    const auto frame = chunk_offset / FRAME_SIZE;
+    const auto width = _widths[frame];
+    if (width == 0) return 0;
+
+    const auto bit = size_t{chunk_offset % FRAME_SIZE} * width;
+    const auto* const words = _words.data() + _frame_word_begins[frame] + bit / 64;
+    const auto shift = bit % 64;
+    auto value = words[0] >> shift;
+    if (shift + width > 64) {
+      value |= words[1] << (64 - shift);
+    }
+    return static_cast<Offset>(value & _mask(width));
+  }
+
+  // writes the values at the positions [begin, begin + length) to output
+  // this is the preferred method to read many values, as whole groups of offsets are decoded at once
+  void decode(const ChunkOffset begin, const ChunkOffset length, T* output) const;
+
+  // writes the offsets at the positions [begin, begin + length) to output, without adding the minimum of the frame
+  // the positions must lie in a single frame
+  void decode_offsets(const ChunkOffset begin, const ChunkOffset length, Offset* output) const;
+
+  // frame-of-reference segments are immutable
+  void append(const AllTypeVariant& val) final;
+
+  // return the number of entries
+  ChunkOffset size() const final;
+
+  // returns the number of frames
+  size_t frame_count() const;
+
+  // returns the minimum of every frame
+  const std::vector<T>& minima() const;
+
+  // returns the number of bits used to store an offset, for every frame
+  const std::vector<AttributeVectorWidth>& widths() const;
+
+  // returns the largest offset that the width of the frame can hold
+  // every value of the frame lies in [minimum, minimum + max_offset]
+  Offset max_offset(const size_t frame) const;
+
+  // returns the packed offsets of all frames, e.g., for persisting them
+  const std::vector<uint64_t>& words() const;
+
+  // returns the calculated memory usage, which reflects the packed size of the offsets
+  size_t estimate_memory_usage() const final;
+
+  size_t memory_usage() const final;
+
+ protected:
+  static uint64_t _mask(const AttributeVectorWidth width) {
+    return width == 64 ? std::numeric_limits<uint64_t>::max() : (uint64_t{1} << width) - 1;
+  }
+
+  // returns the number of words that count offsets of the given width occupy
+  static size_t _word_count(const ChunkOffset count, const AttributeVectorWidth width);
+
+  // computes the first word of every frame from the widths and returns the total number of words
+  size_t _initialize_frame_word_begins();
+
+  ChunkOffset _size;
+  std::vector<T> _minima;
+  std::vector<AttributeVectorWidth> _widths;
+  std::vector<size_t> _frame_word_begins;
+  std::vector<uint64_t> _words;
+};
+
+}  // namespace opossum
@@ -0,0 +1,305 @@
+#include "front_coded_dictionary.hpp"
+
+#include <algorithm>
+#include <memory_resource>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+#include "utils/memory_usage.hpp"
+
+namespace opossum {
+
+namespace {
+
+void append_varint(std::vector<char>& bytes, size_t value) {
+  while (value >= 0x80) {
+    bytes.push_back(static_cast<char>(value | 0x80));
+    value >>= 7;
+  }
+  bytes.push_back(static_cast<char>(value));
+}
+
+// Reads the varint at position and advances position past it
+size_t read_varint(const char*& position) {
+  auto value = size_t{0};
+  auto shift = 0;
+  while (static_cast<uint8_t>(*position) & 0x80) {
+    value |= size_t{static_cast<uint8_t>(*position++) & 0x7fu} << shift;
+    shift += 7;
+  }
+  value |= size_t{static_cast<uint8_t>(*position++)} << shift;
+  return value;
+}
+
+// Same as above, but fails instead of reading beyond end
+size_t read_checked_varint(const char*& position, const char* end) {
+  const auto* const varint_end =
+      std::find_if(position, end, [](const auto byte) { return !(static_cast<uint8_t>(byte) & 0x80); });
+  Assert(varint_end != end && varint_end - position < 10, "Invalid length in front-coded dictionary");
+  return read_varint(position);
+}
+
+// Below this size of the blocks, a symbol table could hardly save more memory than it takes.
+constexpr auto MIN_COMPRESSED_SIZE = size_t{4096};
+
+struct FrontCodedValue {
+  // number of characters shared with the previous value of the block
+  size_t prefix_length;
+  // the remaining characters that are stored
+  std::string_view characters;
+};
+
+std::vector<FrontCodedValue> front_code(const std::span<const std::string> values) {
+  auto front_coded_values = std::vector<FrontCodedValue>{};
+  front_coded_values.reserve(values.size());
+  for (auto position = size_t{0}; position < values.size(); ++position) {
+    const auto& value = values[position];
+    if (position % FrontCodedDictionary::BLOCK_SIZE == 0) {
+      front_coded_values.push_back({0, value});
+      continue;
+    }
+
+    const auto& previous = values[position - 1];
+    DebugAssert(previous < value, "Values of a dictionary must be sorted and distinct");
+    const auto prefix_length =
+        static_cast<size_t>(std::mismatch(previous.begin(), previous.end(), value.begin(), value.end()).first -
+                            previous.begin());
+    front_coded_values.push_back({prefix_length, std::string_view{value}.substr(prefix_length)});
+  }
+  return front_coded_values;
+}
+
+// Writes the blocks of the values, with their characters compressed if the symbol table is not empty
+void encode(const std::vector<FrontCodedValue>& front_coded_values, const FsstSymbolTable& symbol_table,
+            std::vector<char>& bytes, std::vector<uint64_t>& block_offsets) {
+  block_offsets.reserve((front_coded_values.size() + FrontCodedDictionary::BLOCK_SIZE - 1) /
+                        FrontCodedDictionary::BLOCK_SIZE);
+  auto compressed_characters = std::vector<uint8_t>{};
+  for (auto position = size_t{0}; position < front_coded_values.size(); ++position) {
+    const auto& [prefix_length, characters] = front_coded_values[position];
+    if (position % FrontCodedDictionary::BLOCK_SIZE == 0) {
+      block_offsets.push_back(bytes.size());
+    } else {
+      append_varint(bytes, prefix_length);
+    }
+
+    if (symbol_table.symbol_count() == 0) {
+      append_varint(bytes, characters.size());
+      bytes.insert(bytes.end(), characters.begin(), characters.end());
+    } else {
+      compressed_characters.clear();
+      symbol_table.compress(characters, compressed_characters);
+      append_varint(bytes, compressed_characters.size());
+      bytes.insert(bytes.end(), compressed_characters.begin(), compressed_characters.end());
+    }
+  }
+}
+
+}  // namespace
+
+FrontCodedDictionary::FrontCodedDictionary(std::pmr::memory_resource* memory_resource)
+    : _bytes{memory_resource}, _block_offsets{memory_resource} {}
+
+FrontCodedDictionary::FrontCodedDictionary(const std::span<const std::string> values,
+                                           std::pmr::memory_resource* memory_resource)
+    : _bytes{memory_resource}, _block_offsets{memory_resource}, _size{values.size()} {
+  // The blocks are encoded on the heap and copied to the memory resource once their size is known, as an arena would
+  // keep every outgrown buffer.
+  const auto front_coded_values = front_code(values);
+  auto bytes = std::vector<char>{};
+  auto block_offsets = std::vector<uint64_t>{};
+  encode(front_coded_values, _symbol_table, bytes, block_offsets);
+  if (bytes.size() < MIN_COMPRESSED_SIZE) {
+    _bytes.assign(bytes.begin(), bytes.end());
+    _block_offsets.assign(block_offsets.begin(), block_offsets.end());
+    return;
+  }
+
+  // Build a symbol table for the characters that are actually stored and keep the compressed blocks if they are
+  // smaller, including the symbol table.
+  auto characters = std::vector<std::string_view>{};
+  characters.reserve(_size);
+  for (const auto& front_coded_value : front_coded_values) {
+    characters.push_back(front_coded_value.characters);
+  }
+  auto symbol_table = FsstSymbolTable::build(characters);
+  auto compressed_bytes = std::vector<char>{};
+  auto compressed_block_offsets = std::vector<uint64_t>{};
+  encode(front_coded_values, symbol_table, compressed_bytes, compressed_block_offsets);
+  if (compressed_bytes.size() + symbol_table.estimate_memory_usage() < bytes.size()) {
+    bytes = std::move(compressed_bytes);
+    block_offsets = std::move(compressed_block_offsets);
+    _symbol_table = std::move(symbol_table);
+  }
+  _bytes.assign(bytes.begin(), bytes.end());
+  _block_offsets.assign(block_offsets.begin(), block_offsets.end());
+}
+
+FrontCodedDictionary::FrontCodedDictionary(pmr_vector<char>&& bytes, pmr_vector<uint64_t>&& block_offsets,
+                                           const size_t size, FsstSymbolTable&& symbol_table)
+    : _bytes{std::move(bytes)},
+      _block_offsets{std::move(block_offsets)},
+      _size{size},
+      _symbol_table{std::move(symbol_table)} {
+  Assert(_block_offsets.size() == (_size + BLOCK_SIZE - 1) / BLOCK_SIZE, "Number of blocks does not match the size");
+
+  // Decode all strings with bounds checks, so that reading them later can never go beyond the buffer.
+  auto value = std::string{};
+  auto previous = std::string{};
+  auto buffer = std::string{};
+  for (auto block = size_t{0}; block < _block_offsets.size(); ++block) {
+    const auto block_end = block + 1 < _block_offsets.size() ? _block_offsets[block + 1] : _bytes.size();
+    Assert(_block_offsets[block] <= block_end && block_end <= _bytes.size(), "Invalid block offsets");
+
+    const auto* position = _bytes.data() + _block_offsets[block];
+    const auto* const end = _bytes.data() + block_end;
+    const auto block_size = std::min(BLOCK_SIZE, _size - block * BLOCK_SIZE);
+    for (auto index = size_t{0}; index < block_size; ++index) {
+      const auto prefix_length = index == 0 ? size_t{0} : read_checked_varint(position, end);
+      Assert(prefix_length <= value.size(), "Shared prefix is longer than the previous string");
+      const auto stored_length = read_checked_varint(position, end);
+      Assert(stored_length <= static_cast<size_t>(end - position), "String exceeds its block");
+      if (is_compressed()) {
+        _symbol_table.validate({reinterpret_cast<const uint8_t*>(position), stored_length});
+      }
+      value.resize(prefix_length);
+      value.append(_read_characters(position, stored_length, buffer));
+
+      Assert((block == 0 && index == 0) || previous < value, "Values of a dictionary must be sorted and distinct");
+      previous = value;
+    }
+    Assert(position == end, "Blocks of the front-coded dictionary contain more bytes than strings");
+  }
+}
+
+std::string FrontCodedDictionary::operator[](const size_t position) const {
+  auto value = std::string{};
+  get(position, value);
+  return value;
+}
+
+void FrontCodedDictionary::get(const size_t position, std::string& value) const {
+  DebugAssert(position < _size, "Position exceeds the dictionary");
+  auto buffer = std::string{};
+  const auto* data = _bytes.data() + _block_offsets[position / BLOCK_SIZE];
+  const auto length = read_varint(data);
+  value = _read_characters(data, length, buffer);
+
+  for (auto index = size_t{0}; index < position % BLOCK_SIZE; ++index) {
+    const auto prefix_length = read_varint(data);
+    const auto stored_length = read_varint(data);
+    value.resize(prefix_length);
+    value.append(_read_characters(data, stored_length, buffer));
+  }
+}
+
+size_t FrontCodedDictionary::lower_bound(const std::string_view value) const {
+  return _bound<false>(value);
+}
+
+size_t FrontCodedDictionary::upper_bound(const std::string_view value) const {
+  return _bound<true>(value);
+}
+
+template <bool Upper>
+size_t FrontCodedDictionary::_bound(const std::string_view value) const {
+  // lower_bound searches for the first string that is not smaller than value, upper_bound for the first greater one
+  const auto before_bound = [](const int comparison) { return Upper ? comparison <= 0 : comparison < 0; };
+
+  // Find the first block whose first string is not before the bound. The bound lies in the block before.
+  auto buffer = std::string{};
+  auto low = size_t{0};
+  auto high = _block_offsets.size();
+  while (low < high) {
+    const auto middle = low + (high - low) / 2;
+    if (before_bound(_block_first_value(middle, buffer).compare(value))) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+  if (low == 0) return 0;
+
+  // The strings of the block are compared without assembling them. Only the number of characters that the current
+  // string shares with value (matched) and their order are tracked. A string that shares more characters with its
+  // predecessor than matched compares like its predecessor. One that shares fewer is greater than value, as it is
+  // greater than its predecessor.
+  const auto block = low - 1;
+  const auto block_begin = block * BLOCK_SIZE;
+  const auto block_size = std::min(BLOCK_SIZE, _size - block_begin);
+  const auto* data = _bytes.data() + _block_offsets[block];
+  const auto first_value_length = read_varint(data);
+  const auto first_value = _read_characters(data, first_value_length, buffer);
+  auto matched = static_cast<size_t>(
+      std::mismatch(first_value.begin(), first_value.end(), value.begin(), value.end()).first - first_value.begin());
+  auto comparison = first_value.compare(value);
+  for (auto index = size_t{1}; index < block_size; ++index) {
+    const auto prefix_length = read_varint(data);
+    const auto stored_length = read_varint(data);
+    const auto suffix = _read_characters(data, stored_length, buffer);
+
+    if (prefix_length < matched) return block_begin + index;
+    if (prefix_length == matched) {
+      const auto remainder = value.substr(matched);
+      const auto mismatch = static_cast<size_t>(
+          std::mismatch(suffix.begin(), suffix.end(), remainder.begin(), remainder.end()).first - suffix.begin());
+      matched += mismatch;
+      comparison = suffix.substr(mismatch).compare(remainder.substr(mismatch));
+    }
+    if (!before_bound(comparison)) return block_begin + index;
+  }
+  return block_begin + block_size;
+}
+
+size_t FrontCodedDictionary::size() const {
+  return _size;
+}
+
+const pmr_vector<char>& FrontCodedDictionary::bytes() const {
+  return _bytes;
+}
+
+const pmr_vector<uint64_t>& FrontCodedDictionary::block_offsets() const {
+  return _block_offsets;
+}
+
+bool FrontCodedDictionary::is_compressed() const {
+  return _symbol_table.symbol_count() > 0;
+}
+
+const FsstSymbolTable& FrontCodedDictionary::symbol_table() const {
+  return _symbol_table;
+}
+
+size_t FrontCodedDictionary::estimate_memory_usage() const {
+  const auto symbol_table_memory = is_compressed() ? _symbol_table.estimate_memory_usage() : size_t{0};
+  return _bytes.size() * sizeof(char) + _block_offsets.size() * sizeof(uint64_t) + symbol_table_memory;
+}
+
+size_t FrontCodedDictionary::heap_memory_usage() const {
+  return opossum::heap_memory_usage(_bytes) + opossum::heap_memory_usage(_block_offsets) +
+         _symbol_table.heap_memory_usage();
+}
+
+std::string_view FrontCodedDictionary::_read_characters(const char*& data, const size_t length,
+                                                        std::string& buffer) const {
+  const auto* const begin = data;
+  data += length;
+  if (!is_compressed()) return {begin, length};
+
+  buffer.clear();
+  _symbol_table.decompress({reinterpret_cast<const uint8_t*>(begin), length}, buffer);
+  return buffer;
+}
+
+std::string_view FrontCodedDictionary::_block_first_value(const size_t block, std::string& buffer) const {
+  const auto* data = _bytes.data() + _block_offsets[block];
+  const auto length = read_varint(data);
+  return _read_characters(data, length, buffer);
+}
+
+}  // namespace opossum
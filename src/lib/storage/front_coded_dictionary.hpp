@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "fsst_symbol_table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// FrontCodedDictionary is the dictionary of string DictionarySegments. It stores sorted, distinct strings in a single
+// contiguous buffer instead of one std::string (32 bytes, plus a heap allocation for long strings) per entry.
+//
+// The strings are split into blocks of BLOCK_SIZE. The first string of a block is stored completely, as its length
+// followed by its characters. Every following string only stores the length of the prefix it shares with its
+// predecessor, the length of the remaining suffix, and the suffix characters. All lengths are varints. The position of
+// every block in the buffer is kept in an offset array, so that reading a string decodes at most one block, and bound
+// searches compare the first strings of the blocks in place before decoding a single block.
+//
+// If it saves memory, the characters (i.e., first strings and suffixes) are additionally compressed with an
+// FsstSymbolTable. Then, the stored lengths of the first strings and suffixes count compressed bytes, while the prefix
+// lengths still count characters.
+class FrontCodedDictionary {
+ public:
+  // number of strings per block
+  static constexpr auto BLOCK_SIZE = size_t{16};
+
+  // creates an empty dictionary whose blocks will be allocated from the given memory resource when it is assigned to
+  explicit FrontCodedDictionary(std::pmr::memory_resource* memory_resource = std::pmr::get_default_resource());
+
+  // creates a dictionary from strictly increasing strings
+  // the blocks are allocated from the given memory resource, which has to outlive the dictionary
+  explicit FrontCodedDictionary(const std::span<const std::string> values,
+                                std::pmr::memory_resource* memory_resource = std::pmr::get_default_resource());
+
+  // creates a dictionary from already encoded blocks, e.g., when loading a table
+  // an empty symbol table means that the characters are not compressed
+  // the blocks are decoded once to validate them
+  FrontCodedDictionary(pmr_vector<char>&& bytes, pmr_vector<uint64_t>&& block_offsets, const size_t size,
+                       FsstSymbolTable&& symbol_table = {});
+
+  // returns the string at a certain position
+  std::string operator[](const size_t position) const;
+
+  // writes the string at a certain position to value, reusing its memory
+  void get(const size_t position, std::string& value) const;
+
+  // returns the position of the first string >= the search value, or size() if there is none
+  size_t lower_bound(const std::string_view value) const;
+
+  // returns the position of the first string > the search value, or size() if there is none
+  size_t upper_bound(const std::string_view value) const;
+
+  // returns the number of strings
+  size_t size() const;
+
+  // returns whether the characters are compressed with symbol_table()
+  bool is_compressed() const;
+
+  // returns the symbol table of the characters, which is empty if they are not compressed
+  const FsstSymbolTable& symbol_table() const;
+
+  // returns the encoded blocks, e.g., for persisting them
+  const pmr_vector<char>& bytes() const;
+
+  // returns the position of every block in bytes()
+  const pmr_vector<uint64_t>& block_offsets() const;
+
+  // returns the size of the buffer, the offset array, and the symbol table
+  size_t estimate_memory_usage() const;
+
+  // returns the memory allocated for the buffer, the offset array, and the symbol table, i.e., without the dictionary
+  // object itself
+  size_t heap_memory_usage() const;
+
+ protected:
+  // reads length stored bytes at data and advances data past them. Returns the characters they hold, which are
+  // decompressed into buffer if the dictionary is compressed.
+  std::string_view _read_characters(const char*& data, const size_t length, std::string& buffer) const;
+
+  // returns the first string of a block, which is only copied to buffer if the dictionary is compressed
+  std::string_view _block_first_value(const size_t block, std::string& buffer) const;
+
+  // implements lower_bound and upper_bound
+  template <bool Upper>
+  size_t _bound(const std::string_view value) const;
+
+  pmr_vector<char> _bytes;
+  pmr_vector<uint64_t> _block_offsets;
+  size_t _size = 0;
+  FsstSymbolTable _symbol_table;
+};
+
+}  // namespace opossum
@@ -0,0 +1,91 @@
+#include "fsst_segment.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+#include "utils/memory_usage.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+FsstSegment::FsstSegment(const std::shared_ptr<BaseSegment>& base_segment) {
+  const auto value_segment = std::dynamic_pointer_cast<ValueSegment<std::string>>(base_segment);
+  Assert(value_segment, "FsstSegments can only be created from string ValueSegments");
+
+  const auto& values = value_segment->values();
+  _symbol_table = FsstSymbolTable::build(std::vector<std::string_view>{values.begin(), values.end()});
+  _offsets.reserve(values.size() + 1);
+  _offsets.push_back(0);
+  for (const auto& value : values) {
+    _symbol_table.compress(value, _bytes);
+    Assert(_bytes.size() <= std::numeric_limits<uint32_t>::max(), "Compressed values of a segment exceed 4 GB");
+    _offsets.push_back(static_cast<uint32_t>(_bytes.size()));
+  }
+  _bytes.shrink_to_fit();
+}
+
+FsstSegment::FsstSegment(FsstSymbolTable&& symbol_table, std::vector<uint8_t>&& bytes,
+                         std::vector<uint32_t>&& offsets)
+    : _symbol_table{std::move(symbol_table)}, _bytes{std::move(bytes)}, _offsets{std::move(offsets)} {
+  Assert(!_offsets.empty() && _offsets.front() == 0 && _offsets.back() == _bytes.size(),
+         "Offsets must cover all compressed bytes");
+  Assert(std::is_sorted(_offsets.begin(), _offsets.end()), "Offsets must not decrease");
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < size(); ++chunk_offset) {
+    _symbol_table.validate(compressed_value(chunk_offset));
+  }
+}
+
+AllTypeVariant FsstSegment::operator[](const ChunkOffset chunk_offset) const {
+  Assert(chunk_offset < size(), "Position is out of range");
+  return get(chunk_offset);
+}
+
+std::string FsstSegment::get(const ChunkOffset chunk_offset) const {
+  auto value = std::string{};
+  get(chunk_offset, value);
+  return value;
+}
+
+std::vector<uint8_t> FsstSegment::compress(const std::string_view value) const {
+  auto compressed_value = std::vector<uint8_t>{};
+  _symbol_table.compress(value, compressed_value);
+  return compressed_value;
+}
+
+void FsstSegment::append(const AllTypeVariant& val) {
+  throw std::runtime_error("FSST segments are immutable. You shall not append anything.");
+}
+
+ChunkOffset FsstSegment::size() const {
+  return static_cast<ChunkOffset>(_offsets.size() - 1);
+}
+
+const FsstSymbolTable& FsstSegment::symbol_table() const {
+  return _symbol_table;
+}
+
+const std::vector<uint8_t>& FsstSegment::bytes() const {
+  return _bytes;
+}
+
+const std::vector<uint32_t>& FsstSegment::offsets() const {
+  return _offsets;
+}
+
+size_t FsstSegment::estimate_memory_usage() const {
+  return _symbol_table.estimate_memory_usage() + _bytes.size() * sizeof(uint8_t) +
+         _offsets.size() * sizeof(uint32_t);
+}
+
+size_t FsstSegment::memory_usage() const {
+  return sizeof(*this) + _symbol_table.heap_memory_usage() + heap_memory_usage(_bytes) + heap_memory_usage(_offsets);
+}
+
+}  // namespace opossum
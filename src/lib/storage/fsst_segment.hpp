@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "base_segment.hpp"
+#include "fsst_symbol_table.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// FsstSegment is a segment type for string columns with many distinct values, e.g., URLs or user agents, for which a
+// dictionary hardly saves memory. Every value is compressed on its own with a symbol table that is built for the
+// segment (see FsstSymbolTable). The compressed values are stored back to back in a single buffer, the offset array
+// marks where every value begins.
+class FsstSegment : public BaseSegment {
+ public:
+  // creates a compressed segment from a given string value segment
+  explicit FsstSegment(const std::shared_ptr<BaseSegment>& base_segment);
+
+  // creates a segment from already compressed values, e.g., when loading a table
+  // offsets holds the begin of every value plus the end of the last one
+  FsstSegment(FsstSymbolTable&& symbol_table, std::vector<uint8_t>&& bytes, std::vector<uint32_t>&& offsets);
+
+  // return the value at a certain position. If you want to write efficient operators, back off!
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  // return the value at a certain position
+  std::string get(const ChunkOffset chunk_offset) const;
+
+  // writes the value at a certain position to value, reusing its memory
+  void get(const ChunkOffset chunk_offset, std::string& value) const {
+    value.clear();
+    _symbol_table.decompress(compressed_value(chunk_offset), value);
+  }
+
+  // returns the compressed bytes of the value at a certain position
+  std::span<const uint8_t> compressed_value(const ChunkOffset chunk_offset) const {
+    DebugAssert(chunk_offset < size(), "Position is out of range");
+    return {_bytes.data() + _offsets[chunk_offset], _bytes.data() + _offsets[chunk_offset + 1]};
+  }
+
+  // compresses a value with the symbol table of this segment
+  // two values are equal if and only if their compressed bytes are equal
+  std::vector<uint8_t> compress(const std::string_view value) const;
+
+  // FSST segments are immutable
+  void append(const AllTypeVariant& val) final;
+
+  // return the number of entries
+  ChunkOffset size() const final;
+
+  // returns the symbol table that the values are compressed with
+  const FsstSymbolTable& symbol_table() const;
+
+  // returns the compressed values
+  const std::vector<uint8_t>& bytes() const;
+
+  // returns the begin of every value in bytes() and the end of the last one
+  const std::vector<uint32_t>& offsets() const;
+
+  // returns the calculated memory usage
+  size_t estimate_memory_usage() const final;
+
+  size_t memory_usage() const final;
+
+ protected:
+  FsstSymbolTable _symbol_table;
+  std::vector<uint8_t> _bytes;
+  std::vector<uint32_t> _offsets;
+};
+
+}  // namespace opossum
@@ -0,0 +1,224 @@
+#include "fsst_symbol_table.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+#include "utils/memory_usage.hpp"
+
+namespace opossum {
+
+namespace {
+
+// number of rounds in which the symbol table is refined
+constexpr auto GENERATION_COUNT = 5;
+
+// While building, the bytes of the sample are split into symbols of the current table (ids 0 to 254) and escaped bytes
+// (id 256 + byte).
+constexpr auto ID_COUNT = size_t{512};
+
+struct Symbol {
+  uint64_t word;
+  uint8_t length;
+};
+
+uint64_t concatenate(const Symbol& first, const Symbol& second) {
+  auto word = first.word;
+  const auto second_length = std::min<size_t>(second.length, FsstSymbolTable::MAX_SYMBOL_LENGTH - first.length);
+  std::memcpy(reinterpret_cast<char*>(&word) + first.length, &second.word, second_length);
+  return word;
+}
+
+}  // namespace
+
+FsstSymbolTable::FsstSymbolTable() : FsstSymbolTable{{}, {}} {}
+
+FsstSymbolTable::FsstSymbolTable(std::vector<uint64_t>&& symbols, std::vector<uint8_t>&& symbol_lengths)
+    : _symbols{std::move(symbols)}, _symbol_lengths{std::move(symbol_lengths)} {
+  Assert(_symbols.size() == _symbol_lengths.size(), "Every symbol needs a length");
+  Assert(_symbols.size() <= MAX_SYMBOL_COUNT, "Too many symbols");
+
+  // Count the symbols per first byte. As the symbols are sorted, the codes of every first byte are consecutive.
+  auto previous_first_byte = 0;
+  for (auto code = size_t{0}; code < _symbols.size(); ++code) {
+    const auto length = _symbol_lengths[code];
+    Assert(length >= 1 && length <= MAX_SYMBOL_LENGTH, "Invalid symbol length");
+    const auto first_byte = static_cast<int>(*reinterpret_cast<const uint8_t*>(&_symbols[code]));
+    Assert(first_byte > previous_first_byte ||
+               (first_byte == previous_first_byte && (code == 0 || length <= _symbol_lengths[code - 1])),
+           "Symbols must be sorted by their first byte and by decreasing length");
+    previous_first_byte = first_byte;
+    ++_first_byte_begins[first_byte + 1];
+  }
+  for (auto byte = size_t{1}; byte < _first_byte_begins.size(); ++byte) {
+    _first_byte_begins[byte] += _first_byte_begins[byte - 1];
+  }
+}
+
+FsstSymbolTable FsstSymbolTable::build(const std::vector<std::string_view>& values) {
+  // Take every n-th value, so that the sample covers all values with about SAMPLE_SIZE bytes.
+  auto total_size = size_t{0};
+  for (const auto& value : values) {
+    total_size += value.size();
+  }
+  const auto stride = std::max(size_t{1}, total_size / SAMPLE_SIZE);
+  auto sample = std::vector<std::string_view>{};
+  auto sample_size = size_t{0};
+  for (auto index = size_t{0}; index < values.size() && sample_size < SAMPLE_SIZE; index += stride) {
+    sample.push_back(values[index].substr(0, SAMPLE_SIZE));
+    sample_size += sample.back().size();
+  }
+
+  // In every generation, the sample is compressed with the current table. The symbols, escaped bytes, and
+  // concatenations of two consecutive ones that would have saved the most bytes form the next table.
+  auto table = FsstSymbolTable{};
+  auto counts = std::vector<uint32_t>(ID_COUNT);
+  auto pair_counts = std::vector<uint32_t>(ID_COUNT * ID_COUNT);
+  for (auto generation = 0; generation < GENERATION_COUNT; ++generation) {
+    std::fill(counts.begin(), counts.end(), 0);
+    std::fill(pair_counts.begin(), pair_counts.end(), 0);
+    const auto symbol_of = [&](const size_t id) {
+      if (id < ESCAPE_CODE) return Symbol{table._symbols[id], table._symbol_lengths[id]};
+      const auto byte = static_cast<uint8_t>(id - 256);
+      auto word = uint64_t{0};
+      std::memcpy(&word, &byte, 1);
+      return Symbol{word, 1};
+    };
+
+    for (const auto& value : sample) {
+      const auto* position = value.data();
+      const auto* const end = value.data() + value.size();
+      auto previous_id = ID_COUNT;
+      while (position < end) {
+        const auto code = table._find_code(position, end);
+        const auto id = code == ESCAPE_CODE ? 256 + static_cast<uint8_t>(*position) : size_t{code};
+        ++counts[id];
+        if (previous_id != ID_COUNT) ++pair_counts[previous_id * ID_COUNT + id];
+        previous_id = id;
+        position += symbol_of(id).length;
+      }
+    }
+
+    // The gain of a candidate is the number of bytes it would have covered in the sample.
+    auto gains = std::map<std::pair<uint64_t, uint8_t>, size_t>{};
+    for (auto id = size_t{0}; id < ID_COUNT; ++id) {
+      if (counts[id] == 0) continue;
+      const auto symbol = symbol_of(id);
+      gains[{symbol.word, symbol.length}] += size_t{counts[id]} * symbol.length;
+
+      if (symbol.length == MAX_SYMBOL_LENGTH) continue;
+      for (auto next_id = size_t{0}; next_id < ID_COUNT; ++next_id) {
+        const auto pair_count = pair_counts[id * ID_COUNT + next_id];
+        if (pair_count == 0) continue;
+        const auto next_symbol = symbol_of(next_id);
+        const auto length =
+            static_cast<uint8_t>(std::min<size_t>(symbol.length + next_symbol.length, MAX_SYMBOL_LENGTH));
+        gains[{concatenate(symbol, next_symbol), length}] += size_t{pair_count} * length;
+      }
+    }
+
+    auto candidates = std::vector<std::pair<size_t, std::pair<uint64_t, uint8_t>>>{};
+    candidates.reserve(gains.size());
+    for (const auto& [symbol, gain] : gains) {
+      candidates.emplace_back(gain, symbol);
+    }
+    const auto symbol_count = std::min(MAX_SYMBOL_COUNT, candidates.size());
+    std::partial_sort(candidates.begin(), candidates.begin() + static_cast<std::ptrdiff_t>(symbol_count),
+                      candidates.end(), [](const auto& lhs, const auto& rhs) { return lhs > rhs; });
+    candidates.resize(symbol_count);
+
+    std::sort(candidates.begin(), candidates.end(), [](const auto& lhs, const auto& rhs) {
+      const auto lhs_first_byte = *reinterpret_cast<const uint8_t*>(&lhs.second.first);
+      const auto rhs_first_byte = *reinterpret_cast<const uint8_t*>(&rhs.second.first);
+      if (lhs_first_byte != rhs_first_byte) return lhs_first_byte < rhs_first_byte;
+      return lhs.second.second > rhs.second.second;
+    });
+    auto symbols = std::vector<uint64_t>{};
+    auto symbol_lengths = std::vector<uint8_t>{};
+    for (const auto& [gain, symbol] : candidates) {
+      symbols.push_back(symbol.first);
+      symbol_lengths.push_back(symbol.second);
+    }
+    table = FsstSymbolTable{std::move(symbols), std::move(symbol_lengths)};
+  }
+  return table;
+}
+
+void FsstSymbolTable::compress(const std::string_view value, std::vector<uint8_t>& output) const {
+  const auto* position = value.data();
+  const auto* const end = value.data() + value.size();
+  while (position < end) {
+    const auto code = _find_code(position, end);
+    output.push_back(code);
+    if (code == ESCAPE_CODE) {
+      output.push_back(static_cast<uint8_t>(*position++));
+    } else {
+      position += _symbol_lengths[code];
+    }
+  }
+}
+
+void FsstSymbolTable::decompress(const std::span<const uint8_t> compressed_value, std::string& output) const {
+  // Every code writes MAX_SYMBOL_LENGTH bytes, of which only the length of the symbol are kept.
+  const auto previous_size = output.size();
+  output.resize(previous_size + compressed_value.size() * MAX_SYMBOL_LENGTH);
+  auto* output_position = output.data() + previous_size;
+
+  for (auto index = size_t{0}; index < compressed_value.size(); ++index) {
+    const auto code = compressed_value[index];
+    if (code == ESCAPE_CODE) {
+      *output_position++ = static_cast<char>(compressed_value[++index]);
+    } else {
+      std::memcpy(output_position, &_symbols[code], MAX_SYMBOL_LENGTH);
+      output_position += _symbol_lengths[code];
+    }
+  }
+  output.resize(static_cast<size_t>(output_position - output.data()));
+}
+
+void FsstSymbolTable::validate(const std::span<const uint8_t> compressed_value) const {
+  for (auto index = size_t{0}; index < compressed_value.size(); ++index) {
+    if (compressed_value[index] == ESCAPE_CODE) {
+      Assert(++index < compressed_value.size(), "Escape code without escaped byte");
+    } else {
+      Assert(compressed_value[index] < _symbols.size(), "Code without symbol");
+    }
+  }
+}
+
+size_t FsstSymbolTable::symbol_count() const {
+  return _symbols.size();
+}
+
+const std::vector<uint64_t>& FsstSymbolTable::symbols() const {
+  return _symbols;
+}
+
+const std::vector<uint8_t>& FsstSymbolTable::symbol_lengths() const {
+  return _symbol_lengths;
+}
+
+size_t FsstSymbolTable::estimate_memory_usage() const {
+  return _symbols.size() * sizeof(uint64_t) + _symbol_lengths.size() * sizeof(uint8_t) + sizeof(_first_byte_begins);
+}
+
+size_t FsstSymbolTable::heap_memory_usage() const {
+  return opossum::heap_memory_usage(_symbols) + opossum::heap_memory_usage(_symbol_lengths);
+}
+
+uint8_t FsstSymbolTable::_find_code(const char* begin, const char* end) const {
+  const auto first_byte = static_cast<uint8_t>(*begin);
+  const auto remaining = static_cast<size_t>(end - begin);
+  for (auto code = _first_byte_begins[first_byte]; code < _first_byte_begins[first_byte + 1]; ++code) {
+    const auto length = _symbol_lengths[code];
+    if (length <= remaining && std::memcmp(&_symbols[code], begin, length) == 0) return static_cast<uint8_t>(code);
+  }
+  return ESCAPE_CODE;
+}
+
+}  // namespace opossum
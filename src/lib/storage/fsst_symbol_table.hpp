@@ -0,0 +1,76 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace opossum {
+
+// FsstSymbolTable compresses strings in the style of FSST (Fast Static Symbol Table, Boncz et al., VLDB 2020). It maps
+// up to 255 frequent substrings (symbols) of one to eight bytes to one-byte codes. Bytes that are not covered by a
+// symbol are written as ESCAPE_CODE followed by the byte itself.
+//
+// Every value is compressed on its own, so that single values can be decompressed without touching their neighbours.
+// Decompression copies eight bytes per code and only advances by the length of the symbol, which needs neither
+// branches on the symbol length nor a loop per byte. Compression is deterministic, i.e., equal strings always result in
+// equal codes. Hence, equality predicates can be evaluated by compressing the search value once and comparing the
+// compressed bytes.
+class FsstSymbolTable {
+ public:
+  static constexpr auto MAX_SYMBOL_COUNT = size_t{255};
+  static constexpr auto MAX_SYMBOL_LENGTH = size_t{8};
+  static constexpr auto ESCAPE_CODE = uint8_t{255};
+
+  // maximum number of bytes of the values that the symbol table is built from
+  static constexpr auto SAMPLE_SIZE = size_t{1} << 14;
+
+  // creates an empty symbol table, which escapes every byte
+  FsstSymbolTable();
+
+  // creates a symbol table from symbols sorted by their first byte and then by decreasing length, e.g., as returned by
+  // symbols() and symbol_lengths() when loading a table
+  FsstSymbolTable(std::vector<uint64_t>&& symbols, std::vector<uint8_t>&& symbol_lengths);
+
+  // builds a symbol table for a sample of the values
+  static FsstSymbolTable build(const std::vector<std::string_view>& values);
+
+  // appends the compressed value to output
+  void compress(const std::string_view value, std::vector<uint8_t>& output) const;
+
+  // appends the decompressed value to output
+  void decompress(const std::span<const uint8_t> compressed_value, std::string& output) const;
+
+  // checks that compressed_value only consists of valid codes, e.g., before decompressing data from a file
+  void validate(const std::span<const uint8_t> compressed_value) const;
+
+  // returns the number of symbols
+  size_t symbol_count() const;
+
+  // returns the bytes of every symbol, stored in the first symbol_lengths() bytes of the word
+  const std::vector<uint64_t>& symbols() const;
+
+  // returns the length of every symbol
+  const std::vector<uint8_t>& symbol_lengths() const;
+
+  // returns the memory used by the symbols and the lookup table
+  size_t estimate_memory_usage() const;
+
+  // returns the memory allocated for the symbols, i.e., without the symbol table object itself
+  size_t heap_memory_usage() const;
+
+ protected:
+  // returns the code of the longest symbol that [begin, end) starts with, or ESCAPE_CODE if there is none
+  uint8_t _find_code(const char* begin, const char* end) const;
+
+  std::vector<uint64_t> _symbols;
+  std::vector<uint8_t> _symbol_lengths;
+
+  // the codes of the symbols starting with byte b are [_first_byte_begins[b], _first_byte_begins[b + 1])
+  std::array<uint16_t, 257> _first_byte_begins{};
+};
+
+}  // namespace opossum
@@ -0,0 +1,46 @@
+#include "reference_segment.hpp"
+
+#include <memory>
+
+#include "table.hpp"
+#include "utils/assert.hpp"
+#include "utils/memory_usage.hpp"
+
+namespace opossum {
+
+ReferenceSegment::ReferenceSegment(const std::shared_ptr<const Table>& referenced_table,
+                                   const ColumnID referenced_column_id, const std::shared_ptr<const PosList>& pos)
+    : _referenced_table{referenced_table}, _referenced_column_id{referenced_column_id}, _pos_list{pos} {
+  Assert(_referenced_table && _pos_list, "ReferenceSegment needs a referenced table and a position list");
+  Assert(_referenced_column_id < _referenced_table->column_count(), "Referenced column does not exist");
+  DebugAssert(_referenced_table->row_count() == 0 ||
+                  !std::dynamic_pointer_cast<const ReferenceSegment>(
+                      _referenced_table->get_chunk(ChunkID{0}).get_segment(_referenced_column_id)),
+              "ReferenceSegments must reference the table that holds the data, not another ReferenceSegment");
+}
+
+AllTypeVariant ReferenceSegment::operator[](const ChunkOffset chunk_offset) const {
+  const auto& row_id = _pos_list->at(chunk_offset);
+  const auto& segment = *_referenced_table->get_chunk(row_id.chunk_id).get_segment(_referenced_column_id);
+  return segment[row_id.chunk_offset];
+}
+
+void ReferenceSegment::append(const AllTypeVariant&) { Fail("ReferenceSegments are immutable"); }
+
+ChunkOffset ReferenceSegment::size() const { return static_cast<ChunkOffset>(_pos_list->size()); }
+
+const std::shared_ptr<const PosList>& ReferenceSegment::pos_list() const { return _pos_list; }
+
+const std::shared_ptr<const Table>& ReferenceSegment::referenced_table() const { return _referenced_table; }
+
+ColumnID ReferenceSegment::referenced_column_id() const { return _referenced_column_id; }
+
+size_t ReferenceSegment::estimate_memory_usage() const { return _pos_list->size() * sizeof(RowID); }
+
+size_t ReferenceSegment::memory_usage() const { return sizeof(*this); }
+
+size_t ReferenceSegment::pos_list_memory_usage() const {
+  return SHARED_POINTER_CONTROL_BLOCK_SIZE + sizeof(PosList) + heap_memory_usage(*_pos_list);
+}
+
+}  // namespace opossum
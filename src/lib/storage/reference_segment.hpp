@@ -0,0 +1,52 @@
+#pragma once
+
+#include <memory>
+
+#include "base_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+// ReferenceSegment is a specific segment type that stores all its values as positions in a segment of another table.
+// Operators that filter their input output ReferenceSegments instead of copying values (late materialization).
+// Usually, all ReferenceSegments of a chunk share the same position list.
+class ReferenceSegment : public BaseSegment {
+ public:
+  // creates a reference segment
+  // the parameters specify the positions and the referenced column
+  // the referenced table must hold the actual data, i.e., it must not consist of ReferenceSegments itself
+  ReferenceSegment(const std::shared_ptr<const Table>& referenced_table, const ColumnID referenced_column_id,
+                   const std::shared_ptr<const PosList>& pos);
+
+  // return the value at a certain position. If you want to write efficient operators, back off!
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const override;
+
+  // reference segments are immutable
+  void append(const AllTypeVariant&) override;
+
+  // return the number of referenced rows
+  ChunkOffset size() const override;
+
+  const std::shared_ptr<const PosList>& pos_list() const;
+  const std::shared_ptr<const Table>& referenced_table() const;
+  ColumnID referenced_column_id() const;
+
+  // returns the calculated memory usage, i.e., that of the (potentially shared) position list
+  size_t estimate_memory_usage() const final;
+
+  // returns the memory of the segment object without its position list, which is usually shared by the
+  // ReferenceSegments of all columns of a chunk and thus counted once per chunk (see Chunk::memory_usage)
+  size_t memory_usage() const final;
+
+  // returns the memory actually allocated for the position list, including its shared pointer control block
+  size_t pos_list_memory_usage() const;
+
+ protected:
+  const std::shared_ptr<const Table> _referenced_table;
+  const ColumnID _referenced_column_id;
+  const std::shared_ptr<const PosList> _pos_list;
+};
+
+}  // namespace opossum
@@ -0,0 +1,98 @@
+#include "run_length_segment.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+#include "utils/memory_usage.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+template <typename T>
+RunLengthSegment<T>::RunLengthSegment(const std::shared_ptr<BaseSegment>& base_segment) {
+  const auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(base_segment);
+  Assert(value_segment, "RunLengthSegments can only be created from ValueSegments of the same type");
+
+  const auto& values = value_segment->values();
+  const auto size = static_cast<ChunkOffset>(values.size());
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < size; ++chunk_offset) {
+    if (chunk_offset + 1 == size || values[chunk_offset + 1] != values[chunk_offset]) {
+      _values.push_back(values[chunk_offset]);
+      _end_positions.push_back(chunk_offset + 1);
+    }
+  }
+  _values.shrink_to_fit();
+  _end_positions.shrink_to_fit();
+}
+
+template <typename T>
+RunLengthSegment<T>::RunLengthSegment(std::vector<T>&& values, std::vector<ChunkOffset>&& end_positions)
+    : _values{std::move(values)}, _end_positions{std::move(end_positions)} {
+  Assert(_values.size() == _end_positions.size(), "Every run needs a value and an end position");
+  Assert(std::adjacent_find(_end_positions.begin(), _end_positions.end(), std::greater_equal<>{}) ==
+             _end_positions.end(),
+         "End positions of runs must be strictly increasing");
+  Assert(_end_positions.empty() || _end_positions.front() > 0, "Runs must not be empty");
+}
+
+template <typename T>
+AllTypeVariant RunLengthSegment<T>::operator[](const ChunkOffset chunk_offset) const {
+  Assert(chunk_offset < size(), "Position is out of range");
+  return get(chunk_offset);
+}
+
+template <typename T>
+const T& RunLengthSegment<T>::get(const ChunkOffset chunk_offset) const {
+  DebugAssert(chunk_offset < size(), "Position is out of range");
+  return _values[run_index(chunk_offset)];
+}
+
+template <typename T>
+void RunLengthSegment<T>::append(const AllTypeVariant& val) {
+  throw std::runtime_error("Run-length segments are immutable. You shall not append anything.");
+}
+
+template <typename T>
+ChunkOffset RunLengthSegment<T>::size() const {
+  return _end_positions.empty() ? ChunkOffset{0} : _end_positions.back();
+}
+
+template <typename T>
+const std::vector<T>& RunLengthSegment<T>::values() const {
+  return _values;
+}
+
+template <typename T>
+const std::vector<ChunkOffset>& RunLengthSegment<T>::end_positions() const {
+  return _end_positions;
+}
+
+template <typename T>
+size_t RunLengthSegment<T>::run_count() const {
+  return _values.size();
+}
+
+template <typename T>
+size_t RunLengthSegment<T>::run_index(const ChunkOffset chunk_offset) const {
+  return std::upper_bound(_end_positions.begin(), _end_positions.end(), chunk_offset) - _end_positions.begin();
+}
+
+template <typename T>
+size_t RunLengthSegment<T>::estimate_memory_usage() const {
+  return _values.size() * sizeof(T) + _end_positions.size() * sizeof(ChunkOffset);
+}
+
+template <typename T>
+size_t RunLengthSegment<T>::memory_usage() const {
+  return sizeof(*this) + heap_memory_usage(_values) + heap_memory_usage(_end_positions);
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(RunLengthSegment);
+
+}  // namespace opossum
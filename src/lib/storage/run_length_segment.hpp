@@ -0,0 +1,57 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "base_segment.hpp"
+
+namespace opossum {
+
+// RunLengthSegment is a segment type that stores runs of equal consecutive values once, together with the chunk
+// offset at which each run ends (exclusively). It suits sorted or clustered columns, e.g., dates or tenant ids, whose
+// values repeat over long ranges of rows.
+template <typename T>
+class RunLengthSegment : public BaseSegment {
+ public:
+  // creates a run-length encoded segment from a given value segment
+  explicit RunLengthSegment(const std::shared_ptr<BaseSegment>& base_segment);
+
+  // creates a segment from already encoded runs, e.g., when loading a table
+  // end_positions must be strictly increasing, the last one is the size of the segment
+  RunLengthSegment(std::vector<T>&& values, std::vector<ChunkOffset>&& end_positions);
+
+  // return the value at a certain position. If you want to write efficient operators, back off!
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  // return the value at a certain position, found by a binary search over the run ends
+  const T& get(const ChunkOffset chunk_offset) const;
+
+  // run-length segments are immutable
+  void append(const AllTypeVariant& val) final;
+
+  // return the number of entries
+  ChunkOffset size() const final;
+
+  // returns the value of every run
+  const std::vector<T>& values() const;
+
+  // returns the chunk offset after the last row of every run
+  const std::vector<ChunkOffset>& end_positions() const;
+
+  // returns the number of runs
+  size_t run_count() const;
+
+  // returns the index of the run that contains the chunk offset
+  size_t run_index(const ChunkOffset chunk_offset) const;
+
+  // returns the calculated memory usage
+  size_t estimate_memory_usage() const final;
+
+  size_t memory_usage() const final;
+
+ protected:
+  std::vector<T> _values;
+  std::vector<ChunkOffset> _end_positions;
+};
+
+}  // namespace opossum
@@ -0,0 +1,367 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <type_traits>
+
+#include "resolve_type.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// The value of a segment at a certain offset, as returned by the segment iterators. Numbers are copied, which is as
+// cheap as referencing them and allows accessors to return values that are decoded on the fly. Strings are not copied,
+// so a position must not be used after its iterator has been advanced.
+template <typename T>
+class SegmentPosition {
+ public:
+  SegmentPosition(const T& value, const ChunkOffset chunk_offset)
+      : _value{_store(value)}, _chunk_offset{chunk_offset} {}
+
+  const T& value() const {
+    if constexpr (std::is_arithmetic_v<T>) {
+      return _value;
+    } else {
+      return *_value;
+    }
+  }
+
+  ChunkOffset chunk_offset() const { return _chunk_offset; }
+
+ private:
+  static auto _store(const T& value) {
+    if constexpr (std::is_arithmetic_v<T>) {
+      return value;
+    } else {
+      return &value;
+    }
+  }
+
+  std::conditional_t<std::is_arithmetic_v<T>, T, const T*> _value;
+  ChunkOffset _chunk_offset;
+};
+
+namespace detail {
+
+// Accessors return the value at a chunk offset of a segment whose type is fully known at compile time.
+template <typename T>
+class ValueSegmentAccessor {
+ public:
+  explicit ValueSegmentAccessor(const ValueSegment<T>& segment) : _values{segment.values().data()} {}
+
+  const T& operator()(const ChunkOffset chunk_offset) const { return _values[chunk_offset]; }
+
+ private:
+  const T* _values;
+};
+
+template <typename AttributeVector>
+ValueID::base_type value_id_at(const AttributeVector& attribute_vector, const ChunkOffset chunk_offset) {
+  if constexpr (std::is_same_v<AttributeVector, BitPackedAttributeVector>) {
+    // get() is final, so this call is not virtual
+    return attribute_vector.get(chunk_offset);
+  } else {
+    return attribute_vector.values()[chunk_offset];
+  }
+}
+
+template <typename T, typename AttributeVector>
+class DictionarySegmentAccessor {
+ public:
+  DictionarySegmentAccessor(const DictionarySegment<T>& segment, const AttributeVector& attribute_vector)
+      : _dictionary{segment.dictionary().data()}, _attribute_vector{&attribute_vector} {}
+
+  const T& operator()(const ChunkOffset chunk_offset) const {
+    return _dictionary[value_id_at(*_attribute_vector, chunk_offset)];
+  }
+
+ private:
+  const T* _dictionary;
+  const AttributeVector* _attribute_vector;
+};
+
+// Strings are decoded from the front-coded dictionary into a buffer, which is only valid until the next access. The
+// buffer is kept per copy of the accessor, i.e., per iterator, and reused if the value id does not change.
+template <typename AttributeVector>
+class DictionarySegmentAccessor<std::string, AttributeVector> {
+ public:
+  DictionarySegmentAccessor(const DictionarySegment<std::string>& segment, const AttributeVector& attribute_vector)
+      : _dictionary{&segment.dictionary()}, _attribute_vector{&attribute_vector} {}
+
+  const std::string& operator()(const ChunkOffset chunk_offset) const {
+    const auto value_id = ValueID{value_id_at(*_attribute_vector, chunk_offset)};
+    if (value_id != _value_id) {
+      _dictionary->get(value_id, _value);
+      _value_id = value_id;
+    }
+    return _value;
+  }
+
+ private:
+  const FrontCodedDictionary* _dictionary;
+  const AttributeVector* _attribute_vector;
+  mutable ValueID _value_id = INVALID_VALUE_ID;
+  mutable std::string _value;
+};
+
+// Sequential and sorted point accesses mostly stay in the current run or move on to the next one, so the run is only
+// searched for when an access jumps further. The run is cached per copy of the accessor, i.e., per iterator.
+template <typename T>
+class RunLengthSegmentAccessor {
+ public:
+  explicit RunLengthSegmentAccessor(const RunLengthSegment<T>& segment)
+      : _values{segment.values().data()},
+        _end_positions{segment.end_positions().data()},
+        _run_count{segment.run_count()},
+        _run_end{_run_count > 0 ? _end_positions[0] : ChunkOffset{0}} {}
+
+  const T& operator()(const ChunkOffset chunk_offset) const {
+    if (chunk_offset < _run_begin || chunk_offset >= _run_end) _seek(chunk_offset);
+    return _values[_run_index];
+  }
+
+ private:
+  void _seek(const ChunkOffset chunk_offset) const {
+    if (chunk_offset >= _run_end && _run_index + 1 < _run_count && chunk_offset < _end_positions[_run_index + 1]) {
+      ++_run_index;
+    } else {
+      _run_index = std::upper_bound(_end_positions, _end_positions + _run_count, chunk_offset) - _end_positions;
+    }
+    _run_begin = _run_index > 0 ? _end_positions[_run_index - 1] : ChunkOffset{0};
+    _run_end = _end_positions[_run_index];
+  }
+
+  const T* _values;
+  const ChunkOffset* _end_positions;
+  size_t _run_count;
+  mutable size_t _run_index = 0;
+  mutable ChunkOffset _run_begin = 0;
+  mutable ChunkOffset _run_end;
+};
+
+// Decodes single values, which are returned by value
+template <typename T>
+class FrameOfReferenceSegmentAccessor {
+ public:
+  explicit FrameOfReferenceSegmentAccessor(const FrameOfReferenceSegment<T>& segment) : _segment{&segment} {}
+
+  T operator()(const ChunkOffset chunk_offset) const { return _segment->get(chunk_offset); }
+
+ private:
+  const FrameOfReferenceSegment<T>* _segment;
+};
+
+// Sequential accesses decode one delta each. Other accesses decode the block of the offset from its start. The
+// position in the block is cached per copy of the accessor, i.e., per iterator.
+template <typename T>
+class DeltaSegmentAccessor {
+ public:
+  explicit DeltaSegmentAccessor(const DeltaSegment<T>& segment) : _segment{&segment} {}
+
+  T operator()(const ChunkOffset chunk_offset) const {
+    if (chunk_offset + 1 == _next_offset) return _value;
+
+    if (chunk_offset == _next_offset && chunk_offset % DeltaSegment<T>::BLOCK_SIZE != 0) {
+      _value = DeltaSegment<T>::next_value(_position, _value);
+    } else {
+      const auto block = chunk_offset / DeltaSegment<T>::BLOCK_SIZE;
+      _position = _segment->bytes().data() + _segment->block_byte_offsets()[block];
+      _value = _segment->block_first_values()[block];
+      for (auto index = ChunkOffset{0}; index < chunk_offset % DeltaSegment<T>::BLOCK_SIZE; ++index) {
+        _value = DeltaSegment<T>::next_value(_position, _value);
+      }
+    }
+    _next_offset = chunk_offset + 1;
+    return _value;
+  }
+
+ private:
+  const DeltaSegment<T>* _segment;
+  mutable const uint8_t* _position = nullptr;
+  mutable T _value{};
+  mutable ChunkOffset _next_offset = 0;
+};
+
+// Decompresses values into a buffer, which is only valid until the next access. The buffer is kept per copy of the
+// accessor, i.e., per iterator.
+class FsstSegmentAccessor {
+ public:
+  explicit FsstSegmentAccessor(const FsstSegment& segment) : _segment{&segment} {}
+
+  const std::string& operator()(const ChunkOffset chunk_offset) const {
+    _segment->get(chunk_offset, _value);
+    return _value;
+  }
+
+ private:
+  const FsstSegment* _segment;
+  mutable std::string _value;
+};
+
+// Calls func with the accessor for a ValueSegment, DictionarySegment, RunLengthSegment, FrameOfReferenceSegment,
+// DeltaSegment, or FsstSegment
+template <typename T, typename Functor>
+void with_segment_accessor(const BaseSegment& segment, const Functor& func) {
+  resolve_segment_type<T>(segment, [&](const auto& typed_segment) {
+    using SegmentType = std::decay_t<decltype(typed_segment)>;
+    if constexpr (std::is_same_v<SegmentType, ValueSegment<T>>) {
+      func(ValueSegmentAccessor<T>{typed_segment});
+    } else if constexpr (std::is_same_v<SegmentType, DictionarySegment<T>>) {
+      resolve_attribute_vector_type(*typed_segment.attribute_vector(), [&](const auto& attribute_vector) {
+        using AttributeVectorType = std::decay_t<decltype(attribute_vector)>;
+        func(DictionarySegmentAccessor<T, AttributeVectorType>{typed_segment, attribute_vector});
+      });
+    } else if constexpr (std::is_same_v<SegmentType, RunLengthSegment<T>>) {
+      func(RunLengthSegmentAccessor<T>{typed_segment});
+    } else if constexpr (std::is_same_v<SegmentType, FrameOfReferenceSegment<T>>) {
+      func(FrameOfReferenceSegmentAccessor<T>{typed_segment});
+    } else if constexpr (std::is_same_v<SegmentType, DeltaSegment<T>>) {
+      func(DeltaSegmentAccessor<T>{typed_segment});
+    } else if constexpr (std::is_same_v<SegmentType, FsstSegment>) {
+      func(FsstSegmentAccessor{typed_segment});
+    } else {
+      Fail("ReferenceSegments cannot be accessed directly, use segment_iterate");
+    }
+  });
+}
+
+}  // namespace detail
+
+// Iterates over all offsets [begin, end) of a segment.
+template <typename T, typename Accessor>
+class SegmentIterator {
+ public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = SegmentPosition<T>;
+  using difference_type = std::ptrdiff_t;
+  using pointer = void;
+  using reference = SegmentPosition<T>;
+
+  SegmentIterator(const Accessor& accessor, const ChunkOffset chunk_offset)
+      : _accessor{accessor}, _chunk_offset{chunk_offset} {}
+
+  SegmentPosition<T> operator*() const { return {_accessor(_chunk_offset), _chunk_offset}; }
+
+  SegmentIterator& operator++() {
+    ++_chunk_offset;
+    return *this;
+  }
+
+  SegmentIterator operator++(int) {
+    auto previous = *this;
+    ++_chunk_offset;
+    return previous;
+  }
+
+  bool operator==(const SegmentIterator& other) const { return _chunk_offset == other._chunk_offset; }
+  bool operator!=(const SegmentIterator& other) const { return _chunk_offset != other._chunk_offset; }
+
+ private:
+  Accessor _accessor;
+  ChunkOffset _chunk_offset;
+};
+
+// Iterates over the offsets of a segment given by a range of RowIDs, whose chunk ids are ignored. The chunk_offset()
+// of the returned positions is the index into the range, i.e., the offset in the filtered output.
+template <typename T, typename Accessor>
+class PointAccessSegmentIterator {
+ public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = SegmentPosition<T>;
+  using difference_type = std::ptrdiff_t;
+  using pointer = void;
+  using reference = SegmentPosition<T>;
+
+  PointAccessSegmentIterator(const Accessor& accessor, const RowID* position, const ChunkOffset chunk_offset)
+      : _accessor{accessor}, _position{position}, _chunk_offset{chunk_offset} {}
+
+  SegmentPosition<T> operator*() const { return {_accessor(_position->chunk_offset), _chunk_offset}; }
+
+  PointAccessSegmentIterator& operator++() {
+    ++_position;
+    ++_chunk_offset;
+    return *this;
+  }
+
+  PointAccessSegmentIterator operator++(int) {
+    auto previous = *this;
+    ++*this;
+    return previous;
+  }
+
+  bool operator==(const PointAccessSegmentIterator& other) const { return _position == other._position; }
+  bool operator!=(const PointAccessSegmentIterator& other) const { return _position != other._position; }
+
+ private:
+  Accessor _accessor;
+  const RowID* _position;
+  ChunkOffset _chunk_offset;
+};
+
+// Calls func(begin, end) with iterators over all values of a ValueSegment<T>, DictionarySegment<T>,
+// RunLengthSegment<T>, FrameOfReferenceSegment<T>, DeltaSegment<T>, or FsstSegment. The segment type and the attribute
+// vector type are resolved once, so that the iterators read the values without virtual calls or AllTypeVariant and can
+// be inlined into the loop of the caller. For ReferenceSegments, use segment_iterate.
+template <typename T, typename Functor>
+void segment_with_iterators(const BaseSegment& segment, const Functor& func) {
+  detail::with_segment_accessor<T>(segment, [&](const auto& accessor) {
+    using Iterator = SegmentIterator<T, std::decay_t<decltype(accessor)>>;
+    func(Iterator{accessor, 0}, Iterator{accessor, segment.size()});
+  });
+}
+
+// Same as above, but only iterates over the values at the chunk offsets of [positions_begin, positions_end)
+template <typename T, typename Functor>
+void segment_with_iterators(const BaseSegment& segment, const RowID* positions_begin, const RowID* positions_end,
+                            const Functor& func) {
+  detail::with_segment_accessor<T>(segment, [&](const auto& accessor) {
+    using Iterator = PointAccessSegmentIterator<T, std::decay_t<decltype(accessor)>>;
+    const auto position_count = static_cast<ChunkOffset>(positions_end - positions_begin);
+    func(Iterator{accessor, positions_begin, 0}, Iterator{accessor, positions_end, position_count});
+  });
+}
+
+// Calls func(const SegmentPosition<T>&) for every value of a segment, in order. For ReferenceSegments, the referenced
+// segments are resolved once per run of positions in the same chunk and then iterated with point access.
+template <typename T, typename Functor>
+void segment_iterate(const BaseSegment& segment, const Functor& func) {
+  const auto iterate = [&](auto begin, const auto end) {
+    for (; begin != end; ++begin) {
+      func(*begin);
+    }
+  };
+
+  const auto* reference_segment = dynamic_cast<const ReferenceSegment*>(&segment);
+  if (!reference_segment) {
+    segment_with_iterators<T>(segment, iterate);
+    return;
+  }
+
+  const auto& referenced_table = *reference_segment->referenced_table();
+  const auto referenced_column_id = reference_segment->referenced_column_id();
+  const auto* positions = reference_segment->pos_list()->data();
+  const auto position_count = reference_segment->size();
+
+  auto run_begin = ChunkOffset{0};
+  while (run_begin < position_count) {
+    const auto chunk_id = positions[run_begin].chunk_id;
+    auto run_end = run_begin + 1;
+    while (run_end < position_count && positions[run_end].chunk_id == chunk_id) ++run_end;
+
+    const auto referenced_segment = referenced_table.get_chunk(chunk_id).get_segment(referenced_column_id);
+    segment_with_iterators<T>(*referenced_segment, positions + run_begin, positions + run_end,
+                              [&](auto begin, const auto end) {
+                                for (; begin != end; ++begin) {
+                                  const auto position = *begin;
+                                  func(SegmentPosition<T>{position.value(), run_begin + position.chunk_offset()});
+                                }
+                              });
+    run_begin = run_end;
+  }
+}
+
+}  // namespace opossum
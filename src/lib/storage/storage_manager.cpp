@@ -1,7 +1,14 @@
 #include "storage_manager.hpp"
 
+#include <algorithm>
+#include <filesystem>
+#include <iomanip>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <sstream>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -9,37 +16,129 @@
 
 namespace opossum {
 
+namespace {
+
+constexpr auto TABLE_FILE_EXTENSION = ".bin";
+
+}  // namespace
+
 StorageManager& StorageManager::get() {
   static StorageManager sm;
   return sm;
 }
 
-void StorageManager::add_table(const std::string& name, std::shared_ptr<Table> table) { _tables.insert({name, table}); }
+void StorageManager::add_table(const std::string& name, std::shared_ptr<Table> table) {
+  _update([&](auto& tables) { tables.insert({name, std::move(table)}); });
+}
 
 void StorageManager::drop_table(const std::string& name) {
-  const auto dropped_table_count = _tables.erase(name);
-  Assert(dropped_table_count == 1, "Table could not be removed");
+  _update([&](auto& tables) {
+    const auto dropped_table_count = tables.erase(name);
+    Assert(dropped_table_count == 1, "Table could not be removed");
+  });
 }
 
-std::shared_ptr<Table> StorageManager::get_table(const std::string& name) const { return _tables.at(name); }
+std::shared_ptr<Table> StorageManager::get_table(const std::string& name) const { return _snapshot()->at(name); }
 
-bool StorageManager::has_table(const std::string& name) const { return _tables.contains(name); }
+bool StorageManager::has_table(const std::string& name) const { return _snapshot()->contains(name); }
 
 std::vector<std::string> StorageManager::table_names() const {
+  const auto tables = _snapshot();
   std::vector<std::string> names{};
-  names.reserve(_tables.size());
-  for (auto it = _tables.begin(); it != _tables.end(); ++it) {
+  names.reserve(tables->size());
+  for (auto it = tables->begin(); it != tables->end(); ++it) {
     names.push_back(it->first);
   }
   return names;
 }
 
 void StorageManager::print(std::ostream& out) const {
-  for (auto it = _tables.begin(); it != _tables.end(); ++it) {
+  const auto tables = _snapshot();
+  for (auto it = tables->begin(); it != tables->end(); ++it) {
     it->second->print();
   }
 }
 
-void StorageManager::reset() { _tables.clear(); }
+std::vector<TableMemoryUsage> StorageManager::memory_usage_report() const {
+  const auto tables = _snapshot();
+  auto report = std::vector<TableMemoryUsage>{};
+  report.reserve(tables->size());
+  for (const auto& [name, table] : *tables) {
+    auto column_bytes = std::vector<size_t>(table->column_count());
+    for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+      column_bytes[column_id] = table->column_memory_usage(column_id);
+    }
+    report.push_back({name, table->memory_usage(), std::move(column_bytes)});
+  }
+  std::sort(report.begin(), report.end(), [](const auto& lhs, const auto& rhs) {
+    return std::tie(rhs.total_bytes, lhs.table_name) < std::tie(lhs.total_bytes, rhs.table_name);
+  });
+  return report;
+}
+
+void StorageManager::print_memory_usage(std::ostream& out) const {
+  const auto report = memory_usage_report();
+  const auto print_bytes = [&](const std::string& label, const size_t bytes, const size_t total_bytes) {
+    const auto percentage = 100.0 * static_cast<double>(bytes) / static_cast<double>(total_bytes);
+    auto share = std::ostringstream{};
+    share << std::fixed << std::setprecision(1) << percentage;
+    out << "  " << label << ": " << bytes << " bytes (" << share.str() << "%)\n";
+  };
+
+  auto total_bytes = size_t{0};
+  for (const auto& table_memory_usage : report) {
+    const auto& table = *get_table(table_memory_usage.table_name);
+    out << "Table " << table_memory_usage.table_name << ": " << table_memory_usage.total_bytes << " bytes, "
+        << table.chunk_count() << " chunks, " << table.row_count() << " rows\n";
+    auto column_total_bytes = size_t{0};
+    for (auto column_id = ColumnID{0}; column_id < table_memory_usage.column_bytes.size(); ++column_id) {
+      const auto column_bytes = table_memory_usage.column_bytes[column_id];
+      print_bytes(table.column_name(column_id) + " (" + table.column_type(column_id) + ")", column_bytes,
+                  table_memory_usage.total_bytes);
+      column_total_bytes += column_bytes;
+    }
+    // chunk and table objects, column definitions, and statistics
+    // the columns are measured after the table, so they may include rows that have been appended in the meantime
+    print_bytes("other", table_memory_usage.total_bytes - std::min(table_memory_usage.total_bytes, column_total_bytes),
+                table_memory_usage.total_bytes);
+    total_bytes += table_memory_usage.total_bytes;
+  }
+  out << "Total: " << total_bytes << " bytes\n";
+}
+
+void StorageManager::save(const std::string& directory) const {
+  std::filesystem::create_directories(directory);
+  for (const auto& [name, table] : *_snapshot()) {
+    Assert(!name.empty() && name.find('/') == std::string::npos, "Table name '" + name + "' is not a valid file name");
+    table->save((std::filesystem::path{directory} / (name + TABLE_FILE_EXTENSION)).string());
+  }
+}
+
+void StorageManager::load(const std::string& directory, const bool memory_map) {
+  // The tables are loaded before taking the write lock and published together.
+  auto loaded_tables = TableMap{};
+  for (const auto& entry : std::filesystem::directory_iterator{directory}) {
+    if (!entry.is_regular_file() || entry.path().extension() != TABLE_FILE_EXTENSION) continue;
+    loaded_tables[entry.path().stem().string()] = Table::load(entry.path().string(), memory_map);
+  }
+  _update([&](auto& tables) {
+    for (auto& [name, table] : loaded_tables) {
+      tables[name] = std::move(table);
+    }
+  });
+}
+
+void StorageManager::reset() {
+  _update([](auto& tables) { tables.clear(); });
+}
+
+std::shared_ptr<const StorageManager::TableMap> StorageManager::_snapshot() const { return std::atomic_load(&_tables); }
+
+void StorageManager::_update(const std::function<void(TableMap&)>& modification) {
+  std::lock_guard<std::mutex> lock(_write_mutex);
+  auto tables = std::make_shared<TableMap>(*_snapshot());
+  modification(*tables);
+  std::atomic_store(&_tables, std::shared_ptr<const TableMap>{std::move(tables)});
+}
 
 }  // namespace opossum
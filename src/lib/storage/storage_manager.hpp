@@ -1,7 +1,9 @@
 #pragma once
 
+#include <functional>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -11,13 +13,27 @@
 
 namespace opossum {
 
+// memory actually allocated for a table, see StorageManager::memory_usage_report
+struct TableMemoryUsage {
+  std::string table_name;
+  // see Table::memory_usage
+  size_t total_bytes;
+  // see Table::column_memory_usage, one entry per column
+  std::vector<size_t> column_bytes;
+};
+
 // The StorageManager is a singleton that maintains all tables
 // by mapping table names to table instances.
+//
+// It can be used by many threads at the same time. The map is never modified in place. Readers atomically load a
+// pointer to the current map and work on that snapshot, without waiting for writers. Writers are serialized by a
+// mutex, copy the map, modify the copy, and atomically publish it. Tables are shared pointers, so a dropped table is
+// only freed once the last reader that obtained it from an older snapshot is done with it.
 class StorageManager : private Noncopyable {
  public:
   static StorageManager& get();
 
-  // adds a table to the storage manager
+  // adds a table to the storage manager, unless it already holds a table with the given name
   void add_table(const std::string& name, std::shared_ptr<Table> table);
 
   // removes the table from the storage manger
@@ -35,14 +51,37 @@ class StorageManager : private Noncopyable {
   // prints information about all tables in the storage manager (name, #columns, #rows, #chunks)
   void print(std::ostream& out = std::cout) const;
 
+  // returns the memory usage of every table and its columns, largest tables first
+  std::vector<TableMemoryUsage> memory_usage_report() const;
+
+  // prints the memory usage of every table and the share of each of its columns
+  void print_memory_usage(std::ostream& out = std::cout) const;
+
+  // saves every table into a binary file named after the table in the given directory, see Table::save
+  void save(const std::string& directory) const;
+
+  // loads all tables saved into the given directory, replacing tables with the same name, see Table::load
+  void load(const std::string& directory, const bool memory_map = false);
+
   // deletes the entire StorageManager and creates a new one, used especially in tests
   void reset();
 
   StorageManager(StorageManager&&) = delete;
 
  protected:
+  using TableMap = std::unordered_map<std::string, std::shared_ptr<Table>>;
+
   StorageManager() {}
-  StorageManager& operator=(StorageManager&&) = default;
-  std::unordered_map<std::string, std::shared_ptr<Table>> _tables;
+  StorageManager& operator=(StorageManager&&) = delete;
+
+  // returns the current map, which stays valid and unchanged while it is held
+  std::shared_ptr<const TableMap> _snapshot() const;
+
+  // applies the modification to a copy of the current map and publishes the copy, one writer at a time
+  void _update(const std::function<void(TableMap&)>& modification);
+
+  // accessed with std::atomic_load and std::atomic_store
+  std::shared_ptr<const TableMap> _tables = std::make_shared<const TableMap>();
+  std::mutex _write_mutex;
 };
 }  // namespace opossum
@@ -1,32 +1,70 @@
 #include "table.hpp"
 
 #include <algorithm>
+#include <atomic>
+#include <functional>
 #include <iomanip>
+#include <iterator>
 #include <limits>
 #include <memory>
+#include <memory_resource>
 #include <numeric>
+#include <optional>
 #include <string>
-#include <thread>
+#include <type_traits>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include "binary_parser.hpp"
+#include "binary_writer.hpp"
+#include "delta_segment.hpp"
 #include "dictionary_segment.hpp"
+#include "frame_of_reference_segment.hpp"
+#include "fsst_segment.hpp"
+#include "run_length_segment.hpp"
 #include "value_segment.hpp"
+#include "zone_map.hpp"
 
 #include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "statistics/table_statistics.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "utils/memory_resources.hpp"
+#include "utils/memory_usage.hpp"
 
 namespace opossum {
 
-Table::Table(const ChunkOffset target_chunk_size) : _max_chunk_size{target_chunk_size} {
+// Writers reserve a row by incrementing reserved_row_count. As the segments are pre-sized, they can then write the row
+// without further synchronization. The writer that writes the last row adds the chunk to the table.
+struct Table::ConcurrentAppendChunk {
+  std::shared_ptr<Chunk> chunk;
+  // writes a value into the ValueSegment of the respective column, without resolving the data type for every value
+  std::vector<std::function<void(ChunkOffset, const AllTypeVariant&)>> column_writers;
+  // 64 bits, so that writers failing to reserve a row in a full chunk cannot overflow the counter
+  std::atomic<uint64_t> reserved_row_count{0};
+  std::atomic<uint64_t> written_row_count{0};
+};
+
+Table::Table(const ChunkOffset target_chunk_size)
+    : _max_chunk_size{target_chunk_size}, _statistics{std::make_unique<TableStatistics>()} {
   _chunks.push_back(std::make_shared<Chunk>());
+  _chunk_directory.push_back(*_chunks.back());
 }
 
-void Table::add_column(const std::string& name, const std::string& type) {
+Table::~Table() { wait_for_background_compressions(); }
+
+void Table::add_column_definition(const std::string& name, const std::string& type) {
   Assert(row_count() == 0, "The chunk is not empty: no modification of the column layout possible");
   _col_names.push_back(name);
   _col_types.push_back(type);
+  _statistics->add_column(type);
+}
+
+void Table::add_column(const std::string& name, const std::string& type) {
+  add_column_definition(name, type);
 
   for (const auto& chunk : _chunks) {
     _add_segment_to_chunk(chunk, type);
@@ -41,15 +79,154 @@ void Table::_add_segment_to_chunk(std::shared_ptr<Chunk> chunk, const std::strin
   });
 }
 
+void Table::_add_chunk() {
+  const auto chunk = std::make_shared<Chunk>();
+  for (const auto& type : _col_types) {
+    _add_segment_to_chunk(chunk, type);
+  }
+  std::lock_guard<std::mutex> lock(_chunk_lock);
+  _chunks.push_back(chunk);
+  _chunk_directory.push_back(*chunk);
+}
+
 void Table::append(const std::vector<AllTypeVariant>& values) {
-  if (_chunks.back()->size() == _max_chunk_size) {
-    std::shared_ptr<Chunk> chunk = std::make_shared<Chunk>();
-    _chunks.push_back(chunk);
-    for (const auto& type : _col_types) {
-      _add_segment_to_chunk(chunk, type);
+  // The last chunk is looked up through the directory, as full chunks may be replaced by their compressed version
+  // concurrently. Chunks that are not full yet are never replaced.
+  if (get_chunk(ChunkID{chunk_count() - 1}).size() == _max_chunk_size) _add_chunk();
+  auto& chunk = get_chunk(ChunkID{chunk_count() - 1});
+  chunk.append(values);
+
+  if (_background_compression && chunk.size() == _max_chunk_size) {
+    _schedule_background_compression(_chunks.back());
+  }
+}
+
+void Table::append_columns(const std::vector<std::shared_ptr<BaseSegment>>& column_batches) {
+  Assert(column_batches.size() == _col_types.size(), "Invalid number of columns to be inserted");
+  const auto batch_row_count = column_batches.empty() ? size_t{0} : size_t{column_batches.front()->size()};
+  // All batches and the chunk that is filled first are checked before any rows are moved, so that a failing call leaves
+  // the table and the batches unchanged.
+  const auto& last_chunk = get_chunk(ChunkID{chunk_count() - 1});
+  const auto fills_last_chunk = last_chunk.size() < _max_chunk_size;
+  for (auto column_id = ColumnID{0}; column_id < column_batches.size(); ++column_id) {
+    Assert(column_batches[column_id]->size() == batch_row_count, "All columns must have the same number of rows");
+    resolve_data_type(column_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      Assert(std::dynamic_pointer_cast<ValueSegment<ColumnDataType>>(column_batches[column_id]),
+             "Column batches must be ValueSegments of the column's data type");
+      Assert(!fills_last_chunk || std::dynamic_pointer_cast<ValueSegment<ColumnDataType>>(
+                                      last_chunk.get_segment(column_id)),
+             "Rows can only be appended to ValueSegments");
+    });
+  }
+
+  auto batch_offset = size_t{0};
+  while (batch_offset < batch_row_count) {
+    if (get_chunk(ChunkID{chunk_count() - 1}).size() == _max_chunk_size) _add_chunk();
+    auto& chunk = get_chunk(ChunkID{chunk_count() - 1});
+    const auto row_count = std::min(batch_row_count - batch_offset, size_t{_max_chunk_size - chunk.size()});
+
+    for (auto column_id = ColumnID{0}; column_id < column_batches.size(); ++column_id) {
+      resolve_data_type(column_type(column_id), [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+        const auto batch = std::static_pointer_cast<ValueSegment<ColumnDataType>>(column_batches[column_id]);
+        const auto segment = std::static_pointer_cast<ValueSegment<ColumnDataType>>(chunk.get_segment(column_id));
+
+        auto& batch_values = batch->values();
+        auto& values = segment->values();
+        if (values.empty() && row_count == batch_values.size()) {
+          // The whole batch fits into the empty chunk, so its buffer can be taken over as is if it comes from the same
+          // memory resource.
+          values = std::move(batch_values);
+        } else {
+          const auto begin = batch_values.begin() + batch_offset;
+          values.insert(values.end(), std::make_move_iterator(begin), std::make_move_iterator(begin + row_count));
+        }
+        if (batch_offset + row_count == batch_row_count) batch_values.clear();
+      });
+    }
+    batch_offset += row_count;
+
+    if (_background_compression && chunk.size() == _max_chunk_size) {
+      _schedule_background_compression(_chunks.back());
     }
   }
-  _chunks.back()->append(values);
+}
+
+void Table::append_concurrently(const std::vector<AllTypeVariant>& values) {
+  DebugAssert(values.size() == _col_types.size(), "Invalid number of columns to be inserted");
+
+  auto append_chunk = std::atomic_load(&_concurrent_append_chunk);
+  while (true) {
+    if (!append_chunk || append_chunk->reserved_row_count >= _max_chunk_size) {
+      // Replace the full chunk. If another writer has done so in the meantime, the compare-exchange fails and loads the
+      // other writer's chunk into append_chunk instead.
+      const auto current_append_chunk = std::atomic_load(&_concurrent_append_chunk);
+      if (current_append_chunk != append_chunk) {
+        append_chunk = current_append_chunk;
+        continue;
+      }
+      const auto new_append_chunk = _make_concurrent_append_chunk();
+      if (std::atomic_compare_exchange_strong(&_concurrent_append_chunk, &append_chunk, new_append_chunk)) {
+        append_chunk = new_append_chunk;
+      }
+      continue;
+    }
+
+    const auto chunk_offset = append_chunk->reserved_row_count++;
+    // Other writers may have reserved the last rows after our check above.
+    if (chunk_offset >= _max_chunk_size) continue;
+
+    for (auto column_id = size_t{0}; column_id < values.size(); ++column_id) {
+      append_chunk->column_writers[column_id](static_cast<ChunkOffset>(chunk_offset), values[column_id]);
+    }
+
+    if (++append_chunk->written_row_count == _max_chunk_size) {
+      emplace_chunk(append_chunk->chunk);
+      if (_background_compression) _schedule_background_compression(append_chunk->chunk);
+    }
+    return;
+  }
+}
+
+void Table::finish_concurrent_appends() {
+  const auto append_chunk = std::atomic_exchange(&_concurrent_append_chunk, std::shared_ptr<ConcurrentAppendChunk>{});
+  if (!append_chunk) return;
+
+  const auto row_count = append_chunk->written_row_count.load();
+  Assert(row_count == std::min(append_chunk->reserved_row_count.load(), uint64_t{_max_chunk_size}),
+         "Concurrent appends must be done before they are finished");
+  // Full chunks have been added to the table by their last writer.
+  if (row_count == 0 || row_count == _max_chunk_size) return;
+
+  auto& chunk = *append_chunk->chunk;
+  for (auto column_id = ColumnID{0}; column_id < chunk.column_count(); ++column_id) {
+    resolve_data_type(column_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      std::static_pointer_cast<ValueSegment<ColumnDataType>>(chunk.get_segment(column_id))->resize(row_count);
+    });
+  }
+  emplace_chunk(append_chunk->chunk);
+}
+
+std::shared_ptr<Table::ConcurrentAppendChunk> Table::_make_concurrent_append_chunk() const {
+  Assert(_max_chunk_size < std::numeric_limits<ChunkOffset>::max() - 1,
+         "Concurrent appends pre-size their chunks and thus need an explicit target chunk size");
+
+  auto append_chunk = std::make_shared<ConcurrentAppendChunk>();
+  append_chunk->chunk = std::make_shared<Chunk>();
+  for (const auto& type : _col_types) {
+    resolve_data_type(type, [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      const auto value_segment = std::make_shared<ValueSegment<ColumnDataType>>(_max_chunk_size);
+      append_chunk->chunk->add_segment(value_segment);
+      append_chunk->column_writers.emplace_back(
+          [segment = value_segment.get()](const ChunkOffset chunk_offset, const AllTypeVariant& value) {
+            segment->set(chunk_offset, value);
+          });
+    });
+  }
+  return append_chunk;
 }
 
 ColumnCount Table::column_count() const {
@@ -58,15 +235,17 @@ ColumnCount Table::column_count() const {
 }
 
 uint64_t Table::row_count() const {
-  if (_chunks.empty()) return 0;
-  int full_chunks_count = _chunks.size() - 1;
-  return full_chunks_count * _max_chunk_size + _chunks.back()->size();
+  // Chunks added via emplace_chunk may be smaller than the target chunk size, so we cannot assume that all but the
+  // last chunk are full.
+  const auto chunk_count = _chunk_directory.size();
+  auto count = uint64_t{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    count += _chunk_directory.get(chunk_id).size();
+  }
+  return count;
 }
 
-ChunkID Table::chunk_count() const {
-  uint16_t count = _chunks.size();
-  return ChunkID{count};
-}
+ChunkID Table::chunk_count() const { return _chunk_directory.size(); }
 
 ColumnID Table::column_id_by_name(const std::string& column_name) const {
   auto id = std::find(_col_names.begin(), _col_names.end(), column_name);
@@ -75,6 +254,18 @@ ColumnID Table::column_id_by_name(const std::string& column_name) const {
   return ColumnID(index);
 }
 
+void Table::emplace_chunk(std::shared_ptr<Chunk> chunk) {
+  Assert(chunk->column_count() == column_count(), "Chunk does not match the column layout of the table");
+  std::lock_guard<std::mutex> lock(_chunk_lock);
+  if (_chunks.size() == 1 && _chunks.front()->size() == 0) {
+    _chunk_directory.replace(ChunkID{0}, *chunk);
+    _replaced_chunks.push_back(std::exchange(_chunks.front(), std::move(chunk)));
+  } else {
+    _chunk_directory.push_back(*chunk);
+    _chunks.push_back(std::move(chunk));
+  }
+}
+
 ChunkOffset Table::target_chunk_size() const { return _max_chunk_size; }
 
 const std::vector<std::string>& Table::column_names() const { return _col_names; }
@@ -83,17 +274,9 @@ const std::string& Table::column_name(const ColumnID column_id) const { return _
 
 const std::string& Table::column_type(const ColumnID column_id) const { return _col_types.at(column_id); }
 
-Chunk& Table::get_chunk(ChunkID chunk_id) {
-  std::lock_guard<std::mutex> lock(_chunk_lock);
-  return *_chunks.at(chunk_id);
-}
-
-const Chunk& Table::get_chunk(ChunkID chunk_id) const {
-  std::lock_guard<std::mutex> lock(_chunk_lock);
-  return std::as_const(_get_chunk(chunk_id));
-}
+Chunk& Table::get_chunk(ChunkID chunk_id) { return _chunk_directory.get(chunk_id); }
 
-Chunk& Table::_get_chunk(ChunkID chunk_id) const { return *_chunks.at(chunk_id); }
+const Chunk& Table::get_chunk(ChunkID chunk_id) const { return _chunk_directory.get(chunk_id); }
 
 void Table::print(std::ostream& out) const {
   int col_width = 20;
@@ -108,46 +291,245 @@ void Table::print(std::ostream& out) const {
   }
 }
 
-void Table::compress_chunk(ChunkID chunk_id) {
+void Table::save(const std::string& file_name) const { BinaryWriter::write(*this, file_name); }
+
+std::shared_ptr<Table> Table::load(const std::string& file_name, const bool memory_map) {
+  const auto table = BinaryParser::parse(file_name, memory_map);
+  // Full chunks are covered by the statistics, as if they had been compressed.
+  table->update_statistics();
+  return table;
+}
+
+void Table::compress_chunk(ChunkID chunk_id, const EncodingType encoding) {
+  // The lock is not held during the compression, so that readers are not blocked.
+  std::shared_ptr<Chunk> chunk;
+  {
+    std::lock_guard<std::mutex> lock(_chunk_lock);
+    chunk = _chunks.at(chunk_id);
+  }
+  Assert(chunk->size() == target_chunk_size(), "Attempt to compress chunk that is not yet completely filled.");
+
+  _compress_chunk(chunk, encoding);
+}
+
+void Table::set_bloom_filter_false_positive_rate(const std::optional<double> false_positive_rate) {
+  Assert(!false_positive_rate || (*false_positive_rate > 0.0 && *false_positive_rate < 1.0),
+         "False-positive rate must be between 0 and 1");
+  _bloom_filter_false_positive_rate = false_positive_rate.value_or(0.0);
+}
+
+void Table::set_memory_resource(std::shared_ptr<std::pmr::memory_resource> memory_resource) {
+  std::atomic_store(&_memory_resource, std::move(memory_resource));
+}
+
+void Table::set_background_compression(const bool enabled) { _background_compression = enabled; }
+
+void Table::wait_for_background_compressions() const {
+  std::vector<std::shared_ptr<AbstractTask>> compression_tasks;
+  {
+    std::lock_guard<std::mutex> lock(_compression_tasks_lock);
+    compression_tasks = _compression_tasks;
+  }
+  CurrentScheduler::wait_for_tasks(compression_tasks);
+}
+
+size_t Table::pending_compression_count() const { return _pending_compression_count; }
+
+size_t Table::completed_compression_count() const { return _completed_compression_count; }
+
+int64_t Table::compression_bytes_saved() const { return _compression_bytes_saved; }
+
+size_t Table::memory_usage() const {
+  auto allocated_bytes = sizeof(*this) + heap_memory_usage(_col_names) + heap_memory_usage(_col_types) +
+                         sizeof(TableStatistics) + _statistics->estimate_memory_usage();
+  {
+    std::lock_guard<std::mutex> lock(_chunk_lock);
+    allocated_bytes += heap_memory_usage(_chunks) + _chunk_directory.heap_memory_usage() +
+                       heap_memory_usage(_replaced_chunks);
+    auto segments = std::unordered_set<const BaseSegment*>{};
+    for (const auto& chunk : _chunks) {
+      allocated_bytes += chunk->memory_usage() + SHARED_POINTER_CONTROL_BLOCK_SIZE;
+      for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+        segments.insert(chunk->get_segment(column_id).get());
+      }
+    }
+    for (const auto& chunk : _replaced_chunks) {
+      allocated_bytes += chunk->memory_usage() + SHARED_POINTER_CONTROL_BLOCK_SIZE;
+      // Chunks that have been replaced by their compressed version share its segments and zone maps.
+      for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+        if (segments.contains(chunk->get_segment(column_id).get())) allocated_bytes -= chunk->memory_usage(column_id);
+      }
+    }
+  }
+
+  // Once full, the chunk of append_concurrently has been added to the chunks above.
+  const auto append_chunk = std::atomic_load(&_concurrent_append_chunk);
+  if (append_chunk && append_chunk->written_row_count < _max_chunk_size) {
+    allocated_bytes += sizeof(ConcurrentAppendChunk) + heap_memory_usage(append_chunk->column_writers) +
+                       append_chunk->chunk->memory_usage() + 2 * SHARED_POINTER_CONTROL_BLOCK_SIZE;
+  }
+  return allocated_bytes;
+}
+
+size_t Table::column_memory_usage(const ColumnID column_id) const {
+  Assert(column_id < column_count(), "Column does not exist");
   std::lock_guard<std::mutex> lock(_chunk_lock);
-  auto& uncompressed_chunk = _get_chunk(chunk_id);
-  Assert(uncompressed_chunk.size() == target_chunk_size(),
-         "Attempt to compress chunk that is not yet completely filled.");
+  auto allocated_bytes = size_t{0};
+  for (const auto& chunk : _chunks) {
+    if (chunk->column_count() > column_id) allocated_bytes += chunk->memory_usage(column_id);
+  }
+  return allocated_bytes;
+}
+
+const TableStatistics& Table::statistics() const { return *_statistics; }
 
-  std::shared_ptr<Chunk> compressed_chunk = _compress_multithreaded(uncompressed_chunk);
-  _chunks[chunk_id] = compressed_chunk;
+void Table::update_statistics() {
+  auto full_chunks = std::vector<std::shared_ptr<Chunk>>{};
+  {
+    std::lock_guard<std::mutex> lock(_chunk_lock);
+    std::copy_if(_chunks.begin(), _chunks.end(), std::back_inserter(full_chunks),
+                 [&](const auto& chunk) { return chunk->size() == _max_chunk_size; });
+  }
+  for (const auto& chunk : full_chunks) {
+    _statistics->add_chunk(*chunk);
+  }
+}
+
+void Table::_schedule_background_compression(const std::shared_ptr<Chunk>& chunk) {
+  ++_pending_compression_count;
+  auto compression_task = std::make_shared<JobTask>([this, chunk] {
+    _compress_chunk(chunk, EncodingType::Dictionary);
+    --_pending_compression_count;
+  });
+
+  {
+    std::lock_guard<std::mutex> lock(_compression_tasks_lock);
+    // Forget finished compressions, so that the list does not grow with the table.
+    std::erase_if(_compression_tasks, [](const auto& task) { return task->is_done(); });
+    _compression_tasks.push_back(compression_task);
+  }
+  compression_task->schedule();
 }
 
-std::shared_ptr<Chunk> Table::_compress_multithreaded(Chunk& uncompressed_chunk) {
-  auto compressed_chunk = std::make_shared<Chunk>();
+void Table::_compress_chunk(const std::shared_ptr<Chunk>& chunk, const EncodingType encoding) {
   auto col_count = column_count();
-  std::vector<std::thread> column_threads = {};
-  column_threads.reserve(col_count);
 
+  // The segments are compressed in a copy of the chunk, which is published as a whole, so that readers that look up
+  // the chunk see either all or none of the compressed segments and their zone maps.
+  const auto compressed_chunk = std::make_shared<Chunk>();
   for (ColumnID column_id = ColumnID{0}; column_id < col_count; column_id++) {
-    std::thread single_column_thread(&Table::_compress_column, this, std::ref(uncompressed_chunk),
-                                     std::ref(compressed_chunk), column_id);
-    column_threads.push_back(std::move(single_column_thread));
+    compressed_chunk->add_segment(chunk->get_segment(column_id));
+    compressed_chunk->set_zone_map(column_id, chunk->get_zone_map(column_id));
   }
 
-  for (std::thread& column_thread : column_threads) {
-    if (column_thread.joinable()) {
-      column_thread.join();
-    }
+  std::atomic_bool compressed_any_segment{false};
+  std::vector<std::shared_ptr<AbstractTask>> column_tasks = {};
+  column_tasks.reserve(col_count);
+
+  // All columns allocate from one arena, whose first block fits about one attribute vector of 32 bit value ids.
+  const auto arena =
+      std::make_shared<MonotonicArena>(std::atomic_load(&_memory_resource), size_t{chunk->size()} * sizeof(ValueID));
+
+  for (ColumnID column_id = ColumnID{0}; column_id < col_count; column_id++) {
+    column_tasks.push_back(std::make_shared<JobTask>([&, column_id] {
+      if (_compress_segment(*compressed_chunk, column_id, encoding, arena)) compressed_any_segment = true;
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(column_tasks);
+
+  if (!compressed_any_segment) return;
+
+  auto bytes_saved = int64_t{0};
+  for (ColumnID column_id = ColumnID{0}; column_id < col_count; column_id++) {
+    bytes_saved += static_cast<int64_t>(chunk->get_segment(column_id)->estimate_memory_usage()) -
+                   static_cast<int64_t>(compressed_chunk->get_segment(column_id)->estimate_memory_usage());
   }
+  if (!_replace_chunk(chunk, compressed_chunk)) return;
 
-  return compressed_chunk;
+  _compression_bytes_saved += bytes_saved;
+  _statistics->add_chunk(*compressed_chunk);
+  ++_completed_compression_count;
 }
 
-void Table::_compress_column(Chunk& uncompressed_chunk, std::shared_ptr<Chunk>& compressed_chunk,
-                             ColumnID col_id) const {
-  const auto& column_segment = uncompressed_chunk.get_segment(col_id);
+bool Table::_replace_chunk(const std::shared_ptr<Chunk>& chunk, const std::shared_ptr<Chunk>& compressed_chunk) {
+  std::lock_guard<std::mutex> lock(_chunk_lock);
+  const auto chunk_iter = std::find(_chunks.begin(), _chunks.end(), chunk);
+  // A concurrent compression of the same chunk has already replaced it.
+  if (chunk_iter == _chunks.end()) return false;
+
+  _chunk_directory.replace(ChunkID{static_cast<ChunkID::base_type>(chunk_iter - _chunks.begin())}, *compressed_chunk);
+  *chunk_iter = compressed_chunk;
 
-  resolve_data_type(column_type(col_id), [&](const auto col_type_string) {
+  // Only the slot in the chunk directory is swapped atomically. Readers may still use the replaced chunk, so it is kept
+  // like the chunks replaced by emplace_chunk. To not keep its uncompressed segments as well, it is pointed to the
+  // compressed segments, which hold the same values, one column at a time, so these readers may see a mix of
+  // uncompressed and compressed segments. The zone maps come first, as they also describe the uncompressed segments.
+  for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+    chunk->set_zone_map(column_id, compressed_chunk->get_zone_map(column_id));
+  }
+  for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+    chunk->replace_segment(column_id, chunk->get_segment(column_id), compressed_chunk->get_segment(column_id));
+  }
+  _replaced_chunks.push_back(chunk);
+  return true;
+}
+
+bool Table::_compress_segment(Chunk& chunk, ColumnID column_id, const EncodingType encoding,
+                              const std::shared_ptr<std::pmr::memory_resource>& arena) {
+  const auto segment = chunk.get_segment(column_id);
+  auto compressed = false;
+
+  resolve_data_type(column_type(column_id), [&](const auto col_type_string) {
     using ColumnDataType = typename decltype(col_type_string)::type;
-    const auto compressed_segment = std::make_shared<DictionarySegment<ColumnDataType>>(column_segment);
-    compressed_chunk->add_segment(compressed_segment);
+    // The segment may have been compressed already, e.g., when the chunk has been loaded.
+    if (!std::dynamic_pointer_cast<ValueSegment<ColumnDataType>>(segment)) return;
+
+    const auto bloom_filter_false_positive_rate = _bloom_filter_false_positive_rate.load();
+    const auto make_dictionary_segment = [&] {
+      return std::make_shared<DictionarySegment<ColumnDataType>>(
+          segment,
+          bloom_filter_false_positive_rate > 0.0 ? std::optional{bloom_filter_false_positive_rate} : std::nullopt,
+          arena);
+    };
+
+    auto compressed_segment = std::shared_ptr<BaseSegment>{};
+    switch (encoding) {
+      case EncodingType::Dictionary:
+        compressed_segment = make_dictionary_segment();
+        break;
+      case EncodingType::RunLength:
+        compressed_segment = std::make_shared<RunLengthSegment<ColumnDataType>>(segment);
+        break;
+      case EncodingType::FrameOfReference:
+        if constexpr (is_frame_of_reference_encodable_v<ColumnDataType>) {
+          compressed_segment = std::make_shared<FrameOfReferenceSegment<ColumnDataType>>(segment);
+        } else {
+          compressed_segment = make_dictionary_segment();
+        }
+        break;
+      case EncodingType::Delta:
+        if constexpr (is_delta_encodable_v<ColumnDataType>) {
+          compressed_segment = std::make_shared<DeltaSegment<ColumnDataType>>(segment);
+        } else {
+          compressed_segment = make_dictionary_segment();
+        }
+        break;
+      case EncodingType::Fsst:
+        if constexpr (std::is_same_v<ColumnDataType, std::string>) {
+          compressed_segment = std::make_shared<FsstSegment>(segment);
+        } else {
+          compressed_segment = make_dictionary_segment();
+        }
+        break;
+    }
+    // The chunk is not published yet, so no one else replaces its segments.
+    chunk.replace_segment(column_id, segment, compressed_segment);
+    // Chunks are only compressed once they are full, so the segment is never empty.
+    chunk.set_zone_map(column_id, ZoneMap<ColumnDataType>::from_segment(*compressed_segment));
+    compressed = true;
   });
+
+  return compressed;
 }
 
 }  // namespace opossum
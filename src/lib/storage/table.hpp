@@ -1,15 +1,19 @@
 #pragma once
 
+#include <atomic>
 #include <limits>
 #include <map>
 #include <memory>
+#include <memory_resource>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "base_segment.hpp"
 #include "chunk.hpp"
+#include "chunk_directory.hpp"
 
 #include "type_cast.hpp"
 #include "types.hpp"
@@ -17,6 +21,7 @@
 
 namespace opossum {
 
+class AbstractTask;
 class TableStatistics;
 
 // A table is partitioned horizontally into a number of chunks
@@ -27,6 +32,9 @@ class Table : private Noncopyable {
   // default is the maximum chunk size minus 1. A table holds always at least one chunk
   explicit Table(const ChunkOffset target_chunk_size = std::numeric_limits<ChunkOffset>::max() - 1);
 
+  // waits for the background compressions of the table's chunks
+  ~Table();
+
   // returns the number of columns (cannot exceed ColumnID (uint16_t))
   ColumnCount column_count() const;
 
@@ -39,11 +47,13 @@ class Table : private Noncopyable {
   ChunkID chunk_count() const;
 
   // returns the chunk with the given id
+  // this and chunk_count are wait-free, so they never wait for chunks that are added or compressed concurrently
   Chunk& get_chunk(ChunkID chunk_id);
   const Chunk& get_chunk(ChunkID chunk_id) const;
 
-  // Adds a chunk to the table. If the first chunk is empty, it is replaced.
-  void emplace_chunk(Chunk chunk);
+  // Adds a chunk to the table. If the first chunk is empty, it is replaced. As readers may still use the replaced
+  // chunk, it is kept until the table is destroyed.
+  void emplace_chunk(std::shared_ptr<Chunk> chunk);
 
   // Returns a list of all column names.
   const std::vector<std::string>& column_names() const;
@@ -62,6 +72,10 @@ class Table : private Noncopyable {
   // return the target chunk size (cannot exceed ChunkOffset (uint32_t))
   ChunkOffset target_chunk_size() const;
 
+  // adds a column to the end, i.e., right, of the table, without adding segments to the chunks
+  // this is used for tables whose chunks are created externally and added via emplace_chunk, e.g., operator outputs
+  void add_column_definition(const std::string& name, const std::string& type);
+
   // adds a column to the end, i.e., right, of the table
   // this can only be done if the table does not yet have any entries, because we would otherwise have to deal
   // with default values
@@ -69,24 +83,125 @@ class Table : private Noncopyable {
 
   // inserts a row at the end of the table
   // note this is slow and not thread-safe and should be used for testing purposes only
+  // once a chunk reaches the target chunk size, it is compressed in the background
   void append(const std::vector<AllTypeVariant>& values);
 
+  // appends rows given column-wise, as one ValueSegment<T> per column that holds the column's values, e.g., created
+  // from a pmr_vector<T> via ValueSegment<T>(std::move(values)). The values are moved into the table and split at
+  // chunk boundaries, without constructing an AllTypeVariant per value like append does. The batches are left empty.
+  void append_columns(const std::vector<std::shared_ptr<BaseSegment>>& column_batches);
+
+  // inserts a row into the table, can be called by multiple threads concurrently
+  // writers reserve rows in a chunk that is pre-sized to the target chunk size and only added to the table once all
+  // its rows have been written, so the order of the rows is not defined and rows may not be visible until the chunk is
+  // full or finish_concurrent_appends is called. This must not be mixed with append.
+  void append_concurrently(const std::vector<AllTypeVariant>& values);
+
+  // adds the partially filled chunk of append_concurrently to the table
+  // all calls to append_concurrently must be done
+  void finish_concurrent_appends();
+
   void print(std::ostream& out = std::cout) const;
 
-  // compresses a ValueColumn into a DictionaryColumn
-  void compress_chunk(ChunkID chunk_id);
+  // writes the table into a binary file (see binary_format.hpp), keeping dictionary-encoded segments encoded
+  void save(const std::string& file_name) const;
+
+  // loads a table written by save, without parsing or encoding any values
+  // with memory_map set, dictionaries and attribute vectors are used in place from the mapped file (see BinaryParser)
+  static std::shared_ptr<Table> load(const std::string& file_name, const bool memory_map = false);
+
+  // compresses the ValueSegments of a full chunk with the given encoding
+  // frame-of-reference and delta encoding only apply to int and long columns, FSST only to string columns, other
+  // columns are dictionary-encoded
+  // segments that have already been compressed, e.g., in the background, are skipped
+  // every compressed segment gets a zone map (see ZoneMap), which scans use to skip the chunk
+  // the compressed segments and zone maps are published at once in a new chunk, which replaces the chunk in the table
+  // readers that still hold the replaced chunk see its segments switch to the compressed ones column by column
+  // background compression always uses dictionary encoding, so disable it for chunks that should be run-length encoded
+  void compress_chunk(ChunkID chunk_id, const EncodingType encoding = EncodingType::Dictionary);
+
+  // enables Bloom filters with the given false-positive rate for the DictionarySegments of chunks that are compressed
+  // from now on, in the background or by compress_chunk, or disables them with std::nullopt (disabled by default)
+  void set_bloom_filter_false_positive_rate(const std::optional<double> false_positive_rate);
+
+  // sets the memory resource that the arenas of compressed chunks allocate their blocks from, e.g., a
+  // PageMemoryResource with huge pages for large tables, or resets it to the default heap with nullptr
+  // every compression of a chunk allocates its DictionarySegments from one MonotonicArena, which is released when the
+  // last of them is gone. The arena keeps the resource alive.
+  void set_memory_resource(std::shared_ptr<std::pmr::memory_resource> memory_resource);
+
+  // enables or disables the background compression of chunks that become full through append (enabled by default)
+  void set_background_compression(const bool enabled);
+
+  // blocks until all background compressions that have been started so far are done
+  void wait_for_background_compressions() const;
+
+  // returns the number of background compressions that have been started but are not done yet
+  size_t pending_compression_count() const;
+
+  // returns the number of chunks whose segments have been compressed, in the background or by compress_chunk
+  size_t completed_compression_count() const;
+
+  // returns the estimated memory usage of all replaced segments minus that of their compressed versions
+  // this may be negative for segments that do not compress well, e.g., unique strings
+  int64_t compression_bytes_saved() const;
+
+  // returns the memory actually allocated for the table: its chunks (see Chunk::memory_usage), the chunk that
+  // append_concurrently writes into, the column definitions, and the statistics
+  size_t memory_usage() const;
+
+  // returns the memory actually allocated for the segments and zone maps of a column in all chunks
+  size_t column_memory_usage(const ColumnID column_id) const;
+
+  // returns histograms and distinct-count sketches of the compressed and loaded chunks (see TableStatistics)
+  // they are updated whenever a chunk is compressed, so chunks that are not full yet are not covered
+  const TableStatistics& statistics() const;
+
+  // adds all full chunks to the statistics, e.g., chunks that have been loaded or compressed before being added via
+  // emplace_chunk. Chunks that are covered already are skipped.
+  void update_statistics();
 
  protected:
   const ChunkOffset _max_chunk_size;
+  // owns the chunks, which are looked up through _chunk_directory. Both are only modified under _chunk_lock.
   std::vector<std::shared_ptr<Chunk>> _chunks;
+  ChunkDirectory _chunk_directory;
+  // chunks that have been replaced by emplace_chunk or by their compressed version, kept for readers that may still
+  // use them
+  std::vector<std::shared_ptr<Chunk>> _replaced_chunks;
   std::vector<std::string> _col_names;
   std::vector<std::string> _col_types;
   mutable std::mutex _chunk_lock;
 
+  // the chunk that append_concurrently writes into, replaced once it is full
+  struct ConcurrentAppendChunk;
+  std::shared_ptr<ConcurrentAppendChunk> _concurrent_append_chunk;
+
+  std::atomic_bool _background_compression{true};
+  // zero if Bloom filters are disabled
+  std::atomic<double> _bloom_filter_false_positive_rate{0.0};
+  std::atomic<size_t> _pending_compression_count{0};
+  std::atomic<size_t> _completed_compression_count{0};
+  std::atomic<int64_t> _compression_bytes_saved{0};
+  // accessed with std::atomic_load and std::atomic_store, nullptr for the default heap
+  std::shared_ptr<std::pmr::memory_resource> _memory_resource;
+  std::vector<std::shared_ptr<AbstractTask>> _compression_tasks;
+  mutable std::mutex _compression_tasks_lock;
+  std::unique_ptr<TableStatistics> _statistics;
+
   void _add_segment_to_chunk(std::shared_ptr<Chunk> chunk, const std::string& type);
-  std::shared_ptr<Chunk> _compress_multithreaded(Chunk& uncompressed_chunk);
-  void _compress_column(Chunk& uncompressed_chunk, std::shared_ptr<Chunk>& compressed_chunk, ColumnID col_id) const;
-  Chunk& _get_chunk(ChunkID chunk_id) const;
+  // appends an empty chunk with a ValueSegment for every column
+  void _add_chunk();
+  std::shared_ptr<ConcurrentAppendChunk> _make_concurrent_append_chunk() const;
+  void _schedule_background_compression(const std::shared_ptr<Chunk>& chunk);
+  // compresses all columns of the chunk in parallel into a new chunk, which then replaces the chunk as a whole
+  void _compress_chunk(const std::shared_ptr<Chunk>& chunk, const EncodingType encoding);
+  // replaces the chunk by its compressed version, returns false if the chunk has been replaced in the meantime
+  bool _replace_chunk(const std::shared_ptr<Chunk>& chunk, const std::shared_ptr<Chunk>& compressed_chunk);
+  // compresses a segment of a chunk that is not published yet
+  // returns whether the segment has been compressed, i.e., whether it was still a ValueSegment
+  bool _compress_segment(Chunk& chunk, ColumnID column_id, const EncodingType encoding,
+                         const std::shared_ptr<std::pmr::memory_resource>& arena);
 };
 
 }  // namespace opossum
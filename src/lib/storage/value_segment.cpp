@@ -2,6 +2,7 @@
 
 #include <limits>
 #include <memory>
+#include <memory_resource>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -9,9 +10,24 @@
 
 #include "type_cast.hpp"
 #include "utils/assert.hpp"
+#include "utils/memory_usage.hpp"
 
 namespace opossum {
 
+template <typename T>
+ValueSegment<T>::ValueSegment(std::pmr::memory_resource* memory_resource) : _values(memory_resource) {}
+
+template <typename T>
+ValueSegment<T>::ValueSegment(const ChunkOffset size, std::pmr::memory_resource* memory_resource)
+    : _values(size, memory_resource) {}
+
+template <typename T>
+ValueSegment<T>::ValueSegment(pmr_vector<T>&& values) : _values(std::move(values)) {}
+
+template <typename T>
+ValueSegment<T>::ValueSegment(const std::vector<T>& values, std::pmr::memory_resource* memory_resource)
+    : _values(values.begin(), values.end(), memory_resource) {}
+
 template <typename T>
 AllTypeVariant ValueSegment<T>::operator[](const ChunkOffset chunk_offset) const {
   return _values.at(chunk_offset);
@@ -22,13 +38,29 @@ void ValueSegment<T>::append(const AllTypeVariant& val) {
   return _values.push_back(type_cast<T>(val));
 }
 
+template <typename T>
+void ValueSegment<T>::set(const ChunkOffset chunk_offset, const AllTypeVariant& val) {
+  DebugAssert(chunk_offset < _values.size(), "Position is out of range");
+  _values[chunk_offset] = type_cast<T>(val);
+}
+
+template <typename T>
+void ValueSegment<T>::resize(const ChunkOffset size) {
+  _values.resize(size);
+}
+
 template <typename T>
 ChunkOffset ValueSegment<T>::size() const {
   return _values.size();
 }
 
 template <typename T>
-const std::vector<T>& ValueSegment<T>::values() const {
+const pmr_vector<T>& ValueSegment<T>::values() const {
+  return _values;
+}
+
+template <typename T>
+pmr_vector<T>& ValueSegment<T>::values() {
   return _values;
 }
 
@@ -37,6 +69,11 @@ size_t ValueSegment<T>::estimate_memory_usage() const {
   return size() * sizeof(T);
 }
 
+template <typename T>
+size_t ValueSegment<T>::memory_usage() const {
+  return sizeof(*this) + heap_memory_usage(_values);
+}
+
 EXPLICITLY_INSTANTIATE_DATA_TYPES(ValueSegment);
 
 }  // namespace opossum
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <memory_resource>
 #include <string>
 #include <utility>
 #include <vector>
@@ -13,25 +14,54 @@ namespace opossum {
 template <typename T>
 class ValueSegment : public BaseSegment {
  public:
+  // creates an empty segment whose values are allocated from the given memory resource, which has to outlive the
+  // segment
+  explicit ValueSegment(std::pmr::memory_resource* memory_resource = std::pmr::get_default_resource());
+
+  // creates a segment with size default-initialized values, which can be overwritten with set
+  explicit ValueSegment(const ChunkOffset size,
+                        std::pmr::memory_resource* memory_resource = std::pmr::get_default_resource());
+
+  // creates a segment that takes over the given values and their memory resource, e.g., as a column batch for
+  // Table::append_columns
+  explicit ValueSegment(pmr_vector<T>&& values);
+
+  // creates a segment with a copy of the given values
+  explicit ValueSegment(const std::vector<T>& values,
+                        std::pmr::memory_resource* memory_resource = std::pmr::get_default_resource());
+
   // return the value at a certain position. If you want to write efficient operators, back off!
   AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
 
   // add a value to the end
   void append(const AllTypeVariant& val) final;
 
+  // overwrites the value at a certain position
+  // unlike append, this does not reallocate, so different positions can be written concurrently
+  void set(const ChunkOffset chunk_offset, const AllTypeVariant& val);
+
+  // shrinks or grows the segment to the given size, new values are default-initialized
+  void resize(const ChunkOffset size);
+
   // return the number of entries
   ChunkOffset size() const final;
 
   // Return all values. This is the preferred method to check a value at a certain index. Usually you need to
   // access more than a single value anyway.
   // e.g. const auto& values = value_segment.values(); and then: values[i]; in your loop.
-  const std::vector<T>& values() const;
+  const pmr_vector<T>& values() const;
+
+  // Returns all values for modification, e.g., to move them into or out of the segment in bulk. Do not use this on
+  // segments that other threads may read.
+  pmr_vector<T>& values();
 
   // returns the calculated memory usage
   size_t estimate_memory_usage() const final;
 
+  size_t memory_usage() const final;
+
  protected:
-  std::vector<T> _values;
+  pmr_vector<T> _values;
 };
 
 }  // namespace opossum
@@ -0,0 +1,105 @@
+#include "zone_map.hpp"
+
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include "dictionary_segment.hpp"
+#include "segment_iterate.hpp"
+#include "utils/assert.hpp"
+#include "utils/memory_usage.hpp"
+
+namespace opossum {
+
+template <typename T>
+ZoneMap<T>::ZoneMap(const T& min, const T& max) : _min{min}, _max{max} {
+  DebugAssert(!(max < min), "Minimum of a zone map must not exceed its maximum");
+}
+
+template <typename T>
+std::shared_ptr<ZoneMap<T>> ZoneMap<T>::from_segment(const BaseSegment& segment) {
+  Assert(segment.size() > 0, "Zone maps can only be created for non-empty segments");
+
+  if (const auto* dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+    const auto last_value_id = static_cast<ValueID>(dictionary_segment->unique_values_count() - 1);
+    return std::make_shared<ZoneMap<T>>(T{dictionary_segment->value_by_value_id(ValueID{0})},
+                                        T{dictionary_segment->value_by_value_id(last_value_id)});
+  }
+
+  auto min = T{};
+  auto max = T{};
+  auto is_first = true;
+  segment_iterate<T>(segment, [&](const SegmentPosition<T>& position) {
+    const auto& value = position.value();
+    if (is_first || value < min) min = value;
+    if (is_first || max < value) max = value;
+    is_first = false;
+  });
+  return std::make_shared<ZoneMap<T>>(min, max);
+}
+
+template <typename T>
+bool ZoneMap<T>::can_prune(const ScanType scan_type, const T& search_value) const {
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return search_value < _min || _max < search_value;
+    case ScanType::OpNotEquals:
+      return _min == search_value && _max == search_value;
+    case ScanType::OpLessThan:
+      return !(_min < search_value);
+    case ScanType::OpLessThanEquals:
+      return search_value < _min;
+    case ScanType::OpGreaterThan:
+      return !(search_value < _max);
+    case ScanType::OpGreaterThanEquals:
+      return _max < search_value;
+  }
+  Fail("Unsupported scan type");
+}
+
+template <typename T>
+bool ZoneMap<T>::matches_all(const ScanType scan_type, const T& search_value) const {
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return _min == search_value && _max == search_value;
+    case ScanType::OpNotEquals:
+      return search_value < _min || _max < search_value;
+    case ScanType::OpLessThan:
+      return _max < search_value;
+    case ScanType::OpLessThanEquals:
+      return !(search_value < _max);
+    case ScanType::OpGreaterThan:
+      return search_value < _min;
+    case ScanType::OpGreaterThanEquals:
+      return !(_min < search_value);
+  }
+  Fail("Unsupported scan type");
+}
+
+template <typename T>
+const T& ZoneMap<T>::min() const {
+  return _min;
+}
+
+template <typename T>
+const T& ZoneMap<T>::max() const {
+  return _max;
+}
+
+template <typename T>
+size_t ZoneMap<T>::estimate_memory_usage() const {
+  return 2 * sizeof(T);
+}
+
+template <typename T>
+size_t ZoneMap<T>::memory_usage() const {
+  if constexpr (std::is_same_v<T, std::string>) {
+    return sizeof(*this) + heap_memory_usage(_min) + heap_memory_usage(_max);
+  } else {
+    return sizeof(*this);
+  }
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(ZoneMap);
+
+}  // namespace opossum
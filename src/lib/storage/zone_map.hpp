@@ -0,0 +1,45 @@
+#pragma once
+
+#include <memory>
+
+#include "base_zone_map.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+
+// ZoneMap holds the smallest and the largest value of an immutable segment. Scans use it to skip whole chunks whose
+// value range cannot match their predicate, or to emit all rows of a chunk whose values all match, without touching
+// the segment. On tables that are partitioned by the scanned column, e.g., append-only tables with increasing
+// timestamps, range predicates only have to scan the few chunks at the boundaries of the range.
+//
+// As segments have no NULL values, there is no null count.
+template <typename T>
+class ZoneMap : public BaseZoneMap {
+ public:
+  ZoneMap(const T& min, const T& max);
+
+  // creates the zone map of a non-empty segment, e.g., right after it has been compressed. For DictionarySegments,
+  // these are the first and the last value of the sorted dictionary, other segments are iterated once.
+  static std::shared_ptr<ZoneMap<T>> from_segment(const BaseSegment& segment);
+
+  // returns whether no value of the segment can satisfy "value <scan_type> search_value"
+  bool can_prune(const ScanType scan_type, const T& search_value) const;
+
+  // returns whether all values of the segment satisfy "value <scan_type> search_value"
+  bool matches_all(const ScanType scan_type, const T& search_value) const;
+
+  const T& min() const;
+  const T& max() const;
+
+  size_t estimate_memory_usage() const final;
+
+  size_t memory_usage() const final;
+
+ protected:
+  const T _min;
+  const T _max;
+};
+
+}  // namespace opossum
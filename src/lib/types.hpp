@@ -3,6 +3,7 @@
 #include <cstdint>
 #include <iostream>
 #include <limits>
+#include <memory_resource>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -38,6 +39,10 @@ namespace opossum {
 using ChunkOffset = uint32_t;
 using AttributeVectorWidth = uint8_t;
 
+using TaskID = uint32_t;
+using WorkerID = uint32_t;
+using CpuID = uint32_t;
+
 struct RowID {
   ChunkID chunk_id;
   ChunkOffset chunk_offset;
@@ -54,8 +59,17 @@ struct RowID {
 
 enum class ScanType { OpEquals, OpNotEquals, OpLessThan, OpLessThanEquals, OpGreaterThan, OpGreaterThanEquals };
 
+// The encodings that Table::compress_chunk can apply to the ValueSegments of a chunk
+enum class EncodingType { Dictionary, RunLength, FrameOfReference, Delta, Fsst };
+
 using PosList = std::vector<RowID>;
 
+// vector whose memory comes from a std::pmr::memory_resource, e.g., the arena of a chunk (see MonotonicArena)
+template <typename T>
+using pmr_vector = std::pmr::vector<T>;
+
+constexpr ChunkID INVALID_CHUNK_ID{std::numeric_limits<ChunkID::base_type>::max()};
+
 // Prevents unnecessary, potentially expensive, copies by deleting copy constructor and copy assignment operator.
 class Noncopyable {
  protected:
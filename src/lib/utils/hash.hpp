@@ -0,0 +1,43 @@
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+namespace opossum {
+
+// Returns a 64-bit hash of the value whose bits are all well distributed, e.g., for Bloom filters and HyperLogLog
+// sketches, which take different bits of the same hash for different purposes.
+//
+// Bloom filters are persisted in binary files (see binary_format.hpp), so the hash must not depend on the standard
+// library like std::hash does. It is specified as follows: numbers are widened to their 64-bit pattern (signed
+// integers are sign-extended, -0.0 is hashed as 0.0), strings are hashed with 64-bit FNV-1a over their characters.
+// Both are then mixed with a splitmix64 step. Changing any of this requires a new binary format version.
+template <typename T>
+uint64_t mixed_hash(const T& value) {
+  auto hash = uint64_t{0};
+  if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+    hash = 0xcbf29ce484222325;
+    for (const auto character : std::string_view{value}) {
+      hash = (hash ^ static_cast<uint8_t>(character)) * 0x100000001b3;
+    }
+  } else if constexpr (std::is_floating_point_v<T>) {
+    // Adding 0.0 turns -0.0 into 0.0, which compares equal to it.
+    if constexpr (sizeof(T) == sizeof(uint32_t)) {
+      hash = std::bit_cast<uint32_t>(value + T{0});
+    } else {
+      hash = std::bit_cast<uint64_t>(value + T{0});
+    }
+  } else {
+    static_assert(std::is_integral_v<T>, "Only numbers and strings can be hashed");
+    hash = static_cast<uint64_t>(static_cast<std::conditional_t<std::is_signed_v<T>, int64_t, uint64_t>>(value));
+  }
+
+  hash += 0x9e3779b97f4a7c15;
+  hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9;
+  hash = (hash ^ (hash >> 27)) * 0x94d049bb133111eb;
+  return hash ^ (hash >> 31);
+}
+
+}  // namespace opossum
@@ -1,34 +1,261 @@
 #include "load_table.hpp"
 
-#include <fstream>
+#include <algorithm>
+#include <charconv>
+#include <cstring>
 #include <memory>
 #include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/dictionary_segment.hpp"
 #include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/zone_map.hpp"
+#include "utils/memory_mapped_file.hpp"
 
 namespace opossum {
 
-std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_size) {
-  std::ifstream infile(file_name);
-  Assert(infile.is_open(), "load_table: Could not find file " + file_name);
+namespace {
 
-  std::string line;
-  std::getline(infile, line);
-  std::vector<std::string> column_names = _split<std::string>(line, '|');
-  std::getline(infile, line);
-  std::vector<std::string> column_types = _split<std::string>(line, '|');
+// Files are split into at most four ranges per core, but ranges are not smaller than this, so that small files are
+// parsed by a single task.
+constexpr auto MIN_RANGE_SIZE = size_t{1} << 20;
 
-  std::shared_ptr<Table> test_table = std::make_shared<Table>(chunk_size);
-  for (auto column_id = ColumnID{0}; column_id < column_names.size(); column_id++) {
-    test_table->add_column(column_names[column_id], column_types[column_id]);
+// Buffers cannot grow beyond the chunk size, but large chunk sizes are not reserved upfront.
+constexpr auto MAX_RESERVED_ROW_COUNT = size_t{1} << 16;
+
+// Collects the parsed values of one column until a chunk is full.
+class BaseColumnBuffer {
+ public:
+  virtual ~BaseColumnBuffer() = default;
+
+  // parses the value in [begin, end) and appends it to the buffer
+  virtual void append(const char* begin, const char* end) = 0;
+
+  // appends the values of a ValueSegment that has been flushed from another buffer
+  virtual void append_segment(const BaseSegment& segment) = 0;
+
+  // moves the buffered values into a new segment at the end of the chunk
+  // if compress is set, the segment is dictionary-encoded and gets a zone map, as if the chunk had been compressed by
+  // the table
+  virtual void flush(Chunk& chunk, const bool compress) = 0;
+};
+
+template <typename T>
+class ColumnBuffer final : public BaseColumnBuffer {
+ public:
+  explicit ColumnBuffer(const size_t chunk_size) : _reserved_row_count{std::min(chunk_size, MAX_RESERVED_ROW_COUNT)} {
+    _values.reserve(_reserved_row_count);
+  }
+
+  void append(const char* begin, const char* end) final {
+    if constexpr (std::is_same_v<T, std::string>) {
+      _values.emplace_back(begin, end);
+    } else {
+      auto value = T{};
+      const auto result = std::from_chars(begin, end, value);
+      Assert(result.ec == std::errc{} && result.ptr == end,
+             "load_table: Could not parse '" + std::string(begin, end) + "' as a number");
+      _values.push_back(value);
+    }
+  }
+
+  void append_segment(const BaseSegment& segment) final {
+    const auto& values = static_cast<const ValueSegment<T>&>(segment).values();
+    _values.insert(_values.end(), values.begin(), values.end());
+  }
+
+  void flush(Chunk& chunk, const bool compress) final {
+    const auto segment = std::make_shared<ValueSegment<T>>(std::move(_values));
+    _values = pmr_vector<T>{};
+    _values.reserve(_reserved_row_count);
+
+    if (!compress) {
+      chunk.add_segment(segment);
+      return;
+    }
+    const auto column_id = ColumnID{chunk.column_count()};
+    const auto compressed_segment = std::make_shared<DictionarySegment<T>>(segment);
+    chunk.add_segment(compressed_segment);
+    // Only full chunks are compressed, so the segment is never empty.
+    chunk.set_zone_map(column_id, ZoneMap<T>::from_segment(*compressed_segment));
+  }
+
+ private:
+  const size_t _reserved_row_count;
+  pmr_vector<T> _values;
+};
+
+std::vector<std::unique_ptr<BaseColumnBuffer>> make_column_buffers(const std::vector<std::string>& column_types,
+                                                                   const size_t chunk_size) {
+  auto buffers = std::vector<std::unique_ptr<BaseColumnBuffer>>{};
+  for (const auto& column_type : column_types) {
+    resolve_data_type(column_type, [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      buffers.push_back(std::make_unique<ColumnBuffer<ColumnDataType>>(chunk_size));
+    });
+  }
+  return buffers;
+}
+
+// Returns the position after the next newline at or after position, or end if there is none.
+const char* next_line(const char* position, const char* end) {
+  const auto* newline = static_cast<const char*>(std::memchr(position, '\n', end - position));
+  return newline ? newline + 1 : end;
+}
+
+// Calls function(row_begin, values_end) for every row in [begin, end), i.e., for every line that is not empty, with
+// values_end pointing to the line break of the row.
+template <typename Function>
+void for_each_row(const char* begin, const char* end, const Function& function) {
+  auto position = begin;
+  while (position < end) {
+    const auto* row_end = next_line(position, end);
+    const auto* values_end = row_end;
+    while (values_end > position && (values_end[-1] == '\n' || values_end[-1] == '\r')) --values_end;
+    if (values_end > position) function(position, values_end);
+    position = row_end;
   }
+}
+
+// Parses the rows in [begin, end) into chunks, the first one of first_chunk_size rows and the following ones of
+// chunk_size rows. Only the first and the last chunk may be smaller than chunk_size, and only full chunks are
+// compressed.
+std::vector<std::shared_ptr<Chunk>> parse_rows(const char* begin, const char* end,
+                                               const std::vector<std::string>& column_types, const size_t chunk_size,
+                                               const size_t first_chunk_size, const bool compress) {
+  auto buffers = make_column_buffers(column_types, chunk_size);
+  auto chunks = std::vector<std::shared_ptr<Chunk>>{};
+  auto row_count = size_t{0};
+  auto target_row_count = first_chunk_size;
+  const auto flush_chunk = [&] {
+    const auto chunk = std::make_shared<Chunk>();
+    for (const auto& buffer : buffers) {
+      buffer->flush(*chunk, compress && row_count == chunk_size);
+    }
+    chunks.push_back(chunk);
+    row_count = 0;
+    target_row_count = chunk_size;
+  };
+
+  const auto column_count = buffers.size();
+  for_each_row(begin, end, [&](const char* position, const char* values_end) {
+    for (auto column_id = size_t{0}; column_id < column_count; ++column_id) {
+      const auto is_last_column = column_id + 1 == column_count;
+      const auto* value_end = is_last_column ? values_end : std::find(position, values_end, '|');
+      Assert(is_last_column || value_end != values_end, "load_table: Row has too few values");
+      // Numbers with a '|' fail to parse anyway, but strings would silently take the remaining values.
+      Assert(!is_last_column || std::find(position, values_end, '|') == values_end,
+             "load_table: Row has too many values");
+      buffers[column_id]->append(position, value_end);
+      position = value_end + 1;
+    }
+
+    if (++row_count == target_row_count) flush_chunk();
+  });
+  if (row_count > 0) flush_chunk();
+
+  return chunks;
+}
+
+}  // namespace
+
+std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_size, bool compress) {
+  const auto file = MemoryMappedFile{file_name};
+  Assert(file.size() > 0, "load_table: " + file_name + " is empty");
+  const auto* const file_end = file.data() + file.size();
+
+  const auto* const column_types_begin = next_line(file.data(), file_end);
+  const auto* const rows_begin = next_line(column_types_begin, file_end);
+  const auto header_line = [](const char* begin, const char* end) {
+    while (end > begin && (end[-1] == '\n' || end[-1] == '\r')) --end;
+    return std::string(begin, end);
+  };
+  const auto column_names = _split<std::string>(header_line(file.data(), column_types_begin), '|');
+  const auto column_types = _split<std::string>(header_line(column_types_begin, rows_begin), '|');
+  Assert(column_names.size() == column_types.size(), "load_table: Header of " + file_name + " is malformed");
 
-  while (std::getline(infile, line)) {
-    std::vector<AllTypeVariant> values = _split<AllTypeVariant>(line, '|');
-    test_table->append(values);
+  // Split the rows into ranges that end at line breaks.
+  const auto rows_size = static_cast<size_t>(file_end - rows_begin);
+  const auto range_count =
+      std::max(size_t{1}, std::min(rows_size / MIN_RANGE_SIZE, size_t{std::thread::hardware_concurrency()} * 4));
+  auto range_bounds = std::vector<std::pair<const char*, const char*>>{};
+  auto range_begin = rows_begin;
+  for (auto range_index = size_t{0}; range_index < range_count; ++range_index) {
+    const auto* const range_end =
+        range_index + 1 == range_count
+            ? file_end
+            : std::max(range_begin, next_line(rows_begin + rows_size * (range_index + 1) / range_count, file_end));
+    range_bounds.emplace_back(range_begin, range_end);
+    range_begin = range_end;
   }
-  return test_table;
+
+  // Count the rows of all ranges first, so that every range can end its first chunk where a chunk of the table ends.
+  // Then, all chunks that are parsed in parallel are full, except for the first and the last chunk of each range.
+  auto range_row_counts = std::vector<size_t>(range_count);
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto range_index = size_t{0}; range_index < range_count; ++range_index) {
+    tasks.push_back(std::make_shared<JobTask>([&, range_index] {
+      const auto [begin, end] = range_bounds[range_index];
+      for_each_row(begin, end, [&](const char*, const char*) { ++range_row_counts[range_index]; });
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+
+  auto range_chunks = std::vector<std::vector<std::shared_ptr<Chunk>>>(range_count);
+  tasks.clear();
+  auto range_first_row = size_t{0};
+  for (auto range_index = size_t{0}; range_index < range_count; ++range_index) {
+    const auto first_chunk_size = chunk_size - range_first_row % chunk_size;
+    tasks.push_back(std::make_shared<JobTask>([&, range_index, first_chunk_size] {
+      const auto [begin, end] = range_bounds[range_index];
+      range_chunks[range_index] = parse_rows(begin, end, column_types, chunk_size, first_chunk_size, compress);
+    }));
+    range_first_row += range_row_counts[range_index];
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+
+  auto table = std::make_shared<Table>(chunk_size);
+  for (auto column_id = size_t{0}; column_id < column_names.size(); ++column_id) {
+    table->add_column(column_names[column_id], column_types[column_id]);
+  }
+
+  // Merge the partial chunks at the ends of the ranges into full ones, so that only the last chunk is not full.
+  auto buffers = make_column_buffers(column_types, chunk_size);
+  auto buffered_row_count = size_t{0};
+  const auto flush_buffers = [&] {
+    const auto chunk = std::make_shared<Chunk>();
+    for (const auto& buffer : buffers) {
+      buffer->flush(*chunk, compress && buffered_row_count == chunk_size);
+    }
+    table->emplace_chunk(chunk);
+    buffered_row_count = 0;
+  };
+  for (const auto& chunks : range_chunks) {
+    for (const auto& chunk : chunks) {
+      if (chunk->size() == chunk_size) {
+        DebugAssert(buffered_row_count == 0, "Partial chunks of the ranges do not add up to full chunks");
+        table->emplace_chunk(chunk);
+        continue;
+      }
+      for (auto column_id = ColumnID{0}; column_id < buffers.size(); ++column_id) {
+        buffers[column_id]->append_segment(*chunk->get_segment(column_id));
+      }
+      buffered_row_count += chunk->size();
+      if (buffered_row_count == chunk_size) flush_buffers();
+    }
+  }
+  if (buffered_row_count > 0) flush_buffers();
+
+  // Chunks that are compressed while loading are covered by the statistics, as if the table had compressed them.
+  if (compress) table->update_statistics();
+  return table;
 }
 
 }  // namespace opossum
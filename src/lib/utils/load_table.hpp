@@ -22,7 +22,12 @@ std::vector<T> _split(const std::string& str, char delimiter) {
   return internal;
 }
 
-// This is a helper method which is heavily used in our test suite
-std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_size);
+// Loads a table from a .tbl file, whose first two lines hold the column names and types, separated by '|'.
+// The file is memory-mapped and split into ranges at line breaks, which are parsed in parallel into chunks of their
+// own. The rows of each range are counted upfront, so that the ranges start and end their chunks where the chunks of
+// the table do. Only the partial chunks at the range boundaries are merged afterwards, and, as with append, only the
+// last chunk of the table may not be full. If compress is set, full chunks are dictionary-encoded while the remaining
+// rows are still being parsed, and they get zone maps and are covered by the statistics of the table.
+std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_size, bool compress = false);
 
 }  // namespace opossum
@@ -0,0 +1,40 @@
+#include "memory_mapped_file.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <string>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+MemoryMappedFile::MemoryMappedFile(const std::string& file_name) {
+  const auto file_descriptor = open(file_name.c_str(), O_RDONLY);
+  Assert(file_descriptor >= 0, "Could not open file " + file_name);
+
+  struct stat file_status {};
+  const auto stat_result = fstat(file_descriptor, &file_status);
+  _size = static_cast<size_t>(file_status.st_size);
+  if (stat_result == 0 && _size > 0) {
+    auto* const data = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+    if (data != MAP_FAILED) _data = static_cast<const char*>(data);
+  }
+  // The mapping stays valid after the file is closed.
+  close(file_descriptor);
+
+  Assert(stat_result == 0, "Could not determine the size of file " + file_name);
+  Assert(_size == 0 || _data, "Could not map file " + file_name);
+}
+
+MemoryMappedFile::~MemoryMappedFile() {
+  if (_data) munmap(const_cast<char*>(_data), _size);
+}
+
+const char* MemoryMappedFile::data() const { return _data; }
+
+size_t MemoryMappedFile::size() const { return _size; }
+
+}  // namespace opossum
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// Maps a file read-only into memory for as long as the object lives. Empty files are not mapped, data() is nullptr
+// for them.
+class MemoryMappedFile : private Noncopyable {
+ public:
+  explicit MemoryMappedFile(const std::string& file_name);
+  ~MemoryMappedFile();
+
+  const char* data() const;
+  size_t size() const;
+
+ protected:
+  const char* _data = nullptr;
+  size_t _size = 0;
+};
+
+}  // namespace opossum
@@ -0,0 +1,103 @@
+#include "memory_resources.hpp"
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#endif
+
+#include <algorithm>
+#include <filesystem>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+MonotonicArena::MonotonicArena(std::shared_ptr<std::pmr::memory_resource> upstream, const size_t initial_block_size)
+    : _upstream{std::move(upstream)},
+      _buffer{std::max(initial_block_size, size_t{1}), _upstream ? _upstream.get() : std::pmr::new_delete_resource()} {}
+
+size_t MonotonicArena::allocated_bytes() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _allocated_bytes;
+}
+
+void* MonotonicArena::do_allocate(size_t bytes, size_t alignment) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _allocated_bytes += bytes;
+  return _buffer.allocate(bytes, alignment);
+}
+
+void MonotonicArena::do_deallocate(void* /*pointer*/, size_t /*bytes*/, size_t /*alignment*/) {}
+
+bool MonotonicArena::do_is_equal(const std::pmr::memory_resource& other) const noexcept { return this == &other; }
+
+PageMemoryResource::PageMemoryResource(const bool use_huge_pages, const std::optional<uint32_t> numa_node)
+    : _use_huge_pages{use_huge_pages}, _numa_node{numa_node} {
+#ifdef __linux__
+  Assert(!numa_node || std::filesystem::exists("/sys/devices/system/node/node" + std::to_string(*numa_node)),
+         "NUMA node does not exist");
+#else
+  Assert(!numa_node, "Binding memory to NUMA nodes is only supported on Linux");
+#endif
+}
+
+bool PageMemoryResource::uses_huge_pages() const { return _use_huge_pages; }
+
+const std::optional<uint32_t>& PageMemoryResource::numa_node() const { return _numa_node; }
+
+size_t PageMemoryResource::_mapped_size(const size_t bytes) const {
+  const auto page_size = _use_huge_pages && bytes >= HUGE_PAGE_SIZE ? HUGE_PAGE_SIZE
+                                                                     : static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  return (bytes + page_size - 1) / page_size * page_size;
+}
+
+void* PageMemoryResource::do_allocate(size_t bytes, size_t alignment) {
+  if (bytes < MIN_MAPPED_SIZE) return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  Assert(alignment <= static_cast<size_t>(sysconf(_SC_PAGESIZE)), "Mapped memory is only aligned to pages");
+
+  const auto mapped_size = _mapped_size(bytes);
+  auto* const pointer = mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (pointer == MAP_FAILED) throw std::bad_alloc{};
+
+#ifdef __linux__
+  // Transparent huge pages are only a hint, the kernel may still use regular pages.
+  if (_use_huge_pages && bytes >= HUGE_PAGE_SIZE) madvise(pointer, mapped_size, MADV_HUGEPAGE);
+
+  // The policy applies before the pages are touched for the first time, i.e., before they are allocated.
+  if (_numa_node) {
+    // The kernel reads only maxnode - 1 bits of the mask, so maxnode is one more than the bits of the mask words.
+    auto node_mask = std::vector<uint64_t>(*_numa_node / 64 + 1);
+    node_mask.back() = uint64_t{1} << (*_numa_node % 64);
+    const auto max_node = node_mask.size() * 64 + 1;
+    if (syscall(SYS_mbind, pointer, mapped_size, MPOL_BIND, node_mask.data(), max_node, 0) != 0) {
+      munmap(pointer, mapped_size);
+      throw std::bad_alloc{};
+    }
+  }
+#endif
+  return pointer;
+}
+
+void PageMemoryResource::do_deallocate(void* pointer, size_t bytes, size_t alignment) {
+  if (bytes < MIN_MAPPED_SIZE) return std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+  munmap(pointer, _mapped_size(bytes));
+}
+
+bool PageMemoryResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+  // Mapped memory can be unmapped by every instance, but the forwarded allocations use the same default heap.
+  const auto* const other_resource = dynamic_cast<const PageMemoryResource*>(&other);
+  return other_resource && other_resource->_use_huge_pages == _use_huge_pages;
+}
+
+}  // namespace opossum
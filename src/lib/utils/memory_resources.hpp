@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
+
+namespace opossum {
+
+// MonotonicArena hands out memory from a few large blocks of an upstream resource and releases all of them at once
+// when it is destroyed, like std::pmr::monotonic_buffer_resource. Unlike the latter, it can be used by several threads
+// at the same time, e.g., by the parallel compressions of the columns of a chunk.
+//
+// The segments of an immutable chunk are allocated from one arena, so that they lie next to each other instead of
+// being spread over the heap, and their memory is returned in one piece. Deallocating single objects is a no-op, so
+// arenas should only hold containers that do not grow. Objects that allocate from an arena keep it alive through a
+// std::shared_ptr, which in turn keeps the upstream resource alive.
+class MonotonicArena : public std::pmr::memory_resource {
+ public:
+  explicit MonotonicArena(std::shared_ptr<std::pmr::memory_resource> upstream = nullptr,
+                          const size_t initial_block_size = 4096);
+
+  // returns the number of bytes that have been handed out, without alignment padding and unused parts of the blocks
+  size_t allocated_bytes() const;
+
+ protected:
+  void* do_allocate(size_t bytes, size_t alignment) final;
+  void do_deallocate(void* pointer, size_t bytes, size_t alignment) final;
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept final;
+
+  const std::shared_ptr<std::pmr::memory_resource> _upstream;
+  std::pmr::monotonic_buffer_resource _buffer;
+  size_t _allocated_bytes = 0;
+  mutable std::mutex _mutex;
+};
+
+// PageMemoryResource maps every allocation of at least MIN_MAPPED_SIZE bytes as separate pages, which are returned to
+// the operating system when they are deallocated. Smaller allocations are forwarded to the default heap. It is meant as
+// the upstream resource of arenas for large tables (see Table::set_memory_resource), which request few large blocks.
+//
+// With huge pages, allocations of at least HUGE_PAGE_SIZE bytes are rounded up to whole huge pages and the kernel is
+// advised to back them with transparent huge pages, which reduces TLB misses when scanning them. With a NUMA node, the
+// pages are bound to the memory of that node, e.g., for tables that are scanned by the workers of that node. Both are
+// only supported on Linux.
+class PageMemoryResource : public std::pmr::memory_resource {
+ public:
+  static constexpr auto MIN_MAPPED_SIZE = size_t{1} << 16;
+  static constexpr auto HUGE_PAGE_SIZE = size_t{1} << 21;
+
+  explicit PageMemoryResource(const bool use_huge_pages = false,
+                              const std::optional<uint32_t> numa_node = std::nullopt);
+
+  bool uses_huge_pages() const;
+  const std::optional<uint32_t>& numa_node() const;
+
+ protected:
+  // returns the size of the mapping for an allocation of the given size
+  size_t _mapped_size(const size_t bytes) const;
+
+  void* do_allocate(size_t bytes, size_t alignment) final;
+  void do_deallocate(void* pointer, size_t bytes, size_t alignment) final;
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept final;
+
+  const bool _use_huge_pages;
+  const std::optional<uint32_t> _numa_node;
+};
+
+}  // namespace opossum
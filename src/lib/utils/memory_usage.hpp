@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace opossum {
+
+// Estimated size of the control block that std::make_shared allocates together with an object, i.e., a vtable pointer
+// and the two reference counts as in libstdc++. Other standard libraries may differ. Owners of objects held by
+// std::shared_ptr add it to the memory usage of the object.
+constexpr auto SHARED_POINTER_CONTROL_BLOCK_SIZE = sizeof(void*) + 2 * sizeof(int32_t);
+
+// Estimated size of the control block of a std::shared_ptr that is created from a raw pointer, e.g., with a custom
+// deleter. It is allocated separately from the object and additionally holds the pointer and the deleter.
+template <typename Deleter>
+constexpr size_t separate_shared_pointer_control_block_size() {
+  return SHARED_POINTER_CONTROL_BLOCK_SIZE + sizeof(void*) + sizeof(Deleter);
+}
+
+// Returns the bytes a string allocates on the heap, which is zero for short strings that are stored inside the string
+// object itself (small string optimization)
+inline size_t heap_memory_usage(const std::string& value) {
+  const auto data = reinterpret_cast<uintptr_t>(value.data());
+  const auto object = reinterpret_cast<uintptr_t>(&value);
+  if (data >= object && data < object + sizeof(value)) return 0;
+  return value.capacity() + 1;
+}
+
+// Returns the bytes a vector allocates on the heap, including its unused capacity and the heap-allocated characters of
+// strings
+template <typename T, typename Allocator>
+size_t heap_memory_usage(const std::vector<T, Allocator>& values) {
+  auto memory_usage = values.capacity() * sizeof(T);
+  if constexpr (std::is_same_v<T, std::string>) {
+    for (const auto& value : values) {
+      memory_usage += heap_memory_usage(value);
+    }
+  }
+  return memory_usage;
+}
+
+}  // namespace opossum
@@ -0,0 +1,42 @@
+#include <memory>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/get_table.hpp"
+#include "../lib/storage/storage_manager.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsGetTableTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(2);
+    StorageManager::get().add_table("aNiceTestTable", _table);
+  }
+
+  void TearDown() override { StorageManager::get().reset(); }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(OperatorsGetTableTest, GetOutput) {
+  auto get_table = std::make_shared<GetTable>("aNiceTestTable");
+  get_table->execute();
+  EXPECT_EQ(get_table->table_name(), "aNiceTestTable");
+  EXPECT_EQ(get_table->get_output(), _table);
+}
+
+TEST_F(OperatorsGetTableTest, ThrowsUnknownTableName) {
+  auto get_table = std::make_shared<GetTable>("anUglyTestTable");
+  EXPECT_THROW(get_table->execute(), std::exception);
+}
+
+TEST_F(OperatorsGetTableTest, ExecuteOnlyOnce) {
+  auto get_table = std::make_shared<GetTable>("aNiceTestTable");
+  get_table->execute();
+  EXPECT_THROW(get_table->execute(), std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,350 @@
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/fsst_segment.hpp"
+#include "../lib/storage/reference_segment.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/zone_map.hpp"
+#include "../lib/utils/load_table.hpp"
+
+namespace opossum {
+
+class OperatorsTableScanTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(4);
+    // The tests compress chunks explicitly to cover both value and dictionary segments.
+    _table->set_background_compression(false);
+    _table->add_column("a", "int");
+    _table->add_column("b", "string");
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+
+    // Three full chunks and a partial one. The values contain duplicates and gaps, so that search values can be
+    // contained in a segment, lie between two values, or be outside of the segment's value range.
+    for (auto row = 0; row < 14; ++row) {
+      const auto value = (row * 7) % 10;
+      _values.push_back(value);
+      _table->append({value, "v" + std::to_string(value)});
+    }
+  }
+
+  // Returns the concatenated positions of an output table, checking that all its segments reference the given table.
+  static PosList _referenced_positions(const Table& table, const std::shared_ptr<const Table>& referenced_table) {
+    auto positions = PosList{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto& chunk = table.get_chunk(chunk_id);
+      if (chunk.size() == 0) continue;
+
+      const auto first_segment = std::dynamic_pointer_cast<ReferenceSegment>(chunk.get_segment(ColumnID{0}));
+      EXPECT_TRUE(first_segment);
+      for (auto column_id = ColumnID{0}; column_id < chunk.column_count(); ++column_id) {
+        const auto segment = std::dynamic_pointer_cast<ReferenceSegment>(chunk.get_segment(column_id));
+        EXPECT_EQ(segment->referenced_table(), referenced_table);
+        EXPECT_EQ(segment->referenced_column_id(), column_id);
+        EXPECT_EQ(segment->pos_list(), first_segment->pos_list());
+      }
+      positions.insert(positions.end(), first_segment->pos_list()->begin(), first_segment->pos_list()->end());
+    }
+    return positions;
+  }
+
+  // Checks the scan result against the naive evaluation of the predicate on all rows.
+  void _expect_scan_result(const ColumnID column_id, const ScanType scan_type, const int32_t search_value) {
+    const auto search_variant = column_id == ColumnID{0} ? AllTypeVariant{search_value}
+                                                         : AllTypeVariant{"v" + std::to_string(search_value)};
+    auto table_scan = TableScan{_table_wrapper, column_id, scan_type, search_variant};
+    table_scan.execute();
+
+    auto expected_pos_list = PosList{};
+    for (auto row = size_t{0}; row < _values.size(); ++row) {
+      const auto value = _values[row];
+      auto matches = false;
+      switch (scan_type) {
+        case ScanType::OpEquals:
+          matches = value == search_value;
+          break;
+        case ScanType::OpNotEquals:
+          matches = value != search_value;
+          break;
+        case ScanType::OpLessThan:
+          matches = value < search_value;
+          break;
+        case ScanType::OpLessThanEquals:
+          matches = value <= search_value;
+          break;
+        case ScanType::OpGreaterThan:
+          matches = value > search_value;
+          break;
+        case ScanType::OpGreaterThanEquals:
+          matches = value >= search_value;
+          break;
+      }
+      if (matches) {
+        expected_pos_list.push_back(RowID{ChunkID{static_cast<uint32_t>(row / 4)}, static_cast<ChunkOffset>(row % 4)});
+      }
+    }
+
+    EXPECT_EQ(_referenced_positions(*table_scan.get_output(), _table), expected_pos_list)
+        << "column " << column_id << ", scan type " << static_cast<int>(scan_type) << ", value " << search_value;
+  }
+
+  void _expect_all_scan_results() {
+    const auto scan_types = {ScanType::OpEquals,         ScanType::OpNotEquals,   ScanType::OpLessThan,
+                             ScanType::OpLessThanEquals, ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals};
+    for (const auto scan_type : scan_types) {
+      for (auto search_value = -1; search_value <= 10; ++search_value) {
+        _expect_scan_result(ColumnID{0}, scan_type, search_value);
+      }
+      // Single digits compare the same as strings and as numbers.
+      for (auto search_value = 0; search_value <= 9; ++search_value) {
+        _expect_scan_result(ColumnID{1}, scan_type, search_value);
+      }
+    }
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+  std::vector<int32_t> _values;
+};
+
+TEST_F(OperatorsTableScanTest, ScanValueSegments) { _expect_all_scan_results(); }
+
+TEST_F(OperatorsTableScanTest, ScanDictionarySegments) {
+  _table->compress_chunk(ChunkID{0});
+  _table->compress_chunk(ChunkID{2});
+  _expect_all_scan_results();
+}
+
+TEST_F(OperatorsTableScanTest, ScanDictionarySegmentsWithBloomFilters) {
+  _table->set_bloom_filter_false_positive_rate(0.01);
+  _table->compress_chunk(ChunkID{0});
+  _table->compress_chunk(ChunkID{1});
+  const auto segment =
+      std::dynamic_pointer_cast<DictionarySegment<int32_t>>(_table->get_chunk(ChunkID{0}).get_segment(ColumnID{0}));
+  ASSERT_TRUE(segment);
+  EXPECT_TRUE(segment->bloom_filter());
+  _expect_all_scan_results();
+}
+
+TEST_F(OperatorsTableScanTest, ScanRunLengthSegments) {
+  _table->compress_chunk(ChunkID{1}, EncodingType::RunLength);
+  _table->compress_chunk(ChunkID{2});
+  _expect_all_scan_results();
+}
+
+TEST_F(OperatorsTableScanTest, ScanFrameOfReferenceSegments) {
+  // The string column falls back to dictionary encoding.
+  _table->compress_chunk(ChunkID{0}, EncodingType::FrameOfReference);
+  _table->compress_chunk(ChunkID{2}, EncodingType::FrameOfReference);
+  EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<std::string>>(
+      _table->get_chunk(ChunkID{0}).get_segment(ColumnID{1})));
+  _expect_all_scan_results();
+}
+
+TEST_F(OperatorsTableScanTest, ScanLargeFrameOfReferenceSegment) {
+  // Frames whose value ranges lie below, around, and above the search values.
+  auto table = std::make_shared<Table>(10'000);
+  table->set_background_compression(false);
+  table->add_column("a", "long");
+  for (auto row = int64_t{0}; row < 10'000; ++row) {
+    table->append({row * 100 + row % 7});
+  }
+  table->compress_chunk(ChunkID{0}, EncodingType::FrameOfReference);
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  for (const auto& [scan_type, search_value, expected_count] :
+       std::vector<std::tuple<ScanType, int64_t, size_t>>{{ScanType::OpLessThan, 300'003, 3000},
+                                                          {ScanType::OpGreaterThanEquals, 300'003, 7000},
+                                                          {ScanType::OpEquals, 500'002, 1},
+                                                          {ScanType::OpNotEquals, 500'006, 10'000},
+                                                          {ScanType::OpLessThanEquals, -1, 0},
+                                                          {ScanType::OpGreaterThan, int64_t{1} << 40, 0}}) {
+    auto table_scan = TableScan{table_wrapper, ColumnID{0}, scan_type, search_value};
+    table_scan.execute();
+    EXPECT_EQ(table_scan.get_output()->row_count(), expected_count) << search_value;
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanDeltaSegments) {
+  _table->compress_chunk(ChunkID{1}, EncodingType::Delta);
+  _table->compress_chunk(ChunkID{2}, EncodingType::Delta);
+  _expect_all_scan_results();
+}
+
+TEST_F(OperatorsTableScanTest, ScanFsstSegments) {
+  // The int column falls back to dictionary encoding.
+  _table->compress_chunk(ChunkID{0}, EncodingType::Fsst);
+  _table->compress_chunk(ChunkID{2}, EncodingType::Fsst);
+  EXPECT_TRUE(std::dynamic_pointer_cast<FsstSegment>(_table->get_chunk(ChunkID{0}).get_segment(ColumnID{1})));
+  EXPECT_TRUE(
+      std::dynamic_pointer_cast<DictionarySegment<int32_t>>(_table->get_chunk(ChunkID{0}).get_segment(ColumnID{0})));
+  _expect_all_scan_results();
+}
+
+TEST_F(OperatorsTableScanTest, ScanSortedDeltaSegment) {
+  // Sorted values with duplicates that span blocks of the segment.
+  auto table = std::make_shared<Table>(1000);
+  table->set_background_compression(false);
+  table->add_column("a", "int");
+  auto values = std::vector<int32_t>{};
+  for (auto row = 0; row < 1000; ++row) {
+    values.push_back(row / 300 * 10);
+    table->append({values.back()});
+  }
+  table->compress_chunk(ChunkID{0}, EncodingType::Delta);
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto scan_types = {ScanType::OpEquals,         ScanType::OpNotEquals,   ScanType::OpLessThan,
+                           ScanType::OpLessThanEquals, ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals};
+  for (const auto scan_type : scan_types) {
+    for (const auto search_value : {-1, 0, 5, 10, 30, 31}) {
+      auto table_scan = TableScan{table_wrapper, ColumnID{0}, scan_type, search_value};
+      table_scan.execute();
+
+      auto expected_pos_list = PosList{};
+      for (auto row = ChunkOffset{0}; row < values.size(); ++row) {
+        const auto value = values[row];
+        const auto matches = (scan_type == ScanType::OpEquals && value == search_value) ||
+                             (scan_type == ScanType::OpNotEquals && value != search_value) ||
+                             (scan_type == ScanType::OpLessThan && value < search_value) ||
+                             (scan_type == ScanType::OpLessThanEquals && value <= search_value) ||
+                             (scan_type == ScanType::OpGreaterThan && value > search_value) ||
+                             (scan_type == ScanType::OpGreaterThanEquals && value >= search_value);
+        if (matches) expected_pos_list.push_back(RowID{ChunkID{0}, row});
+      }
+      EXPECT_EQ(_referenced_positions(*table_scan.get_output(), table), expected_pos_list)
+          << "scan type " << static_cast<int>(scan_type) << ", value " << search_value;
+    }
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanSortedRunLengthSegment) {
+  // Runs that span block boundaries of the value segment scan.
+  auto table = std::make_shared<Table>(3000);
+  table->set_background_compression(false);
+  table->add_column("a", "int");
+  for (auto row = 0; row < 3000; ++row) {
+    table->append({row / 700});
+  }
+  table->compress_chunk(ChunkID{0}, EncodingType::RunLength);
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto table_scan = TableScan{table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 3};
+  table_scan.execute();
+  const auto pos_list = _referenced_positions(*table_scan.get_output(), table);
+  ASSERT_EQ(pos_list.size(), 900u);
+  EXPECT_EQ(pos_list.front(), (RowID{ChunkID{0}, 2100}));
+  EXPECT_EQ(pos_list.back(), (RowID{ChunkID{0}, 2999}));
+}
+
+TEST_F(OperatorsTableScanTest, ScanLargeSegments) {
+  // More rows than fit into one block of the scan, with a bit-packed attribute vector in the compressed chunk.
+  auto table = std::make_shared<Table>(3000);
+  table->add_column("a", "int");
+  for (auto row = 0; row < 4500; ++row) {
+    table->append({row % 100});
+  }
+  table->compress_chunk(ChunkID{0});
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto table_scan = TableScan{table_wrapper, ColumnID{0}, ScanType::OpLessThan, 10};
+  table_scan.execute();
+  const auto pos_list = _referenced_positions(*table_scan.get_output(), table);
+  ASSERT_EQ(pos_list.size(), 450u);
+  EXPECT_EQ(pos_list[0], (RowID{ChunkID{0}, 0}));
+  EXPECT_EQ(pos_list[10], (RowID{ChunkID{0}, 100}));
+  EXPECT_EQ(pos_list[449], (RowID{ChunkID{1}, 1409}));
+}
+
+TEST_F(OperatorsTableScanTest, ScanUsesZoneMaps) {
+  // Increasing values, so that every chunk covers a distinct range
+  auto table = std::make_shared<Table>(100);
+  table->set_background_compression(false);
+  table->add_column("a", "int");
+  for (auto row = 0; row < 450; ++row) {
+    table->append({row});
+  }
+  for (auto chunk_id = ChunkID{0}; chunk_id < 4; ++chunk_id) {
+    table->compress_chunk(chunk_id);
+  }
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto table_scan = TableScan{table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 150};
+  table_scan.execute();
+  const auto pos_list = _referenced_positions(*table_scan.get_output(), table);
+  ASSERT_EQ(pos_list.size(), 300u);
+  EXPECT_EQ(pos_list.front(), (RowID{ChunkID{1}, 50}));
+  EXPECT_EQ(pos_list.back(), (RowID{ChunkID{4}, 49}));
+
+  // The scan trusts the zone maps without reading the segments: chunk 2 is skipped, and all rows of chunk 3 match.
+  table->get_chunk(ChunkID{2}).set_zone_map(ColumnID{0}, std::make_shared<ZoneMap<int32_t>>(0, 10));
+  table->get_chunk(ChunkID{3}).set_zone_map(ColumnID{0}, std::make_shared<ZoneMap<int32_t>>(1000, 1100));
+  auto pruned_scan = TableScan{table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 150};
+  pruned_scan.execute();
+  EXPECT_EQ(_referenced_positions(*pruned_scan.get_output(), table).size(), 200u);
+}
+
+TEST_F(OperatorsTableScanTest, ChainedScansReferenceOriginalTable) {
+  _table->compress_chunk(ChunkID{1});
+
+  auto first_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 2);
+  first_scan->execute();
+  auto second_scan = std::make_shared<TableScan>(first_scan, ColumnID{1}, ScanType::OpLessThan, "v7");
+  second_scan->execute();
+
+  // Rows with 2 < a < 7 in the order of the original table.
+  auto expected_pos_list = PosList{};
+  for (auto row = size_t{0}; row < _values.size(); ++row) {
+    if (_values[row] > 2 && _values[row] < 7) {
+      expected_pos_list.push_back(RowID{ChunkID{static_cast<uint32_t>(row / 4)}, static_cast<ChunkOffset>(row % 4)});
+    }
+  }
+  EXPECT_EQ(_referenced_positions(*second_scan->get_output(), _table), expected_pos_list);
+  EXPECT_EQ(second_scan->get_output()->row_count(), expected_pos_list.size());
+}
+
+TEST_F(OperatorsTableScanTest, ScanWithoutMatches) {
+  auto first_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 100);
+  first_scan->execute();
+  EXPECT_EQ(first_scan->get_output()->row_count(), 0u);
+  EXPECT_EQ(first_scan->get_output()->column_count(), 2u);
+
+  auto second_scan = std::make_shared<TableScan>(first_scan, ColumnID{0}, ScanType::OpEquals, 1);
+  second_scan->execute();
+  EXPECT_EQ(second_scan->get_output()->row_count(), 0u);
+}
+
+TEST_F(OperatorsTableScanTest, ScanTableFromFile) {
+  const auto table = load_table("src/test/tables/int_float.tbl", 2);
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto first_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 1234);
+  first_scan->execute();
+  EXPECT_TABLE_EQ(first_scan->get_output(), load_table("src/test/tables/int_float_filtered2.tbl", 1));
+
+  auto second_scan = std::make_shared<TableScan>(first_scan, ColumnID{1}, ScanType::OpLessThan, 458.0f);
+  second_scan->execute();
+  EXPECT_TABLE_EQ(second_scan->get_output(), load_table("src/test/tables/int_float_filtered.tbl", 1));
+}
+
+TEST_F(OperatorsTableScanTest, OutputBeforeExecute) {
+  const auto table_scan = TableScan{_table_wrapper, ColumnID{0}, ScanType::OpEquals, 1};
+  EXPECT_THROW(table_scan.get_output(), std::logic_error);
+}
+
+}  // namespace opossum
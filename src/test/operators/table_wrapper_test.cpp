@@ -0,0 +1,31 @@
+#include <memory>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsTableWrapperTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(2);
+    _table->add_column("a", "int");
+    _table->append({1});
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(OperatorsTableWrapperTest, GetOutput) {
+  auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  EXPECT_THROW(table_wrapper->get_output(), std::logic_error);
+  table_wrapper->execute();
+  EXPECT_EQ(table_wrapper->get_output(), _table);
+  EXPECT_EQ(table_wrapper->input_left(), nullptr);
+  EXPECT_EQ(table_wrapper->input_right(), nullptr);
+}
+
+}  // namespace opossum
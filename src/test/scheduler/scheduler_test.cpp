@@ -0,0 +1,228 @@
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/scheduler/current_scheduler.hpp"
+#include "../lib/scheduler/immediate_execution_scheduler.hpp"
+#include "../lib/scheduler/job_task.hpp"
+#include "../lib/scheduler/node_queue_scheduler.hpp"
+#include "../lib/scheduler/operator_task.hpp"
+#include "../lib/scheduler/task_queue.hpp"
+#include "../lib/scheduler/worker.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class SchedulerTest : public BaseTest {
+ protected:
+  void TearDown() override { CurrentScheduler::set(std::make_shared<NodeQueueScheduler>()); }
+
+  // Creates a diamond of tasks: a before b and c, both before d. Each task appends its name to _execution_order.
+  std::vector<std::shared_ptr<AbstractTask>> _make_diamond() {
+    const auto make_task = [&](const char name) {
+      return std::make_shared<JobTask>([&, name] {
+        std::lock_guard<std::mutex> lock(_execution_order_mutex);
+        _execution_order.push_back(name);
+      });
+    };
+    auto a = make_task('a');
+    auto b = make_task('b');
+    auto c = make_task('c');
+    auto d = make_task('d');
+    a->set_as_predecessor_of(b);
+    a->set_as_predecessor_of(c);
+    b->set_as_predecessor_of(d);
+    c->set_as_predecessor_of(d);
+    return {d, c, b, a};
+  }
+
+  void _expect_diamond_order() {
+    ASSERT_EQ(_execution_order.size(), 4u);
+    EXPECT_EQ(_execution_order.front(), 'a');
+    EXPECT_EQ(_execution_order.back(), 'd');
+  }
+
+  std::vector<char> _execution_order;
+  std::mutex _execution_order_mutex;
+};
+
+TEST_F(SchedulerTest, ExecutesAllTasks) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(4));
+  auto counter = std::atomic<uint32_t>{0};
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto task_index = 0; task_index < 100; ++task_index) {
+    tasks.push_back(std::make_shared<JobTask>([&] { ++counter; }));
+  }
+
+  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+  EXPECT_EQ(counter, 100u);
+  for (const auto& task : tasks) {
+    EXPECT_TRUE(task->is_done());
+  }
+}
+
+TEST_F(SchedulerTest, Dependencies) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(4));
+  const auto tasks = _make_diamond();
+  EXPECT_FALSE(tasks.front()->is_ready());
+  EXPECT_TRUE(tasks.back()->is_ready());
+
+  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+  _expect_diamond_order();
+}
+
+TEST_F(SchedulerTest, NestedTasksDoNotBlockWorkers) {
+  // Every outer task waits for inner tasks. With fewer workers than outer tasks, this only finishes if waiting
+  // workers execute the inner tasks themselves.
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(2));
+  auto counter = std::atomic<uint32_t>{0};
+  auto outer_tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto outer_index = 0; outer_index < 8; ++outer_index) {
+    outer_tasks.push_back(std::make_shared<JobTask>([&] {
+      EXPECT_NE(Worker::get_this_thread_worker(), nullptr);
+      auto inner_tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+      for (auto inner_index = 0; inner_index < 8; ++inner_index) {
+        inner_tasks.push_back(std::make_shared<JobTask>([&] { ++counter; }));
+      }
+      CurrentScheduler::schedule_and_wait_for_tasks(inner_tasks);
+    }));
+  }
+
+  CurrentScheduler::schedule_and_wait_for_tasks(outer_tasks);
+  EXPECT_EQ(counter, 64u);
+}
+
+TEST_F(SchedulerTest, WaitForAllTasks) {
+  const auto scheduler = std::make_shared<NodeQueueScheduler>(2);
+  CurrentScheduler::set(scheduler);
+  EXPECT_EQ(scheduler->worker_count(), 2u);
+  EXPECT_EQ(scheduler->workers().size(), 2u);
+
+  auto counter = std::atomic<uint32_t>{0};
+  for (auto task_index = 0; task_index < 20; ++task_index) {
+    std::make_shared<JobTask>([&] { ++counter; })->schedule();
+  }
+  scheduler->wait_for_all_tasks();
+  EXPECT_EQ(counter, 20u);
+}
+
+TEST_F(SchedulerTest, SetWhileTasksUseScheduler) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(2));
+  auto task_started = std::atomic_bool{false};
+  auto subtask_done = std::atomic_bool{false};
+  const auto task = std::make_shared<JobTask>([&] {
+    task_started = true;
+    // Replacing the scheduler finishes the previous one, which waits for this task while it schedules a subtask.
+    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+    CurrentScheduler::schedule_and_wait_for_tasks({std::make_shared<JobTask>([&] { subtask_done = true; })});
+  });
+  task->schedule();
+  while (!task_started) std::this_thread::yield();
+
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(2));
+  EXPECT_TRUE(task->is_done());
+  EXPECT_TRUE(subtask_done);
+}
+
+TEST_F(SchedulerTest, ImmediateExecution) {
+  CurrentScheduler::set(std::make_shared<ImmediateExecutionScheduler>());
+  const auto calling_thread = std::this_thread::get_id();
+  auto executing_thread = std::thread::id{};
+  auto task = std::make_shared<JobTask>([&] { executing_thread = std::this_thread::get_id(); });
+
+  task->schedule();
+  EXPECT_TRUE(task->is_done());
+  EXPECT_EQ(executing_thread, calling_thread);
+
+  // The successor is scheduled first, but only executed once its predecessors are done.
+  const auto tasks = _make_diamond();
+  tasks[0]->schedule();
+  EXPECT_FALSE(tasks[0]->is_done());
+  CurrentScheduler::schedule_tasks({tasks[1], tasks[2], tasks[3]});
+  EXPECT_TRUE(tasks[0]->is_done());
+  _expect_diamond_order();
+}
+
+TEST_F(SchedulerTest, RethrowsExceptions) {
+  for (const auto& scheduler : std::vector<std::shared_ptr<AbstractScheduler>>{
+           std::make_shared<NodeQueueScheduler>(2), std::make_shared<ImmediateExecutionScheduler>()}) {
+    CurrentScheduler::set(scheduler);
+    auto counter = std::atomic<uint32_t>{0};
+    const auto tasks = std::vector<std::shared_ptr<AbstractTask>>{
+        std::make_shared<JobTask>([&] { ++counter; }), std::make_shared<JobTask>([] { Fail("Failing task"); }),
+        std::make_shared<JobTask>([&] { ++counter; })};
+
+    EXPECT_THROW(CurrentScheduler::schedule_and_wait_for_tasks(tasks), std::logic_error);
+    EXPECT_EQ(counter, 2u);
+  }
+}
+
+TEST_F(SchedulerTest, InvalidUsage) {
+  CurrentScheduler::set(std::make_shared<ImmediateExecutionScheduler>());
+  auto first = std::make_shared<JobTask>([] {});
+  auto second = std::make_shared<JobTask>([] {});
+  first->schedule();
+  EXPECT_THROW(first->schedule(), std::logic_error);
+  EXPECT_THROW(first->set_as_predecessor_of(second), std::logic_error);
+}
+
+TEST_F(SchedulerTest, TaskQueue) {
+  auto queue = TaskQueue{};
+  EXPECT_EQ(queue.pull(), nullptr);
+  EXPECT_EQ(queue.steal(), nullptr);
+
+  const auto first = std::make_shared<JobTask>([] {});
+  const auto second = std::make_shared<JobTask>([] {});
+  const auto third = std::make_shared<JobTask>([] {});
+  queue.push(first);
+  queue.push(second);
+  queue.push(third);
+  EXPECT_EQ(queue.size(), 3u);
+  EXPECT_EQ(queue.pull(), third);
+  EXPECT_EQ(queue.steal(), first);
+  EXPECT_EQ(queue.pull(), second);
+  EXPECT_EQ(queue.size(), 0u);
+}
+
+TEST_F(SchedulerTest, OperatorTasks) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(2));
+  auto table = std::make_shared<Table>(2);
+  table->add_column("a", "int");
+  for (auto value = 0; value < 5; ++value) {
+    table->append({value});
+  }
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  const auto table_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 2);
+  const auto table_wrapper_task = std::make_shared<OperatorTask>(table_wrapper);
+  const auto table_scan_task = std::make_shared<OperatorTask>(table_scan);
+  table_wrapper_task->set_as_predecessor_of(table_scan_task);
+
+  CurrentScheduler::schedule_and_wait_for_tasks({table_scan_task, table_wrapper_task});
+  EXPECT_EQ(table_scan_task->get_operator()->get_output()->row_count(), 2u);
+}
+
+TEST_F(SchedulerTest, CompressChunkWithEitherScheduler) {
+  for (const auto& scheduler : std::vector<std::shared_ptr<AbstractScheduler>>{
+           std::make_shared<NodeQueueScheduler>(2), std::make_shared<ImmediateExecutionScheduler>()}) {
+    CurrentScheduler::set(scheduler);
+    auto table = Table{2};
+    table.add_column("a", "int");
+    table.add_column("b", "string");
+    table.append({1, "one"});
+    table.append({2, "two"});
+    table.compress_chunk(ChunkID{0});
+    EXPECT_EQ((*table.get_chunk(ChunkID{0}).get_segment(ColumnID{1}))[1], AllTypeVariant{"two"});
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,68 @@
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/statistics/equi_height_histogram.hpp"
+
+namespace opossum {
+
+class StatisticsEquiHeightHistogramTest : public BaseTest {};
+
+TEST_F(StatisticsEquiHeightHistogramTest, Bins) {
+  // 1 to 8 occur twice each, 9 occurs eight times
+  const auto histogram = EquiHeightHistogram<int32_t>{{1, 2, 3, 4, 5, 6, 7, 8, 9}, {2, 2, 2, 2, 2, 2, 2, 2, 8}, 4};
+  EXPECT_EQ(histogram.total_count(), 24u);
+  // A value never spans two bins, so the last bin is twice as high as the others.
+  ASSERT_EQ(histogram.bin_count(), 3u);
+  EXPECT_EQ(histogram.bin_minimum(0), 1);
+  EXPECT_EQ(histogram.bin_maximum(0), 3);
+  EXPECT_EQ(histogram.bin_height(0), 6u);
+  EXPECT_EQ(histogram.bin_distinct_count(0), 3u);
+  EXPECT_EQ(histogram.bin_minimum(1), 4);
+  EXPECT_EQ(histogram.bin_maximum(1), 6);
+  EXPECT_EQ(histogram.bin_minimum(2), 7);
+  EXPECT_EQ(histogram.bin_maximum(2), 9);
+  EXPECT_EQ(histogram.bin_height(2), 12u);
+  EXPECT_EQ(histogram.estimate_memory_usage(), 3 * (2 * sizeof(int32_t) + 2 * sizeof(size_t)));
+
+  EXPECT_EQ(EquiHeightHistogram<int32_t>({}, {}).bin_count(), 0u);
+  EXPECT_THROW(EquiHeightHistogram<int32_t>({1, 2}, {1}), std::logic_error);
+}
+
+TEST_F(StatisticsEquiHeightHistogramTest, EstimateCardinality) {
+  const auto histogram = EquiHeightHistogram<int32_t>{{1, 2, 3, 4, 5, 6, 7, 8, 9}, {2, 2, 2, 2, 2, 2, 2, 2, 8}, 4};
+  // The distinct values of a bin are assumed to occur equally often.
+  EXPECT_DOUBLE_EQ(histogram.estimate_cardinality(ScanType::OpEquals, 9), 4.0);
+  EXPECT_DOUBLE_EQ(histogram.estimate_cardinality(ScanType::OpEquals, 2), 2.0);
+  EXPECT_DOUBLE_EQ(histogram.estimate_cardinality(ScanType::OpEquals, 0), 0.0);
+  EXPECT_DOUBLE_EQ(histogram.estimate_cardinality(ScanType::OpEquals, 10), 0.0);
+  EXPECT_DOUBLE_EQ(histogram.estimate_cardinality(ScanType::OpNotEquals, 9), 20.0);
+
+  EXPECT_DOUBLE_EQ(histogram.estimate_cardinality(ScanType::OpLessThan, 1), 0.0);
+  EXPECT_DOUBLE_EQ(histogram.estimate_cardinality(ScanType::OpLessThan, 4), 6.0);
+  EXPECT_DOUBLE_EQ(histogram.estimate_cardinality(ScanType::OpLessThanEquals, 9), 24.0);
+  EXPECT_DOUBLE_EQ(histogram.estimate_cardinality(ScanType::OpGreaterThan, 8), 2.0);
+  EXPECT_DOUBLE_EQ(histogram.estimate_cardinality(ScanType::OpGreaterThanEquals, 0), 24.0);
+
+  // Within a bin, the values are assumed to be spread evenly.
+  const auto wide_histogram = EquiHeightHistogram<double>{{0.0, 100.0}, {50, 50}, 1};
+  EXPECT_DOUBLE_EQ(wide_histogram.estimate_cardinality(ScanType::OpLessThan, 25.0), 25.0);
+  EXPECT_DOUBLE_EQ(wide_histogram.estimate_cardinality(ScanType::OpGreaterThanEquals, 25.0), 75.0);
+}
+
+TEST_F(StatisticsEquiHeightHistogramTest, Strings) {
+  const auto histogram = EquiHeightHistogram<std::string>{{"Alpha", "Beta", "Delta", "Gamma"}, {3, 1, 1, 3}, 2};
+  ASSERT_EQ(histogram.bin_count(), 2u);
+  EXPECT_EQ(histogram.bin_maximum(0), "Beta");
+  EXPECT_DOUBLE_EQ(histogram.estimate_cardinality(ScanType::OpEquals, "Alpha"), 2.0);
+  EXPECT_DOUBLE_EQ(histogram.estimate_cardinality(ScanType::OpEquals, "Epsilon"), 2.0);
+  EXPECT_DOUBLE_EQ(histogram.estimate_cardinality(ScanType::OpEquals, "Zeta"), 0.0);
+  EXPECT_DOUBLE_EQ(histogram.estimate_cardinality(ScanType::OpLessThan, "Delta"), 4.0);
+  // Half of the bin is assumed to be smaller.
+  EXPECT_DOUBLE_EQ(histogram.estimate_cardinality(ScanType::OpLessThan, "Epsilon"), 6.0);
+}
+
+}  // namespace opossum
@@ -0,0 +1,51 @@
+#include <cstdint>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/statistics/hyper_log_log.hpp"
+#include "../lib/utils/hash.hpp"
+
+namespace opossum {
+
+class StatisticsHyperLogLogTest : public BaseTest {};
+
+TEST_F(StatisticsHyperLogLogTest, EstimateDistinctCount) {
+  auto sketch = HyperLogLog{};
+  EXPECT_EQ(sketch.estimate(), 0.0);
+
+  for (const auto distinct_count : {int64_t{10}, int64_t{1'000}, int64_t{100'000}}) {
+    sketch = HyperLogLog{};
+    // Every value is added three times, which must not change the estimate.
+    for (auto repetition = 0; repetition < 3; ++repetition) {
+      for (auto value = int64_t{0}; value < distinct_count; ++value) {
+        sketch.add(mixed_hash(value));
+      }
+    }
+    EXPECT_NEAR(sketch.estimate(), static_cast<double>(distinct_count), 0.05 * static_cast<double>(distinct_count));
+  }
+  EXPECT_EQ(sketch.estimate_memory_usage(), HyperLogLog::REGISTER_COUNT);
+}
+
+TEST_F(StatisticsHyperLogLogTest, Merge) {
+  // The sketches overlap in half of their values.
+  auto first_sketch = HyperLogLog{};
+  auto second_sketch = HyperLogLog{};
+  for (auto value = int64_t{0}; value < 20'000; ++value) {
+    first_sketch.add(mixed_hash(value));
+    second_sketch.add(mixed_hash(value + 10'000));
+  }
+
+  auto merged_sketch = HyperLogLog{};
+  merged_sketch.merge(first_sketch);
+  merged_sketch.merge(second_sketch);
+  EXPECT_NEAR(merged_sketch.estimate(), 30'000.0, 1'500.0);
+
+  auto combined_sketch = HyperLogLog{};
+  for (auto value = int64_t{0}; value < 30'000; ++value) {
+    combined_sketch.add(mixed_hash(value));
+  }
+  EXPECT_EQ(merged_sketch.estimate(), combined_sketch.estimate());
+}
+
+}  // namespace opossum
@@ -0,0 +1,88 @@
+#include <filesystem>
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/statistics/table_statistics.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class StatisticsTableStatisticsTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(1'000);
+    _table->add_column("a", "int");
+    _table->add_column("b", "string");
+    _table->set_background_compression(false);
+    // a is 0 to 999 in every chunk, b holds 10 distinct strings
+    for (auto row = 0; row < 3'500; ++row) {
+      _table->append({row % 1'000, "Value " + std::to_string(row % 10)});
+    }
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(StatisticsTableStatisticsTest, EmptyStatistics) {
+  const auto& statistics = _table->statistics();
+  EXPECT_EQ(statistics.row_count(), 0u);
+  EXPECT_EQ(statistics.chunk_count(), 0u);
+  EXPECT_EQ(statistics.estimate_distinct_count(ColumnID{0}), 0.0);
+  EXPECT_EQ(statistics.estimate_selectivity(ColumnID{0}, ScanType::OpEquals, 5), 1.0);
+  EXPECT_THROW(statistics.column_statistics(ColumnID{2}), std::out_of_range);
+}
+
+TEST_F(StatisticsTableStatisticsTest, UpdatedByCompression) {
+  const auto& statistics = _table->statistics();
+  _table->compress_chunk(ChunkID{0});
+  EXPECT_EQ(statistics.row_count(), 1'000u);
+  EXPECT_EQ(statistics.chunk_count(), 1u);
+
+  // Compressing a chunk again does not add it twice.
+  _table->compress_chunk(ChunkID{0});
+  _table->compress_chunk(ChunkID{1}, EncodingType::RunLength);
+  _table->compress_chunk(ChunkID{2}, EncodingType::FrameOfReference);
+  EXPECT_EQ(statistics.row_count(), 3'000u);
+  EXPECT_EQ(statistics.chunk_count(), 3u);
+  EXPECT_EQ(statistics.column_statistics(ColumnID{1}).row_count(), 3'000u);
+
+  // The sketches of the chunks are merged, so values that occur in every chunk are only counted once.
+  EXPECT_NEAR(statistics.estimate_distinct_count(ColumnID{0}), 1'000.0, 50.0);
+  EXPECT_NEAR(statistics.estimate_distinct_count(ColumnID{1}), 10.0, 0.5);
+
+  EXPECT_NEAR(statistics.estimate_selectivity(ColumnID{0}, ScanType::OpEquals, 500), 0.001, 0.0005);
+  EXPECT_NEAR(statistics.estimate_selectivity(ColumnID{0}, ScanType::OpLessThan, 250), 0.25, 0.02);
+  EXPECT_NEAR(statistics.estimate_selectivity(ColumnID{0}, ScanType::OpGreaterThanEquals, 900), 0.1, 0.02);
+  EXPECT_EQ(statistics.estimate_selectivity(ColumnID{0}, ScanType::OpGreaterThan, 2'000), 0.0);
+  EXPECT_NEAR(statistics.estimate_selectivity(ColumnID{1}, ScanType::OpEquals, "Value 3"), 0.1, 0.01);
+  EXPECT_EQ(statistics.estimate_selectivity(ColumnID{1}, ScanType::OpEquals, "Value 10"), 0.0);
+  EXPECT_GT(statistics.estimate_memory_usage(), 0u);
+}
+
+TEST_F(StatisticsTableStatisticsTest, UpdatedByBackgroundCompression) {
+  _table->set_background_compression(true);
+  for (auto row = 3'500; row < 4'000; ++row) {
+    _table->append({row % 1'000, "Value " + std::to_string(row % 10)});
+  }
+  _table->wait_for_background_compressions();
+  EXPECT_EQ(_table->statistics().chunk_count(), 1u);
+  EXPECT_EQ(_table->statistics().row_count(), 1'000u);
+}
+
+TEST_F(StatisticsTableStatisticsTest, CreatedByLoad) {
+  _table->compress_chunk(ChunkID{0});
+  const auto file_name = (std::filesystem::temp_directory_path() / "opossum_table_statistics_test.bin").string();
+  _table->save(file_name);
+  const auto table = Table::load(file_name);
+  std::filesystem::remove(file_name);
+
+  // All full chunks are covered, including those that have not been compressed.
+  EXPECT_EQ(table->statistics().chunk_count(), 3u);
+  EXPECT_EQ(table->statistics().row_count(), 3'000u);
+  EXPECT_NEAR(table->statistics().estimate_distinct_count(ColumnID{1}), 10.0, 0.5);
+}
+
+}  // namespace opossum
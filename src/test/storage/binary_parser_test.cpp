@@ -0,0 +1,317 @@
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/binary_format.hpp"
+#include "../lib/storage/binary_parser.hpp"
+#include "../lib/storage/binary_writer.hpp"
+#include "../lib/storage/delta_segment.hpp"
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/fixed_size_attribute_vector.hpp"
+#include "../lib/storage/frame_of_reference_segment.hpp"
+#include "../lib/storage/fsst_segment.hpp"
+#include "../lib/storage/reference_segment.hpp"
+#include "../lib/storage/run_length_segment.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class StorageBinaryParserTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // The chunks are compressed explicitly to get both value and dictionary segments.
+    _table = std::make_shared<Table>(1000);
+    _table->set_background_compression(false);
+    _table->add_column("a", "int");
+    _table->add_column("b", "long");
+    _table->add_column("c", "float");
+    _table->add_column("d", "double");
+    _table->add_column("e", "string");
+    // 3 distinct values yield bit-packed, 200 distinct values fixed-size attribute vectors.
+    for (auto row = 0; row < 2500; ++row) {
+      const auto value = row < 1000 ? row % 3 : row % 200;
+      _table->append({value, int64_t{value} << 40, value / 2.0f, value / 4.0, std::string(value % 20, 'x')});
+    }
+    _table->compress_chunk(ChunkID{0});
+    _table->compress_chunk(ChunkID{1});
+  }
+
+  void TearDown() override { std::filesystem::remove(_file_name); }
+
+  // Writes the bytes to the file, e.g., to corrupt it.
+  void _write_bytes(const std::string& bytes) const {
+    auto file = std::ofstream{_file_name, std::ios::binary | std::ios::trunc};
+    file << bytes;
+  }
+
+  std::string _read_bytes() const {
+    auto file = std::ifstream{_file_name, std::ios::binary};
+    return std::string{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+  }
+
+  std::shared_ptr<Table> _table;
+  const std::string _file_name = (std::filesystem::temp_directory_path() / "opossum_binary_parser_test.bin").string();
+};
+
+TEST_F(StorageBinaryParserTest, WriteAndParse) {
+  BinaryWriter::write(*_table, _file_name);
+  const auto table = BinaryParser::parse(_file_name);
+
+  EXPECT_TABLE_EQ(table, _table, true);
+  EXPECT_EQ(table->target_chunk_size(), 1000u);
+  EXPECT_EQ(table->column_names(), _table->column_names());
+  ASSERT_EQ(table->chunk_count(), 3u);
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    EXPECT_EQ(table->get_chunk(chunk_id).size(), _table->get_chunk(chunk_id).size());
+  }
+}
+
+TEST_F(StorageBinaryParserTest, KeepsEncoding) {
+  BinaryWriter::write(*_table, _file_name);
+  const auto table = BinaryParser::parse(_file_name);
+
+  const auto bit_packed_segment =
+      std::dynamic_pointer_cast<DictionarySegment<int32_t>>(table->get_chunk(ChunkID{0}).get_segment(ColumnID{0}));
+  ASSERT_TRUE(bit_packed_segment);
+  EXPECT_TRUE(std::dynamic_pointer_cast<BitPackedAttributeVector>(bit_packed_segment->attribute_vector()));
+  EXPECT_EQ(bit_packed_segment->unique_values_count(), 3u);
+
+  const auto fixed_size_segment =
+      std::dynamic_pointer_cast<DictionarySegment<int64_t>>(table->get_chunk(ChunkID{1}).get_segment(ColumnID{1}));
+  ASSERT_TRUE(fixed_size_segment);
+  EXPECT_TRUE(std::dynamic_pointer_cast<FixedSizeAttributeVector<uint8_t>>(fixed_size_segment->attribute_vector()));
+  EXPECT_EQ(fixed_size_segment->lower_bound(int64_t{5} << 40), ValueID{5});
+
+  const auto string_segment =
+      std::dynamic_pointer_cast<DictionarySegment<std::string>>(table->get_chunk(ChunkID{1}).get_segment(ColumnID{4}));
+  ASSERT_TRUE(string_segment);
+  EXPECT_EQ(string_segment->lower_bound(std::string(5, 'x')), ValueID{5});
+
+  EXPECT_TRUE(std::dynamic_pointer_cast<ValueSegment<double>>(table->get_chunk(ChunkID{2}).get_segment(ColumnID{3})));
+}
+
+TEST_F(StorageBinaryParserTest, RunLengthSegments) {
+  auto table = std::make_shared<Table>(100);
+  table->set_background_compression(false);
+  table->add_column("a", "int");
+  table->add_column("b", "string");
+  for (auto row = 0; row < 200; ++row) {
+    table->append({row / 30, std::string(row / 50, 'x')});
+  }
+  table->compress_chunk(ChunkID{1}, EncodingType::RunLength);
+
+  BinaryWriter::write(*table, _file_name);
+  const auto parsed_table = BinaryParser::parse(_file_name);
+  EXPECT_TABLE_EQ(parsed_table, table, true);
+
+  const auto& chunk = parsed_table->get_chunk(ChunkID{1});
+  const auto segment = std::dynamic_pointer_cast<RunLengthSegment<std::string>>(chunk.get_segment(ColumnID{1}));
+  ASSERT_TRUE(segment);
+  EXPECT_EQ(segment->end_positions(), (std::vector<ChunkOffset>{50, 100}));
+}
+
+TEST_F(StorageBinaryParserTest, IntegerEncodings) {
+  auto table = std::make_shared<Table>(3000);
+  table->set_background_compression(false);
+  table->add_column("a", "int");
+  table->add_column("b", "long");
+  for (auto row = 0; row < 6000; ++row) {
+    table->append({row % 11, int64_t{row} << 33});
+  }
+  table->compress_chunk(ChunkID{0}, EncodingType::FrameOfReference);
+  table->compress_chunk(ChunkID{1}, EncodingType::Delta);
+
+  BinaryWriter::write(*table, _file_name);
+  const auto parsed_table = BinaryParser::parse(_file_name);
+  EXPECT_TABLE_EQ(parsed_table, table, true);
+
+  const auto& chunk = parsed_table->get_chunk(ChunkID{0});
+  const auto segment = std::dynamic_pointer_cast<FrameOfReferenceSegment<int64_t>>(chunk.get_segment(ColumnID{1}));
+  ASSERT_TRUE(segment);
+  EXPECT_EQ(segment->widths(), (std::vector<AttributeVectorWidth>{44, 43}));
+
+  const auto delta_segment =
+      std::dynamic_pointer_cast<DeltaSegment<int64_t>>(parsed_table->get_chunk(ChunkID{1}).get_segment(ColumnID{1}));
+  ASSERT_TRUE(delta_segment);
+  EXPECT_TRUE(delta_segment->is_sorted());
+}
+
+TEST_F(StorageBinaryParserTest, StringEncodings) {
+  // URL-like values, for which the front-coded dictionary of chunk 0 compresses its characters.
+  auto table = std::make_shared<Table>(3000);
+  table->set_background_compression(false);
+  table->add_column("a", "string");
+  for (auto row = 0; row < 6000; ++row) {
+    table->append({"https://www.example.com/articles/" + std::to_string(row * 7907 % 6000) + "/comments"});
+  }
+  table->compress_chunk(ChunkID{0});
+  table->compress_chunk(ChunkID{1}, EncodingType::Fsst);
+
+  BinaryWriter::write(*table, _file_name);
+  const auto parsed_table = BinaryParser::parse(_file_name);
+  EXPECT_TABLE_EQ(parsed_table, table, true);
+
+  const auto dictionary_segment = std::dynamic_pointer_cast<DictionarySegment<std::string>>(
+      parsed_table->get_chunk(ChunkID{0}).get_segment(ColumnID{0}));
+  ASSERT_TRUE(dictionary_segment);
+  EXPECT_TRUE(dictionary_segment->dictionary().is_compressed());
+  EXPECT_EQ(dictionary_segment->lower_bound(std::string{"https://www.example.com/articles/"}), ValueID{0});
+  EXPECT_EQ(dictionary_segment->upper_bound(std::string{"https://www.example.com/articles/~"}), INVALID_VALUE_ID);
+
+  const auto fsst_segment =
+      std::dynamic_pointer_cast<FsstSegment>(parsed_table->get_chunk(ChunkID{1}).get_segment(ColumnID{0}));
+  ASSERT_TRUE(fsst_segment);
+  EXPECT_GT(fsst_segment->symbol_table().symbol_count(), 0u);
+}
+
+TEST_F(StorageBinaryParserTest, BloomFilters) {
+  auto table = std::make_shared<Table>(1000);
+  table->set_background_compression(false);
+  table->set_bloom_filter_false_positive_rate(0.01);
+  table->add_column("a", "int");
+  table->add_column("b", "string");
+  for (auto row = 0; row < 1000; ++row) {
+    table->append({row * 3, std::to_string(row)});
+  }
+  table->compress_chunk(ChunkID{0});
+
+  for (const auto memory_map : {false, true}) {
+    BinaryWriter::write(*table, _file_name);
+    const auto parsed_table = BinaryParser::parse(_file_name, memory_map);
+    EXPECT_TABLE_EQ(parsed_table, table, true);
+
+    const auto& chunk = parsed_table->get_chunk(ChunkID{0});
+    const auto segment = std::dynamic_pointer_cast<DictionarySegment<int32_t>>(chunk.get_segment(ColumnID{0}));
+    ASSERT_TRUE(segment);
+    ASSERT_TRUE(segment->bloom_filter());
+    EXPECT_EQ(segment->estimate_memory_usage(),
+              table->get_chunk(ChunkID{0}).get_segment(ColumnID{0})->estimate_memory_usage());
+    EXPECT_TRUE(segment->may_contain(2997));
+  }
+}
+
+TEST_F(StorageBinaryParserTest, MemoryMap) {
+  BinaryWriter::write(*_table, _file_name);
+  auto table = BinaryParser::parse(_file_name, true);
+  EXPECT_TABLE_EQ(table, _table, true);
+
+  for (const auto& scanned_table : {table, _table}) {
+    const auto table_wrapper = std::make_shared<TableWrapper>(scanned_table);
+    table_wrapper->execute();
+    auto table_scan = TableScan{table_wrapper, ColumnID{1}, ScanType::OpLessThan, int64_t{100} << 40};
+    table_scan.execute();
+    EXPECT_EQ(table_scan.get_output()->row_count(), 1800u);
+  }
+
+  // The segments keep the file mapped, even when the table is gone and the file is deleted.
+  const auto segment =
+      std::dynamic_pointer_cast<DictionarySegment<double>>(table->get_chunk(ChunkID{1}).get_segment(ColumnID{3}));
+  ASSERT_TRUE(segment);
+  table = nullptr;
+  std::filesystem::remove(_file_name);
+  EXPECT_EQ(segment->get(199), 199 / 4.0);
+  EXPECT_EQ(segment->dictionary().size(), 200u);
+  EXPECT_THROW(segment->attribute_vector()->set(0, ValueID{0}), std::logic_error);
+}
+
+TEST_F(StorageBinaryParserTest, EmptyTable) {
+  auto empty_table = Table{};
+  empty_table.add_column("a", "string");
+  BinaryWriter::write(empty_table, _file_name);
+  const auto table = BinaryParser::parse(_file_name);
+
+  EXPECT_EQ(table->column_count(), 1u);
+  EXPECT_EQ(table->row_count(), 0u);
+  EXPECT_EQ(table->chunk_count(), 1u);
+}
+
+TEST_F(StorageBinaryParserTest, RejectsReferenceSegments) {
+  auto reference_table = Table{};
+  reference_table.add_column_definition("a", "int");
+  const auto chunk = std::make_shared<Chunk>();
+  chunk->add_segment(std::make_shared<ReferenceSegment>(_table, ColumnID{0}, std::make_shared<PosList>()));
+  reference_table.emplace_chunk(chunk);
+
+  EXPECT_THROW(BinaryWriter::write(reference_table, _file_name), std::logic_error);
+}
+
+TEST_F(StorageBinaryParserTest, RejectsInvalidFiles) {
+  BinaryWriter::write(*_table, _file_name);
+  const auto bytes = _read_bytes();
+
+  _write_bytes("not a table");
+  EXPECT_THROW(BinaryParser::parse(_file_name), std::logic_error);
+
+  auto other_version = bytes;
+  other_version[BINARY_FORMAT_MAGIC.size()] = BINARY_FORMAT_VERSION + 1;
+  _write_bytes(other_version);
+  EXPECT_THROW(BinaryParser::parse(_file_name), std::logic_error);
+
+  _write_bytes(bytes.substr(0, bytes.size() - 1));
+  EXPECT_THROW(BinaryParser::parse(_file_name), std::logic_error);
+
+  _write_bytes(bytes + "x");
+  EXPECT_THROW(BinaryParser::parse(_file_name), std::logic_error);
+
+  EXPECT_THROW(BinaryParser::parse(_file_name + ".does_not_exist"), std::logic_error);
+}
+
+TEST_F(StorageBinaryParserTest, RejectsInvalidChunks) {
+  // Writes a table with a single chunk, which is emplaced without checking the sizes of its segments.
+  const auto write_chunk = [&](const ChunkOffset target_chunk_size, pmr_vector<int32_t>&& a, pmr_vector<int32_t>&& b) {
+    auto table = Table{target_chunk_size};
+    table.add_column_definition("a", "int");
+    table.add_column_definition("b", "int");
+    const auto chunk = std::make_shared<Chunk>();
+    chunk->add_segment(std::make_shared<ValueSegment<int32_t>>(std::move(a)));
+    chunk->add_segment(std::make_shared<ValueSegment<int32_t>>(std::move(b)));
+    table.emplace_chunk(chunk);
+    BinaryWriter::write(table, _file_name);
+  };
+
+  write_chunk(3, pmr_vector<int32_t>{1, 2, 3}, pmr_vector<int32_t>{4, 5, 6});
+  EXPECT_EQ(BinaryParser::parse(_file_name)->row_count(), 3u);
+
+  write_chunk(3, pmr_vector<int32_t>{1, 2, 3}, pmr_vector<int32_t>{4, 5});
+  EXPECT_THROW(BinaryParser::parse(_file_name), std::logic_error);
+
+  write_chunk(2, pmr_vector<int32_t>{1, 2, 3}, pmr_vector<int32_t>{4, 5, 6});
+  EXPECT_THROW(BinaryParser::parse(_file_name), std::logic_error);
+}
+
+TEST_F(StorageBinaryParserTest, RejectsInvalidDictionaries) {
+  // Writes a table with a single DictionarySegment, which is created without any checks.
+  const auto write_segment = [&](pmr_vector<int32_t>&& dictionary, pmr_vector<uint8_t>&& value_ids) {
+    auto table = Table{};
+    table.add_column_definition("a", "int");
+    const auto chunk = std::make_shared<Chunk>();
+    chunk->add_segment(std::make_shared<DictionarySegment<int32_t>>(
+        std::move(dictionary), std::make_shared<FixedSizeAttributeVector<uint8_t>>(std::move(value_ids))));
+    table.emplace_chunk(chunk);
+    BinaryWriter::write(table, _file_name);
+  };
+
+  // Segments that are used in place from the mapped file are checked as well.
+  for (const auto memory_map : {false, true}) {
+    write_segment(pmr_vector<int32_t>{1, 2}, pmr_vector<uint8_t>{0, 1, 1});
+    EXPECT_EQ(BinaryParser::parse(_file_name, memory_map)->row_count(), 3u);
+
+    write_segment(pmr_vector<int32_t>{1, 2}, pmr_vector<uint8_t>{0, 2, 1});
+    EXPECT_THROW(BinaryParser::parse(_file_name, memory_map), std::logic_error);
+
+    write_segment(pmr_vector<int32_t>{2, 1}, pmr_vector<uint8_t>{0, 1, 1});
+    EXPECT_THROW(BinaryParser::parse(_file_name, memory_map), std::logic_error);
+
+    write_segment(pmr_vector<int32_t>{1, 1}, pmr_vector<uint8_t>{0, 1, 1});
+    EXPECT_THROW(BinaryParser::parse(_file_name, memory_map), std::logic_error);
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,79 @@
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "../../lib/storage/bit_packed_attribute_vector.hpp"
+
+namespace opossum {
+
+class BitPackedAttributeVectorTest : public ::testing::Test {
+ protected:
+  // Creates size value ids that use all bits of the given width.
+  static std::vector<ValueID> _value_ids(const size_t size, const AttributeVectorWidth width) {
+    const auto max_value_id = (uint64_t{1} << width) - 1;
+    auto value_ids = std::vector<ValueID>{};
+    for (auto index = size_t{0}; index < size; ++index) {
+      value_ids.push_back(ValueID{static_cast<ValueID::base_type>((index * 7919) % (max_value_id + 1))});
+    }
+    value_ids.back() = ValueID{static_cast<ValueID::base_type>(max_value_id)};
+    return value_ids;
+  }
+};
+
+TEST_F(BitPackedAttributeVectorTest, RequiredWidth) {
+  EXPECT_EQ(BitPackedAttributeVector::required_width(0), 1u);
+  EXPECT_EQ(BitPackedAttributeVector::required_width(1), 1u);
+  EXPECT_EQ(BitPackedAttributeVector::required_width(2), 1u);
+  EXPECT_EQ(BitPackedAttributeVector::required_width(3), 2u);
+  EXPECT_EQ(BitPackedAttributeVector::required_width(256), 8u);
+  EXPECT_EQ(BitPackedAttributeVector::required_width(257), 9u);
+}
+
+TEST_F(BitPackedAttributeVectorTest, GetAndDecodeAllWidths) {
+  const auto size = size_t{300};
+  for (auto width = AttributeVectorWidth{1}; width <= 32; ++width) {
+    const auto value_ids = _value_ids(size, width);
+    const auto attribute_vector = BitPackedAttributeVector{value_ids, width};
+    EXPECT_EQ(attribute_vector.size(), size);
+    EXPECT_EQ(attribute_vector.width(), width);
+
+    for (auto index = size_t{0}; index < size; ++index) {
+      ASSERT_EQ(attribute_vector.get(index), value_ids[index]) << "width " << int{width} << ", index " << index;
+    }
+
+    // Decode ranges that start and end within blocks as well as at block boundaries.
+    for (const auto& [begin, length] : std::vector<std::pair<size_t, size_t>>{{0, 300}, {5, 250}, {64, 128}, {70, 3}}) {
+      auto decoded = std::vector<ValueID>(length);
+      attribute_vector.decode(begin, length, decoded.data());
+      for (auto index = size_t{0}; index < length; ++index) {
+        ASSERT_EQ(decoded[index], value_ids[begin + index]) << "width " << int{width} << ", index " << begin + index;
+      }
+    }
+  }
+}
+
+TEST_F(BitPackedAttributeVectorTest, Set) {
+  const auto width = AttributeVectorWidth{13};
+  const auto value_ids = _value_ids(100, width);
+  auto attribute_vector = BitPackedAttributeVector{value_ids.size(), width};
+  for (auto index = size_t{0}; index < value_ids.size(); ++index) {
+    attribute_vector.set(index, value_ids[index]);
+  }
+
+  // Overwriting a value must not affect its neighbors, even if it spans two words.
+  attribute_vector.set(4, ValueID{0});
+  for (auto index = size_t{0}; index < value_ids.size(); ++index) {
+    ASSERT_EQ(attribute_vector.get(index), index == 4 ? ValueID{0} : value_ids[index]);
+  }
+
+  EXPECT_THROW(attribute_vector.set(0, ValueID{1 << 13}), std::logic_error);
+}
+
+TEST_F(BitPackedAttributeVectorTest, MemoryUsage) {
+  // 1000 value ids with 3 bits: 3000 bits, i.e., 47 words of 8 bytes
+  EXPECT_EQ((BitPackedAttributeVector{1000, 3}.estimate_memory_usage()), 376u);
+  EXPECT_EQ((BitPackedAttributeVector{64, 1}.estimate_memory_usage()), 8u);
+}
+
+}  // namespace opossum
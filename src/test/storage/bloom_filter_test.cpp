@@ -0,0 +1,84 @@
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/bloom_filter.hpp"
+#include "../lib/utils/hash.hpp"
+
+namespace opossum {
+
+class StorageBloomFilterTest : public BaseTest {};
+
+TEST_F(StorageBloomFilterTest, NoFalseNegatives) {
+  auto bloom_filter = BloomFilter{10'000, 0.01};
+  EXPECT_EQ(bloom_filter.hash_count(), 7u);
+  for (auto value = int64_t{0}; value < 10'000; ++value) {
+    bloom_filter.insert(mixed_hash(value * 3));
+  }
+  for (auto value = int64_t{0}; value < 10'000; ++value) {
+    ASSERT_TRUE(bloom_filter.may_contain(mixed_hash(value * 3))) << value;
+  }
+  EXPECT_TRUE(bloom_filter.may_contain(mixed_hash(int64_t{27})));
+}
+
+TEST_F(StorageBloomFilterTest, FalsePositiveRate) {
+  for (const auto false_positive_rate : {0.1, 0.01, 0.001}) {
+    auto bloom_filter = BloomFilter{20'000, false_positive_rate};
+    for (auto value = int32_t{0}; value < 20'000; ++value) {
+      bloom_filter.insert(mixed_hash(value));
+    }
+
+    // Consecutive integers, as in ID columns, must not collide more often than random values.
+    auto false_positive_count = 0;
+    const auto lookup_count = 200'000;
+    for (auto value = int32_t{20'000}; value < 20'000 + lookup_count; ++value) {
+      false_positive_count += bloom_filter.may_contain(mixed_hash(value));
+    }
+    EXPECT_LT(false_positive_count, 1.5 * false_positive_rate * lookup_count) << false_positive_rate;
+
+    // A lower rate needs more memory.
+    EXPECT_EQ(bloom_filter.estimate_memory_usage() % 64, 0u);
+    EXPECT_LT(bloom_filter.estimate_memory_usage(), 20'000 * -std::log2(false_positive_rate) * 2.0 / 8);
+  }
+}
+
+TEST_F(StorageBloomFilterTest, Strings) {
+  auto bloom_filter = BloomFilter{100, 0.01};
+  bloom_filter.insert(mixed_hash(std::string{"Alexander"}));
+  EXPECT_TRUE(bloom_filter.may_contain(mixed_hash(std::string{"Alexander"})));
+  EXPECT_FALSE(bloom_filter.may_contain(mixed_hash(std::string{"Bill"})));
+}
+
+TEST_F(StorageBloomFilterTest, MixedHashIsFixed) {
+  // Persisted Bloom filters rely on the hash being the same with every standard library (see utils/hash.hpp).
+  EXPECT_EQ(mixed_hash(int32_t{0}), 0xe220a8397b1dcdafu);
+  EXPECT_EQ(mixed_hash(std::string{"Alexander"}), 0xb89615c24f764f7au);
+  EXPECT_EQ(mixed_hash(int32_t{-5}), mixed_hash(int64_t{-5}));
+  EXPECT_EQ(mixed_hash(-0.0), mixed_hash(0.0));
+  EXPECT_EQ(mixed_hash(-0.0f), mixed_hash(0.0f));
+}
+
+TEST_F(StorageBloomFilterTest, EncodedWords) {
+  auto encoded = BloomFilter{1000, 0.05};
+  for (auto value = 0; value < 1000; ++value) {
+    encoded.insert(mixed_hash(value));
+  }
+  const auto words = std::vector<uint64_t>{encoded.words().begin(), encoded.words().end()};
+  const auto bloom_filter = BloomFilter{words, encoded.hash_count()};
+  EXPECT_EQ(bloom_filter.estimate_memory_usage(), encoded.estimate_memory_usage());
+  for (auto value = 0; value < 1000; ++value) {
+    EXPECT_TRUE(bloom_filter.may_contain(mixed_hash(value)));
+  }
+
+  // partial block, no hash functions, invalid false-positive rates
+  EXPECT_THROW((BloomFilter{std::vector<uint64_t>(7), 3}), std::logic_error);
+  EXPECT_THROW((BloomFilter{std::vector<uint64_t>(8), 0}), std::logic_error);
+  EXPECT_THROW((BloomFilter{10, 0.0}), std::logic_error);
+  EXPECT_THROW((BloomFilter{10, 1.0}), std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,94 @@
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/bound_search.hpp"
+#include "../lib/storage/dictionary_segment.hpp"
+
+namespace opossum {
+
+class StorageBoundSearchTest : public BaseTest {
+ protected:
+  // Creates the sorted values 0, 2, 4, ... so that every odd value lies between two dictionary entries.
+  template <typename T>
+  static std::vector<T> _even_values(const size_t size) {
+    auto values = std::vector<T>{};
+    values.reserve(size);
+    for (auto index = size_t{0}; index < size; ++index) {
+      values.push_back(static_cast<T>(2 * index));
+    }
+    return values;
+  }
+
+  // Compares the search results with std::lower_bound/std::upper_bound for all values and the gaps in between.
+  template <typename T>
+  static void _expect_bounds_match(const std::vector<T>& values) {
+    const auto bound_search = BoundSearch<T>{values.data(), values.size()};
+    for (auto probe = int64_t{-1}; probe <= static_cast<int64_t>(2 * values.size()); ++probe) {
+      const auto value = static_cast<T>(probe);
+      const auto expected_lower = std::lower_bound(values.begin(), values.end(), value) - values.begin();
+      const auto expected_upper = std::upper_bound(values.begin(), values.end(), value) - values.begin();
+      ASSERT_EQ(bound_search.lower_bound(value), static_cast<size_t>(expected_lower)) << "probe " << probe;
+      ASSERT_EQ(bound_search.upper_bound(value), static_cast<size_t>(expected_upper)) << "probe " << probe;
+    }
+  }
+};
+
+TEST_F(StorageBoundSearchTest, EmptyValues) {
+  const auto values = std::vector<int32_t>{};
+  const auto bound_search = BoundSearch<int32_t>{values.data(), values.size()};
+  EXPECT_EQ(bound_search.lower_bound(17), 0u);
+  EXPECT_EQ(bound_search.upper_bound(17), 0u);
+}
+
+TEST_F(StorageBoundSearchTest, BinarySearchSmallSizes) {
+  for (auto size = size_t{1}; size <= 3 * BoundSearch<int32_t>::PROBE_WIDTH; ++size) {
+    _expect_bounds_match(_even_values<int32_t>(size));
+    _expect_bounds_match(_even_values<double>(size));
+  }
+}
+
+TEST_F(StorageBoundSearchTest, EytzingerLayout) {
+  const auto size = BoundSearch<int64_t>::EYTZINGER_THRESHOLD + 7;
+  const auto values = _even_values<int64_t>(size);
+  EXPECT_TRUE((BoundSearch<int64_t>{values.data(), values.size()}.uses_eytzinger_layout()));
+  _expect_bounds_match(values);
+
+  const auto float_values = _even_values<float>(size);
+  _expect_bounds_match(float_values);
+
+  const auto small_values = _even_values<int64_t>(BoundSearch<int64_t>::EYTZINGER_THRESHOLD - 1);
+  EXPECT_FALSE((BoundSearch<int64_t>{small_values.data(), small_values.size()}.uses_eytzinger_layout()));
+}
+
+TEST_F(StorageBoundSearchTest, Strings) {
+  const auto values = std::vector<std::string>{"Alexander", "Bill", "Hasso", "Steve"};
+  const auto bound_search = BoundSearch<std::string>{values.data(), values.size()};
+  EXPECT_FALSE(bound_search.uses_eytzinger_layout());
+
+  EXPECT_EQ(bound_search.lower_bound("Aaron"), 0u);
+  EXPECT_EQ(bound_search.lower_bound("Bill"), 1u);
+  EXPECT_EQ(bound_search.upper_bound("Bill"), 2u);
+  EXPECT_EQ(bound_search.lower_bound("Carl"), 2u);
+  EXPECT_EQ(bound_search.upper_bound("Steve"), 4u);
+  EXPECT_EQ(bound_search.lower_bound("Zoe"), 4u);
+}
+
+TEST_F(StorageBoundSearchTest, LargeDictionarySegment) {
+  auto value_segment = std::make_shared<ValueSegment<int32_t>>();
+  const auto size = static_cast<int32_t>(BoundSearch<int32_t>::EYTZINGER_THRESHOLD * 2);
+  for (auto value = size - 1; value >= 0; --value) value_segment->append(2 * value);
+
+  const auto dictionary_segment = DictionarySegment<int32_t>{value_segment};
+  EXPECT_EQ(dictionary_segment.lower_bound(-5), ValueID{0});
+  EXPECT_EQ(dictionary_segment.lower_bound(1000), ValueID{500});
+  EXPECT_EQ(dictionary_segment.upper_bound(1000), ValueID{501});
+  EXPECT_EQ(dictionary_segment.lower_bound(1001), ValueID{501});
+  EXPECT_EQ(dictionary_segment.upper_bound(2 * size - 2), INVALID_VALUE_ID);
+  EXPECT_EQ(dictionary_segment.lower_bound(2 * size), INVALID_VALUE_ID);
+}
+
+}  // namespace opossum
@@ -0,0 +1,82 @@
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/chunk.hpp"
+#include "../lib/storage/chunk_directory.hpp"
+#include "../lib/types.hpp"
+
+namespace opossum {
+
+class StorageChunkDirectoryTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    for (auto chunk_index = 0; chunk_index < 100; ++chunk_index) {
+      _chunks.push_back(std::make_shared<Chunk>());
+    }
+  }
+
+  std::vector<std::shared_ptr<Chunk>> _chunks;
+};
+
+TEST_F(StorageChunkDirectoryTest, PushBackAndGet) {
+  auto directory = ChunkDirectory{};
+  EXPECT_EQ(directory.size(), 0u);
+  EXPECT_EQ(directory.heap_memory_usage(), 0u);
+  EXPECT_THROW(directory.get(ChunkID{0}), std::logic_error);
+
+  for (const auto& chunk : _chunks) {
+    directory.push_back(*chunk);
+  }
+  EXPECT_EQ(directory.size(), 100u);
+  for (auto chunk_id = ChunkID{0}; chunk_id < 100; ++chunk_id) {
+    EXPECT_EQ(&directory.get(chunk_id), _chunks[chunk_id].get());
+  }
+  EXPECT_THROW(directory.get(ChunkID{100}), std::logic_error);
+
+  // 100 chunks use the blocks of 1, 2, 4, ..., 64 slots.
+  EXPECT_EQ(directory.heap_memory_usage(), 127 * sizeof(Chunk*));
+}
+
+TEST_F(StorageChunkDirectoryTest, Replace) {
+  auto directory = ChunkDirectory{};
+  directory.push_back(*_chunks[0]);
+  directory.push_back(*_chunks[1]);
+  directory.replace(ChunkID{1}, *_chunks[2]);
+  EXPECT_EQ(&directory.get(ChunkID{0}), _chunks[0].get());
+  EXPECT_EQ(&directory.get(ChunkID{1}), _chunks[2].get());
+  EXPECT_THROW(directory.replace(ChunkID{2}, *_chunks[3]), std::logic_error);
+}
+
+TEST_F(StorageChunkDirectoryTest, ReadWhilePushingBack) {
+  auto directory = ChunkDirectory{};
+  auto writer_done = std::atomic_bool{false};
+  auto readers = std::vector<std::thread>{};
+  for (auto reader_index = 0; reader_index < 4; ++reader_index) {
+    readers.emplace_back([&] {
+      while (!writer_done) {
+        // Every chunk below the size that has been read is published completely.
+        const auto chunk_count = directory.size();
+        if (chunk_count > 0) {
+          EXPECT_EQ(&directory.get(ChunkID{chunk_count - 1}), _chunks[chunk_count - 1].get());
+        }
+      }
+    });
+  }
+
+  for (const auto& chunk : _chunks) {
+    directory.push_back(*chunk);
+    std::this_thread::yield();
+  }
+  writer_done = true;
+  for (auto& reader : readers) {
+    reader.join();
+  }
+  EXPECT_EQ(directory.size(), 100u);
+}
+
+}  // namespace opossum
@@ -6,7 +6,12 @@
 #include "../lib/resolve_type.hpp"
 #include "../lib/storage/base_segment.hpp"
 #include "../lib/storage/chunk.hpp"
+#include "../lib/storage/reference_segment.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_segment.hpp"
+#include "../lib/storage/zone_map.hpp"
 #include "../lib/types.hpp"
+#include "../lib/utils/memory_usage.hpp"
 
 namespace opossum {
 
@@ -58,4 +63,58 @@ TEST_F(StorageChunkTest, RetrieveSegment) {
   EXPECT_EQ(base_segment->size(), 4u);
 }
 
+TEST_F(StorageChunkTest, ReplaceSegment) {
+  c.add_segment(int_value_segment);
+  const auto replacement = std::make_shared<ValueSegment<int32_t>>();
+
+  EXPECT_FALSE(c.replace_segment(ColumnID{0}, string_value_segment, replacement));
+  EXPECT_EQ(c.get_segment(ColumnID{0}), int_value_segment);
+  EXPECT_TRUE(c.replace_segment(ColumnID{0}, int_value_segment, replacement));
+  EXPECT_EQ(c.get_segment(ColumnID{0}), replacement);
+}
+
+TEST_F(StorageChunkTest, ZoneMaps) {
+  c.add_segment(int_value_segment);
+  c.add_segment(string_value_segment);
+  EXPECT_FALSE(c.get_zone_map(ColumnID{0}));
+
+  const auto zone_map = std::make_shared<ZoneMap<int32_t>>(3, 6);
+  c.set_zone_map(ColumnID{0}, zone_map);
+  EXPECT_EQ(c.get_zone_map(ColumnID{0}), zone_map);
+  EXPECT_FALSE(c.get_zone_map(ColumnID{1}));
+  EXPECT_THROW(c.get_zone_map(ColumnID{2}), std::out_of_range);
+}
+
+TEST_F(StorageChunkTest, MemoryUsage) {
+  c.add_segment(int_value_segment);
+  c.add_segment(string_value_segment);
+  const auto int_column_memory_usage = c.memory_usage(ColumnID{0});
+  EXPECT_EQ(int_column_memory_usage, int_value_segment->memory_usage() + SHARED_POINTER_CONTROL_BLOCK_SIZE);
+
+  c.set_zone_map(ColumnID{0}, std::make_shared<ZoneMap<int32_t>>(3, 6));
+  EXPECT_EQ(c.memory_usage(ColumnID{0}), int_column_memory_usage + sizeof(ZoneMap<int32_t>) +
+                                             SHARED_POINTER_CONTROL_BLOCK_SIZE);
+  EXPECT_GT(c.memory_usage(), c.memory_usage(ColumnID{0}) + c.memory_usage(ColumnID{1}) + sizeof(Chunk));
+}
+
+TEST_F(StorageChunkTest, MemoryUsageSharedPosList) {
+  const auto table = std::make_shared<Table>();
+  table->add_column("a", "int");
+  table->add_column("b", "int");
+  table->append({1, 2});
+  const auto pos_list = std::make_shared<PosList>(PosList{{ChunkID{0}, 0}});
+  const auto segment = std::make_shared<ReferenceSegment>(table, ColumnID{0}, pos_list);
+  c.add_segment(segment);
+  c.add_segment(std::make_shared<ReferenceSegment>(table, ColumnID{1}, pos_list));
+  EXPECT_EQ(c.memory_usage(ColumnID{0}),
+            segment->memory_usage() + SHARED_POINTER_CONTROL_BLOCK_SIZE + segment->pos_list_memory_usage());
+
+  // Every column includes the shared position list, but the chunk counts it once.
+  auto other_chunk = Chunk{};
+  other_chunk.add_segment(segment);
+  other_chunk.add_segment(std::make_shared<ReferenceSegment>(table, ColumnID{1}, std::make_shared<PosList>(*pos_list)));
+  EXPECT_EQ(c.memory_usage(ColumnID{1}), other_chunk.memory_usage(ColumnID{1}));
+  EXPECT_EQ(other_chunk.memory_usage() - c.memory_usage(), segment->pos_list_memory_usage());
+}
+
 }  // namespace opossum
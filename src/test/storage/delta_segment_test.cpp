@@ -0,0 +1,129 @@
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/delta_segment.hpp"
+#include "../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageDeltaSegmentTest : public BaseTest {
+ protected:
+  // Returns increasing timestamp-like values with duplicates.
+  static std::vector<int64_t> _sorted_values(const size_t count) {
+    auto values = std::vector<int64_t>(count);
+    for (auto index = size_t{0}; index < count; ++index) {
+      values[index] = 1'600'000'000'000 + static_cast<int64_t>(index / 3 * 1000);
+    }
+    return values;
+  }
+
+  template <typename T>
+  static DeltaSegment<T> _encode(const std::vector<T>& values) {
+    return DeltaSegment<T>{std::make_shared<ValueSegment<T>>(std::vector{values})};
+  }
+
+  template <typename T>
+  static void _expect_values(const DeltaSegment<T>& segment, const std::vector<T>& values) {
+    ASSERT_EQ(segment.size(), values.size());
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < values.size(); ++chunk_offset) {
+      ASSERT_EQ(segment.get(chunk_offset), values[chunk_offset]) << "at " << chunk_offset;
+    }
+
+    auto decoded = std::vector<T>(values.size());
+    segment.decode(0, segment.size(), decoded.data());
+    EXPECT_EQ(decoded, values);
+  }
+};
+
+TEST_F(StorageDeltaSegmentTest, CompressSortedSegment) {
+  const auto values = _sorted_values(1000);
+  const auto segment = _encode(values);
+
+  EXPECT_TRUE(segment.is_sorted());
+  EXPECT_EQ(segment.block_first_values().size(), 8u);
+  EXPECT_EQ(segment.block_first_values()[1], values[128]);
+  // 992 deltas take one byte each, the 331 deltas of 1000 outside the first values of blocks take a second byte.
+  EXPECT_EQ(segment.bytes().size(), 992u + 331u);
+  EXPECT_EQ(segment[999], AllTypeVariant{values[999]});
+  _expect_values(segment, values);
+}
+
+TEST_F(StorageDeltaSegmentTest, CompressUnsortedSegment) {
+  // Negative deltas and extreme values, which need the full width.
+  auto values = std::vector<int32_t>{5, 3, -7, std::numeric_limits<int32_t>::max(),
+                                     std::numeric_limits<int32_t>::min()};
+  for (auto index = 0; index < 300; ++index) {
+    values.push_back((index * 7919) % 1000 - 500);
+  }
+  const auto segment = _encode(values);
+
+  EXPECT_FALSE(segment.is_sorted());
+  EXPECT_THROW(segment.lower_bound(0), std::logic_error);
+  _expect_values(segment, values);
+
+  // The differences wrap around: from max to min is +1, which takes one byte, the others take ten bytes.
+  const auto max = std::numeric_limits<int64_t>::max();
+  const auto long_values = std::vector<int64_t>{max, std::numeric_limits<int64_t>::min(), -1, max};
+  const auto long_segment = _encode(long_values);
+  EXPECT_EQ(long_segment.bytes().size(), 1u + 10u + 10u);
+  _expect_values(long_segment, long_values);
+}
+
+TEST_F(StorageDeltaSegmentTest, DecodeRanges) {
+  const auto values = _sorted_values(1000);
+  const auto segment = _encode(values);
+
+  for (const auto& [begin, length] : std::vector<std::pair<ChunkOffset, ChunkOffset>>{
+           {0, 1}, {3, 60}, {127, 2}, {128, 128}, {200, 700}, {990, 10}}) {
+    auto decoded = std::vector<int64_t>(length);
+    segment.decode(begin, length, decoded.data());
+    EXPECT_EQ(decoded, std::vector<int64_t>(values.begin() + begin, values.begin() + begin + length)) << begin;
+  }
+}
+
+TEST_F(StorageDeltaSegmentTest, Bounds) {
+  const auto values = _sorted_values(1000);
+  const auto segment = _encode(values);
+
+  for (const auto search_value : {values.front() - 1, values.front(), values[383] - 1, values[383], values[384],
+                                  values.back(), values.back() + 1}) {
+    EXPECT_EQ(segment.lower_bound(search_value),
+              std::lower_bound(values.begin(), values.end(), search_value) - values.begin());
+    EXPECT_EQ(segment.upper_bound(search_value),
+              std::upper_bound(values.begin(), values.end(), search_value) - values.begin());
+  }
+}
+
+TEST_F(StorageDeltaSegmentTest, MemoryUsage) {
+  const auto segment = _encode(_sorted_values(1000));
+  EXPECT_EQ(segment.estimate_memory_usage(), 8 * (sizeof(int64_t) + sizeof(uint64_t)) + segment.bytes().size());
+
+  const auto empty_segment = _encode(std::vector<int32_t>{});
+  EXPECT_EQ(empty_segment.size(), 0u);
+  EXPECT_EQ(empty_segment.estimate_memory_usage(), 0u);
+}
+
+TEST_F(StorageDeltaSegmentTest, EncodedBlocks) {
+  // 10, then +1 (zigzag 2), then -2 (zigzag 3), then +200 (zigzag 400 = 0x190 as the varint 0x90 0x03)
+  const auto segment = DeltaSegment<int32_t>{{10}, {0}, {2, 3, 0x90, 0x03}, 4};
+  EXPECT_FALSE(segment.is_sorted());
+  _expect_values(segment, std::vector<int32_t>{10, 11, 9, 209});
+
+  EXPECT_THROW((DeltaSegment<int32_t>{{10}, {0}, {2, 3, 0x90}, 4}), std::logic_error);
+  EXPECT_THROW((DeltaSegment<int32_t>{{10}, {0}, {2, 3, 0x90, 0x03, 0}, 4}), std::logic_error);
+  EXPECT_THROW((DeltaSegment<int32_t>{{10}, {1}, {2, 3, 0x90, 0x03}, 4}), std::logic_error);
+  EXPECT_THROW((DeltaSegment<int32_t>{{10, 20}, {0, 4}, {2, 3, 0x90, 0x03}, 4}), std::logic_error);
+}
+
+TEST_F(StorageDeltaSegmentTest, Immutable) {
+  auto segment = _encode(std::vector<int32_t>{1});
+  EXPECT_THROW(segment.append(3), std::exception);
+  EXPECT_THROW(DeltaSegment<int64_t>{std::make_shared<ValueSegment<int32_t>>()}, std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,88 @@
+#include <algorithm>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/dictionary_builder.hpp"
+
+namespace opossum {
+
+class StorageDictionaryBuilderTest : public BaseTest {
+ protected:
+  template <typename T>
+  static std::vector<T> _random_values(const size_t row_count, const int32_t distinct_count) {
+    auto generator = std::mt19937{17};
+    auto distribution = std::uniform_int_distribution<int32_t>{0, distinct_count - 1};
+    auto values = std::vector<T>{};
+    for (auto row = size_t{0}; row < row_count; ++row) {
+      if constexpr (std::is_same_v<T, std::string>) {
+        values.push_back("value " + std::to_string(distribution(generator)));
+      } else {
+        values.push_back(static_cast<T>(distribution(generator)));
+      }
+    }
+    return values;
+  }
+
+  // Checks that the dictionary is sorted and distinct and that every ValueID refers to the value of its row.
+  template <typename T>
+  static void _expect_valid_encoding(const std::vector<T>& values, const BuiltDictionary<T>& built_dictionary) {
+    const auto distinct_values = std::set<T>(values.begin(), values.end());
+    EXPECT_TRUE(std::equal(distinct_values.begin(), distinct_values.end(), built_dictionary.dictionary.begin(),
+                           built_dictionary.dictionary.end()));
+
+    ASSERT_EQ(built_dictionary.value_ids.size(), values.size());
+    for (auto row = size_t{0}; row < values.size(); ++row) {
+      ASSERT_EQ(built_dictionary.dictionary[built_dictionary.value_ids[row]], values[row]) << "row " << row;
+    }
+  }
+};
+
+TEST_F(StorageDictionaryBuilderTest, EmptyInput) {
+  const auto built_dictionary = DictionaryBuilder<int32_t>{}.build({});
+  EXPECT_TRUE(built_dictionary.dictionary.empty());
+  EXPECT_TRUE(built_dictionary.value_ids.empty());
+}
+
+TEST_F(StorageDictionaryBuilderTest, UnsortedInput) {
+  const auto int_values = _random_values<int32_t>(1000, 50);
+  _expect_valid_encoding(int_values, DictionaryBuilder<int32_t>{}.build(int_values));
+
+  const auto double_values = _random_values<double>(1000, 900);
+  _expect_valid_encoding(double_values, DictionaryBuilder<double>{}.build(double_values));
+
+  const auto string_values = _random_values<std::string>(1000, 50);
+  _expect_valid_encoding(string_values, DictionaryBuilder<std::string>{}.build(string_values));
+}
+
+TEST_F(StorageDictionaryBuilderTest, SortedInput) {
+  auto int_values = _random_values<int64_t>(1000, 50);
+  std::sort(int_values.begin(), int_values.end());
+  _expect_valid_encoding(int_values, DictionaryBuilder<int64_t>{}.build(int_values));
+
+  auto string_values = _random_values<std::string>(1000, 50);
+  std::sort(string_values.begin(), string_values.end());
+  _expect_valid_encoding(string_values, DictionaryBuilder<std::string>{}.build(string_values));
+}
+
+TEST_F(StorageDictionaryBuilderTest, ParallelBuild) {
+  // Partitions of 100 rows force a parallel build of 4 partitions with distinct partition dictionaries.
+  const auto builder_int = DictionaryBuilder<int32_t>{4, 100};
+  const auto int_values = _random_values<int32_t>(1000, 300);
+  _expect_valid_encoding(int_values, builder_int.build(int_values));
+
+  const auto builder_float = DictionaryBuilder<float>{4, 100};
+  auto float_values = _random_values<float>(1000, 300);
+  std::sort(float_values.begin(), float_values.end());
+  _expect_valid_encoding(float_values, builder_float.build(float_values));
+
+  const auto builder_string = DictionaryBuilder<std::string>{4, 100};
+  const auto string_values = _random_values<std::string>(1003, 300);
+  _expect_valid_encoding(string_values, builder_string.build(string_values));
+}
+
+}  // namespace opossum
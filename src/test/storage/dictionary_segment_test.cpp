@@ -1,13 +1,16 @@
 #include <memory>
+#include <memory_resource>
 #include <string>
 
 #include "gtest/gtest.h"
 
 #include "../../lib/resolve_type.hpp"
 #include "../../lib/storage/base_segment.hpp"
+#include "../../lib/storage/bit_packed_attribute_vector.hpp"
 #include "../../lib/storage/dictionary_segment.hpp"
 #include "../../lib/storage/value_segment.hpp"
 #include "../../lib/type_cast.hpp"
+#include "../../lib/utils/memory_resources.hpp"
 
 namespace opossum {
 
@@ -57,10 +60,10 @@ TEST_F(StorageDictionarySegmentTest, CompressSegmentString) {
 
   // Test sorting
   auto dict = dict_col->dictionary();
-  EXPECT_EQ((*dict)[0], "Alexander");
-  EXPECT_EQ((*dict)[1], "Bill");
-  EXPECT_EQ((*dict)[2], "Hasso");
-  EXPECT_EQ((*dict)[3], "Steve");
+  EXPECT_EQ(dict[0], "Alexander");
+  EXPECT_EQ(dict[1], "Bill");
+  EXPECT_EQ(dict[2], "Hasso");
+  EXPECT_EQ(dict[3], "Steve");
 }
 
 TEST_F(StorageDictionarySegmentTest, LowerUpperBound) {
@@ -109,8 +112,8 @@ TEST_F(StorageDictionarySegmentTest, ValueByValueID) {
   EXPECT_EQ(2, actualValue);
 }
 
-TEST_F(StorageDictionarySegmentTest, FixedSizeAttributeVector) {
-  // test smallest width
+TEST_F(StorageDictionarySegmentTest, AttributeVectorWidth) {
+  // 10 distinct values need 4 bits
   for (int i = 0; i < 10; i += 1) vc_int->append(i);
 
   auto dict_col = compressIntValueSegment(vc_int);
@@ -118,34 +121,52 @@ TEST_F(StorageDictionarySegmentTest, FixedSizeAttributeVector) {
   auto attributeVector = dict_col->attribute_vector();
 
   auto actualValue = attributeVector->width();
-  EXPECT_EQ(1, actualValue);
+  EXPECT_EQ(4, actualValue);
+  EXPECT_NE(std::dynamic_pointer_cast<BitPackedAttributeVector>(attributeVector), nullptr);
 
-  // 2^8 = 256 -> Adding 247, we now have 257 elements in our vector
-  for (int i = 0; i < 247; i += 1) vc_int->append(i);
+  // 256 distinct values need 8 bits, so a fixed-size vector is used
+  for (int i = 0; i < 256; i += 1) vc_int->append(i);
 
   dict_col = compressIntValueSegment(vc_int);
 
   attributeVector = dict_col->attribute_vector();
 
   actualValue = attributeVector->width();
-  EXPECT_EQ(2, actualValue);
+  EXPECT_EQ(8, actualValue);
+  EXPECT_NE(std::dynamic_pointer_cast<FixedSizeAttributeVector<uint8_t>>(attributeVector), nullptr);
 
-  // 2^16 = 65.536 -> Adding 65.280, we now have 65.537 elements in our vector
-  for (int i = 0; i < 65280; i += 1) vc_int->append(i);
+  // 257 distinct values need 9 bits
+  vc_int->append(256);
 
   dict_col = compressIntValueSegment(vc_int);
 
   attributeVector = dict_col->attribute_vector();
 
   actualValue = attributeVector->width();
-  EXPECT_EQ(4, actualValue);
+  EXPECT_EQ(9, actualValue);
+
+  // 2^16 = 65.536 distinct values need 16 bits, one more needs 17 bits
+  for (int i = 257; i < 65536; i += 1) vc_int->append(i);
+
+  dict_col = compressIntValueSegment(vc_int);
+  EXPECT_EQ(16, dict_col->attribute_vector()->width());
+  EXPECT_NE(std::dynamic_pointer_cast<FixedSizeAttributeVector<uint16_t>>(dict_col->attribute_vector()), nullptr);
+
+  vc_int->append(65536);
+
+  dict_col = compressIntValueSegment(vc_int);
+  EXPECT_EQ(17, dict_col->attribute_vector()->width());
+
+  for (ChunkOffset chunk_offset = 0; chunk_offset < vc_int->size(); ++chunk_offset) {
+    ASSERT_EQ(dict_col->get(chunk_offset), vc_int->values()[chunk_offset]);
+  }
 }
 
 TEST_F(StorageDictionarySegmentTest, MemoryUsage) {
   // 10 elements of size int (4 bytes)
   // dictionary: 10 * 4 = 40 bytes
-  // attribute_vector (uint_8): 10 * 1 = 10
-  // 10 + 40 = 50
+  // attribute_vector (4 bits): 10 * 4 = 40 bits, i.e., one 64-bit word = 8 bytes
+  // 8 + 40 = 48
   for (int i = 0; i < 10; i += 1) {
     vc_int->append(i);
   }
@@ -153,11 +174,11 @@ TEST_F(StorageDictionarySegmentTest, MemoryUsage) {
   auto dict_col = compressIntValueSegment(vc_int);
 
   auto actualValue = dict_col->estimate_memory_usage();
-  EXPECT_EQ(50, actualValue);
+  EXPECT_EQ(48, actualValue);
   // 10 elements of size int (4 bytes)
   // dictionary (10 values): 10 * 4 = 40 bytes
-  // attribute_vector (uint_8): 20 * 1 = 20
-  // 20 + 40 = 60
+  // attribute_vector (4 bits): 20 * 4 = 80 bits, i.e., two 64-bit words = 16 bytes
+  // 16 + 40 = 56
   for (int i = 0; i < 10; i += 1) {
     vc_int->append(1);
   }
@@ -165,7 +186,86 @@ TEST_F(StorageDictionarySegmentTest, MemoryUsage) {
   dict_col = compressIntValueSegment(vc_int);
 
   actualValue = dict_col->estimate_memory_usage();
-  EXPECT_EQ(60, actualValue);
+  EXPECT_EQ(56, actualValue);
+}
+
+TEST_F(StorageDictionarySegmentTest, MemoryUsageString) {
+  // front-coded dictionary (one block): length and characters of "Alexander" = 10 bytes,
+  // "Alexandra" shares 7 characters: 2 lengths and 2 characters = 4 bytes, "Bill": 2 lengths and 4 characters = 6 bytes
+  // block offsets: 8 bytes
+  // attribute_vector (2 bits): one 64-bit word = 8 bytes
+  // 10 + 4 + 6 + 8 + 8 = 36
+  vc_str->append("Bill");
+  vc_str->append("Alexandra");
+  vc_str->append("Alexander");
+  vc_str->append("Bill");
+
+  auto dict_col = compressStringValueSegment(vc_str);
+  EXPECT_EQ(dict_col->estimate_memory_usage(), 36u);
+  EXPECT_EQ(dict_col->value_by_value_id(ValueID{1}), "Alexandra");
+  EXPECT_EQ(dict_col->lower_bound(std::string{"Alexandrb"}), ValueID{2});
+}
+
+TEST_F(StorageDictionarySegmentTest, BloomFilter) {
+  for (int i = 0; i < 1000; i += 1) {
+    vc_int->append(i * 2);
+  }
+
+  const auto dict_col = compressIntValueSegment(vc_int);
+  EXPECT_FALSE(dict_col->bloom_filter());
+  EXPECT_TRUE(dict_col->may_contain(1));
+
+  // 1000 distinct values at 1% need about 1.4 KB, i.e., 23 blocks of 64 bytes.
+  const auto filtered_col = std::make_shared<DictionarySegment<int>>(vc_int, 0.01);
+  ASSERT_TRUE(filtered_col->bloom_filter());
+  EXPECT_EQ(filtered_col->estimate_memory_usage(),
+            dict_col->estimate_memory_usage() + filtered_col->bloom_filter()->estimate_memory_usage());
+  EXPECT_EQ(filtered_col->bloom_filter()->estimate_memory_usage(), 23u * 64u);
+
+  // The attribute vector, the bound search, and the Bloom filter are separate objects with control blocks.
+  EXPECT_GT(dict_col->memory_usage(), dict_col->estimate_memory_usage() + sizeof(DictionarySegment<int>));
+  EXPECT_EQ(filtered_col->memory_usage(), dict_col->memory_usage() + sizeof(BloomFilter) + 23u * 64u +
+                                              SHARED_POINTER_CONTROL_BLOCK_SIZE);
+
+  auto false_positive_count = 0;
+  for (int i = 0; i < 1000; i += 1) {
+    EXPECT_TRUE(filtered_col->may_contain(i * 2));
+    false_positive_count += filtered_col->may_contain(i * 2 + 1);
+  }
+  EXPECT_LT(false_positive_count, 30);
+}
+
+TEST_F(StorageDictionarySegmentTest, MemoryResource) {
+  for (int i = 0; i < 1000; i += 1) {
+    vc_int->append(i % 200);
+    vc_str->append("Value " + std::to_string(i % 20));
+  }
+
+  auto arena = std::make_shared<MonotonicArena>();
+  auto int_col = std::make_shared<DictionarySegment<int>>(vc_int, std::nullopt, arena);
+  const auto string_col = std::make_shared<DictionarySegment<std::string>>(vc_str, std::nullopt, arena);
+  EXPECT_EQ(int_col->dictionary().size(), 200u);
+  EXPECT_EQ(string_col->get(21), "Value 1");
+
+  // The dictionaries and the attribute vectors are allocated from the arena with their final sizes. 200 distinct values
+  // take 8 bits, 20 take 5 bits, i.e., 79 words of 64 bits.
+  EXPECT_EQ(arena->allocated_bytes(), 200 * sizeof(int) + 1000 * sizeof(uint8_t) +
+                                          string_col->dictionary().bytes().size() +
+                                          string_col->dictionary().block_offsets().size() * sizeof(uint64_t) +
+                                          79 * sizeof(uint64_t));
+
+  // The attribute vector has a deleter that keeps the arena alive, so its control block is allocated separately.
+  const auto heap_int_col = DictionarySegment<int>{vc_int};
+  EXPECT_EQ(int_col->memory_usage(), heap_int_col.memory_usage() + sizeof(void*) +
+                                         sizeof(std::shared_ptr<std::pmr::memory_resource>));
+
+  // The attribute vector keeps the arena alive when it outlives the segment.
+  const auto attribute_vector = int_col->attribute_vector();
+  const auto weak_arena = std::weak_ptr<MonotonicArena>{arena};
+  arena.reset();
+  int_col.reset();
+  EXPECT_FALSE(weak_arena.expired());
+  EXPECT_EQ(attribute_vector->get(199), 199u);
 }
 
 }  // namespace opossum
@@ -0,0 +1,117 @@
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/frame_of_reference_segment.hpp"
+#include "../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageFrameOfReferenceSegmentTest : public BaseTest {
+ protected:
+  // Returns values in narrow, shifted ranges: frame f holds values from f * 1'000'000 to f * 1'000'000 + 999.
+  template <typename T>
+  static std::vector<T> _values(const size_t count) {
+    auto values = std::vector<T>(count);
+    for (auto index = size_t{0}; index < count; ++index) {
+      const auto frame = index / FrameOfReferenceSegment<T>::FRAME_SIZE;
+      values[index] = static_cast<T>(frame * 1'000'000 + (index * 7919) % 1000) - T{500'000};
+    }
+    return values;
+  }
+
+  template <typename T>
+  static void _expect_values(const FrameOfReferenceSegment<T>& segment, const std::vector<T>& values) {
+    ASSERT_EQ(segment.size(), values.size());
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < values.size(); ++chunk_offset) {
+      ASSERT_EQ(segment.get(chunk_offset), values[chunk_offset]) << "at " << chunk_offset;
+    }
+
+    auto decoded = std::vector<T>(values.size());
+    segment.decode(0, segment.size(), decoded.data());
+    EXPECT_EQ(decoded, values);
+  }
+};
+
+TEST_F(StorageFrameOfReferenceSegmentTest, CompressSegment) {
+  // Two full frames and a partial one, which ends in the middle of a group.
+  const auto values = _values<int32_t>(5000);
+  const auto segment = FrameOfReferenceSegment<int32_t>{std::make_shared<ValueSegment<int32_t>>(std::vector{values})};
+
+  EXPECT_EQ(segment.frame_count(), 3u);
+  EXPECT_EQ(segment.minima()[1], 500'000);
+  EXPECT_EQ(segment.widths(), (std::vector<AttributeVectorWidth>{10, 10, 10}));
+  EXPECT_EQ(segment.max_offset(0), 1023u);
+  EXPECT_EQ(segment[2048], AllTypeVariant{values[2048]});
+  _expect_values(segment, values);
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, DecodeRanges) {
+  const auto values = _values<int64_t>(5000);
+  const auto segment = FrameOfReferenceSegment<int64_t>{std::make_shared<ValueSegment<int64_t>>(std::vector{values})};
+
+  // Ranges that start and end inside groups and span frames.
+  for (const auto& [begin, length] : std::vector<std::pair<ChunkOffset, ChunkOffset>>{
+           {0, 1}, {3, 60}, {3, 200}, {2000, 100}, {1000, 3500}, {4990, 10}}) {
+    auto decoded = std::vector<int64_t>(length);
+    segment.decode(begin, length, decoded.data());
+    EXPECT_EQ(decoded, std::vector<int64_t>(values.begin() + begin, values.begin() + begin + length)) << begin;
+  }
+
+  auto offsets = std::vector<uint64_t>(100);
+  segment.decode_offsets(2100, 100, offsets.data());
+  for (auto index = ChunkOffset{0}; index < 100; ++index) {
+    EXPECT_EQ(offsets[index], static_cast<uint64_t>(values[2100 + index] - segment.minima()[1]));
+  }
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, ExtremeValues) {
+  // Offsets that need the full width of the type, and frames of equal values that need no bits at all.
+  auto values = std::vector<int64_t>(4096, 42);
+  values[0] = std::numeric_limits<int64_t>::min();
+  values[1] = std::numeric_limits<int64_t>::max();
+  values[2] = -1;
+  const auto segment = FrameOfReferenceSegment<int64_t>{std::make_shared<ValueSegment<int64_t>>(std::vector{values})};
+
+  EXPECT_EQ(segment.widths(), (std::vector<AttributeVectorWidth>{64, 0}));
+  _expect_values(segment, values);
+
+  auto int_values = std::vector<int32_t>{std::numeric_limits<int32_t>::max(), std::numeric_limits<int32_t>::min(), 0};
+  const auto int_segment =
+      FrameOfReferenceSegment<int32_t>{std::make_shared<ValueSegment<int32_t>>(std::vector{int_values})};
+  EXPECT_EQ(int_segment.widths(), (std::vector<AttributeVectorWidth>{32}));
+  _expect_values(int_segment, int_values);
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, MemoryUsage) {
+  const auto values = _values<int64_t>(4096);
+  const auto segment = FrameOfReferenceSegment<int64_t>{std::make_shared<ValueSegment<int64_t>>(std::vector{values})};
+
+  // 10 bits per value instead of 64, plus the minimum, width, and first word of both frames
+  EXPECT_EQ(segment.words().size(), 4096u * 10 / 64);
+  EXPECT_EQ(segment.estimate_memory_usage(), 4096 * 10 / 8 + 2 * (sizeof(int64_t) + 1 + sizeof(size_t)));
+
+  const auto empty_segment = FrameOfReferenceSegment<int32_t>{std::make_shared<ValueSegment<int32_t>>()};
+  EXPECT_EQ(empty_segment.size(), 0u);
+  EXPECT_EQ(empty_segment.estimate_memory_usage(), 0u);
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, EncodedFrames) {
+  const auto segment = FrameOfReferenceSegment<int32_t>{{10}, {2}, {0b11'10'01'00}, 4};
+  _expect_values(segment, std::vector<int32_t>{10, 11, 12, 13});
+
+  EXPECT_THROW((FrameOfReferenceSegment<int32_t>{{10}, {2}, {}, 4}), std::logic_error);
+  EXPECT_THROW((FrameOfReferenceSegment<int32_t>{{10}, {33}, {0, 0, 0}, 4}), std::logic_error);
+  EXPECT_THROW((FrameOfReferenceSegment<int32_t>{{10, 20}, {0, 0}, {}, 4}), std::logic_error);
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, Immutable) {
+  auto segment = FrameOfReferenceSegment<int32_t>{std::make_shared<ValueSegment<int32_t>>(std::vector<int32_t>{1})};
+  EXPECT_THROW(segment.append(3), std::exception);
+  EXPECT_THROW(FrameOfReferenceSegment<int64_t>{std::make_shared<ValueSegment<int32_t>>()}, std::logic_error);
+}
+
+}  // namespace opossum
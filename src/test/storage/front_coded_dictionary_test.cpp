@@ -0,0 +1,132 @@
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/front_coded_dictionary.hpp"
+
+namespace opossum {
+
+class StorageFrontCodedDictionaryTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Sorted strings with long shared prefixes, spanning several blocks. "" is the smallest string.
+    _values.emplace_back("");
+    for (auto index = 0; index < 100; ++index) {
+      _values.push_back("customer#" + std::string(index < 10 ? "00" : "0") + std::to_string(index * 10));
+    }
+    _values.emplace_back(300, 'z');
+    ASSERT_TRUE(std::is_sorted(_values.begin(), _values.end()));
+  }
+
+  std::vector<std::string> _values;
+};
+
+TEST_F(StorageFrontCodedDictionaryTest, Get) {
+  const auto dictionary = FrontCodedDictionary{_values};
+  ASSERT_EQ(dictionary.size(), _values.size());
+  EXPECT_EQ(dictionary.block_offsets().size(), 7u);
+
+  auto value = std::string{"reused"};
+  for (auto position = size_t{0}; position < _values.size(); ++position) {
+    EXPECT_EQ(dictionary[position], _values[position]);
+    dictionary.get(position, value);
+    EXPECT_EQ(value, _values[position]);
+  }
+}
+
+TEST_F(StorageFrontCodedDictionaryTest, Bounds) {
+  const auto dictionary = FrontCodedDictionary{_values};
+
+  auto search_values = _values;
+  search_values.insert(search_values.end(), {"a", "customer#", "customer#0155", "customer#9", "zz", "{"});
+  for (const auto& search_value : search_values) {
+    EXPECT_EQ(dictionary.lower_bound(search_value),
+              std::lower_bound(_values.begin(), _values.end(), search_value) - _values.begin())
+        << search_value;
+    EXPECT_EQ(dictionary.upper_bound(search_value),
+              std::upper_bound(_values.begin(), _values.end(), search_value) - _values.begin())
+        << search_value;
+  }
+
+  const auto empty_dictionary = FrontCodedDictionary{std::vector<std::string>{}};
+  EXPECT_EQ(empty_dictionary.size(), 0u);
+  EXPECT_EQ(empty_dictionary.lower_bound("a"), 0u);
+  EXPECT_EQ(empty_dictionary.estimate_memory_usage(), 0u);
+}
+
+TEST_F(StorageFrontCodedDictionaryTest, MemoryUsage) {
+  const auto dictionary = FrontCodedDictionary{_values};
+  auto characters = size_t{0};
+  for (const auto& value : _values) {
+    characters += value.size();
+  }
+
+  // Shared prefixes are only stored at the start of every block.
+  EXPECT_LT(dictionary.bytes().size(), characters / 2);
+  EXPECT_EQ(dictionary.estimate_memory_usage(), dictionary.bytes().size() + 7 * sizeof(uint64_t));
+}
+
+TEST_F(StorageFrontCodedDictionaryTest, CompressedCharacters) {
+  // Few shared prefixes, but many repeated substrings, which the symbol table covers.
+  auto values = std::vector<std::string>{};
+  for (auto index = 0; index < 2000; ++index) {
+    values.push_back(std::to_string(index * 7) + ".example.com/path/to/resource?user=guest");
+  }
+  std::sort(values.begin(), values.end());
+  values.erase(std::unique(values.begin(), values.end()), values.end());
+
+  const auto dictionary = FrontCodedDictionary{values};
+  ASSERT_TRUE(dictionary.is_compressed());
+  EXPECT_FALSE(FrontCodedDictionary{_values}.is_compressed());
+  EXPECT_EQ(dictionary.estimate_memory_usage(), dictionary.bytes().size() +
+                                                    dictionary.block_offsets().size() * sizeof(uint64_t) +
+                                                    dictionary.symbol_table().estimate_memory_usage());
+
+  for (auto position = size_t{0}; position < values.size(); position += 7) {
+    EXPECT_EQ(dictionary[position], values[position]);
+  }
+  auto search_values = std::vector<std::string>{"", "1", "1000.example.com", "5.example.com/path/to/resource?user=z"};
+  search_values.insert(search_values.end(), values.begin(), values.begin() + 40);
+  for (const auto& search_value : search_values) {
+    EXPECT_EQ(dictionary.lower_bound(search_value),
+              std::lower_bound(values.begin(), values.end(), search_value) - values.begin())
+        << search_value;
+    EXPECT_EQ(dictionary.upper_bound(search_value),
+              std::upper_bound(values.begin(), values.end(), search_value) - values.begin())
+        << search_value;
+  }
+
+  auto bytes = dictionary.bytes();
+  auto block_offsets = dictionary.block_offsets();
+  auto symbols = dictionary.symbol_table().symbols();
+  auto symbol_lengths = dictionary.symbol_table().symbol_lengths();
+  const auto decoded_dictionary =
+      FrontCodedDictionary{std::move(bytes), std::move(block_offsets), values.size(),
+                           FsstSymbolTable{std::move(symbols), std::move(symbol_lengths)}};
+  EXPECT_EQ(decoded_dictionary[1234], values[1234]);
+}
+
+TEST_F(StorageFrontCodedDictionaryTest, EncodedBlocks) {
+  const auto encoded = FrontCodedDictionary{_values};
+  auto bytes = encoded.bytes();
+  auto block_offsets = encoded.block_offsets();
+  const auto dictionary = FrontCodedDictionary{std::move(bytes), std::move(block_offsets), _values.size()};
+  EXPECT_EQ(dictionary[57], _values[57]);
+
+  // "ab" followed by "abc", which shares two characters and adds one
+  const auto valid_bytes = pmr_vector<char>{2, 'a', 'b', 2, 1, 'c'};
+  EXPECT_EQ((FrontCodedDictionary{pmr_vector<char>{valid_bytes}, {0}, 2}[1]), "abc");
+
+  // prefix longer than the previous string, suffix beyond the buffer, unsorted, superfluous bytes, wrong block count
+  EXPECT_THROW((FrontCodedDictionary{{2, 'a', 'b', 3, 1, 'c'}, {0}, 2}), std::logic_error);
+  EXPECT_THROW((FrontCodedDictionary{{2, 'a', 'b', 2, 2, 'c'}, {0}, 2}), std::logic_error);
+  EXPECT_THROW((FrontCodedDictionary{{2, 'a', 'b', 1, 0}, {0}, 2}), std::logic_error);
+  EXPECT_THROW((FrontCodedDictionary{pmr_vector<char>{valid_bytes}, {0}, 1}), std::logic_error);
+  EXPECT_THROW((FrontCodedDictionary{pmr_vector<char>{valid_bytes}, {0, 3}, 2}), std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,83 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/fsst_segment.hpp"
+#include "../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageFsstSegmentTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    for (auto index = 0; index < 1000; ++index) {
+      _value_segment->append("https://shop.example.org/category/" + std::to_string(index % 13) + "/item/" +
+                             std::to_string(index * 7919));
+    }
+  }
+
+  std::shared_ptr<ValueSegment<std::string>> _value_segment = std::make_shared<ValueSegment<std::string>>();
+};
+
+TEST_F(StorageFsstSegmentTest, CompressSegment) {
+  auto segment = FsstSegment{_value_segment};
+  ASSERT_EQ(segment.size(), _value_segment->size());
+  EXPECT_EQ(segment.offsets().size(), segment.size() + 1u);
+
+  auto value = std::string{"reused"};
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment.size(); ++chunk_offset) {
+    EXPECT_EQ(segment.get(chunk_offset), _value_segment->values()[chunk_offset]);
+    segment.get(chunk_offset, value);
+    EXPECT_EQ(value, _value_segment->values()[chunk_offset]);
+  }
+  EXPECT_EQ(segment[5], AllTypeVariant{_value_segment->values()[5]});
+  EXPECT_THROW(segment.append(std::string{"new"}), std::exception);
+}
+
+TEST_F(StorageFsstSegmentTest, CompareCompressedValues) {
+  const auto segment = FsstSegment{_value_segment};
+  const auto compressed_value = segment.compress(_value_segment->values()[17]);
+  const auto expected_value = std::vector<uint8_t>{segment.compressed_value(17).begin(),
+                                                   segment.compressed_value(17).end()};
+  EXPECT_EQ(compressed_value, expected_value);
+  EXPECT_NE(segment.compress("https://shop.example.org/category/4/item/"), expected_value);
+}
+
+TEST_F(StorageFsstSegmentTest, MemoryUsage) {
+  const auto segment = FsstSegment{_value_segment};
+  auto characters = size_t{0};
+  for (const auto& value : _value_segment->values()) {
+    characters += value.size();
+  }
+
+  EXPECT_LT(segment.bytes().size(), characters / 2);
+  EXPECT_LT(segment.estimate_memory_usage(), _value_segment->estimate_memory_usage());
+  EXPECT_EQ(segment.estimate_memory_usage(), segment.symbol_table().estimate_memory_usage() + segment.bytes().size() +
+                                                 segment.offsets().size() * sizeof(uint32_t));
+}
+
+TEST_F(StorageFsstSegmentTest, EncodedValues) {
+  const auto encoded = FsstSegment{_value_segment};
+  auto symbols = encoded.symbol_table().symbols();
+  auto symbol_lengths = encoded.symbol_table().symbol_lengths();
+  auto bytes = encoded.bytes();
+  auto offsets = encoded.offsets();
+  const auto segment = FsstSegment{FsstSymbolTable{std::move(symbols), std::move(symbol_lengths)}, std::move(bytes),
+                                   std::move(offsets)};
+  EXPECT_EQ(segment.get(999), _value_segment->values()[999]);
+
+  const auto escape_code = FsstSymbolTable::ESCAPE_CODE;
+  EXPECT_EQ((FsstSegment{FsstSymbolTable{}, {escape_code, 'a'}, {0, 0, 2}}.get(1)), "a");
+
+  // offsets beyond the bytes, decreasing offsets, escape code without byte, code without symbol
+  EXPECT_THROW((FsstSegment{FsstSymbolTable{}, {escape_code, 'a'}, {0, 3}}), std::logic_error);
+  EXPECT_THROW((FsstSegment{FsstSymbolTable{}, {escape_code, 'a'}, {0, 2, 1, 2}}), std::logic_error);
+  EXPECT_THROW((FsstSegment{FsstSymbolTable{}, {escape_code, 'a'}, {0, 1, 2}}), std::logic_error);
+  EXPECT_THROW((FsstSegment{FsstSymbolTable{}, {0}, {0, 1}}), std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,102 @@
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/fsst_symbol_table.hpp"
+
+namespace opossum {
+
+class StorageFsstSymbolTableTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    for (auto index = 0; index < 500; ++index) {
+      _values.push_back("https://www.example.com/products/" + std::to_string(index * 37) + "?ref=search&page=" +
+                        std::to_string(index % 7));
+    }
+  }
+
+  std::vector<uint8_t> _compress(const FsstSymbolTable& symbol_table, const std::string_view value) const {
+    auto compressed_value = std::vector<uint8_t>{};
+    symbol_table.compress(value, compressed_value);
+    return compressed_value;
+  }
+
+  std::string _decompress(const FsstSymbolTable& symbol_table, const std::vector<uint8_t>& compressed_value) const {
+    auto value = std::string{};
+    symbol_table.decompress(compressed_value, value);
+    return value;
+  }
+
+  std::vector<std::string> _values;
+};
+
+TEST_F(StorageFsstSymbolTableTest, CompressAndDecompress) {
+  const auto symbol_table = FsstSymbolTable::build({_values.begin(), _values.end()});
+  EXPECT_GT(symbol_table.symbol_count(), 0u);
+  EXPECT_LE(symbol_table.symbol_count(), FsstSymbolTable::MAX_SYMBOL_COUNT);
+
+  auto characters = size_t{0};
+  auto compressed_bytes = size_t{0};
+  for (const auto& value : _values) {
+    const auto compressed_value = _compress(symbol_table, value);
+    symbol_table.validate(compressed_value);
+    EXPECT_EQ(_decompress(symbol_table, compressed_value), value);
+    characters += value.size();
+    compressed_bytes += compressed_value.size();
+  }
+  // The shared parts of the URLs are covered by symbols of up to eight bytes.
+  EXPECT_LT(compressed_bytes, characters / 3);
+
+  // Values that are not in the sample still round-trip, with escape codes for unknown bytes.
+  for (const auto& value : {std::string{}, std::string{"\xff\x00\x01 unseen", 10}, std::string(1000, 'q')}) {
+    EXPECT_EQ(_decompress(symbol_table, _compress(symbol_table, value)), value);
+  }
+
+  // Decompressing appends to the output.
+  auto output = std::string{"prefix "};
+  symbol_table.decompress(_compress(symbol_table, _values[3]), output);
+  EXPECT_EQ(output, "prefix " + _values[3]);
+}
+
+TEST_F(StorageFsstSymbolTableTest, EqualValuesHaveEqualCodes) {
+  const auto symbol_table = FsstSymbolTable::build({_values.begin(), _values.end()});
+  EXPECT_EQ(_compress(symbol_table, _values[42]), _compress(symbol_table, std::string{_values[42]}));
+  EXPECT_NE(_compress(symbol_table, _values[42]), _compress(symbol_table, _values[43]));
+}
+
+TEST_F(StorageFsstSymbolTableTest, EmptySymbolTable) {
+  const auto symbol_table = FsstSymbolTable{};
+  EXPECT_EQ(symbol_table.symbol_count(), 0u);
+  EXPECT_EQ(_compress(symbol_table, "ab"), (std::vector<uint8_t>{FsstSymbolTable::ESCAPE_CODE, 'a',
+                                                                 FsstSymbolTable::ESCAPE_CODE, 'b'}));
+  EXPECT_EQ(_decompress(symbol_table, _compress(symbol_table, "ab")), "ab");
+
+  const auto empty_values = std::vector<std::string_view>{};
+  EXPECT_EQ(FsstSymbolTable::build(empty_values).symbol_count(), 0u);
+}
+
+TEST_F(StorageFsstSymbolTableTest, EncodedSymbols) {
+  // "abc" and "a" share their first byte, so the longer one comes first.
+  auto symbols = std::vector<uint64_t>{0, 0, 0};
+  std::memcpy(&symbols[0], "abc", 3);
+  std::memcpy(&symbols[1], "a", 1);
+  std::memcpy(&symbols[2], "x", 1);
+  const auto symbol_table = FsstSymbolTable{std::vector<uint64_t>{symbols}, {3, 1, 2}};
+  EXPECT_EQ(_compress(symbol_table, "abcab"), (std::vector<uint8_t>{0, 1, FsstSymbolTable::ESCAPE_CODE, 'b'}));
+  EXPECT_EQ(_decompress(symbol_table, {0, 2, 1}), std::string("abcx\0a", 6));
+
+  // unsorted symbols, missing lengths, invalid length, unknown code, escape code at the end
+  EXPECT_THROW((FsstSymbolTable{std::vector<uint64_t>{symbols[2], symbols[0]}, {1, 3}}), std::logic_error);
+  EXPECT_THROW((FsstSymbolTable{std::vector<uint64_t>{symbols[1], symbols[0]}, {1, 3}}), std::logic_error);
+  EXPECT_THROW((FsstSymbolTable{std::vector<uint64_t>{symbols}, {3, 1}}), std::logic_error);
+  EXPECT_THROW((FsstSymbolTable{std::vector<uint64_t>{symbols[0]}, {9}}), std::logic_error);
+  EXPECT_THROW(symbol_table.validate(std::vector<uint8_t>{0, 3}), std::logic_error);
+  EXPECT_THROW(symbol_table.validate(std::vector<uint8_t>{0, FsstSymbolTable::ESCAPE_CODE}), std::logic_error);
+}
+
+}  // namespace opossum
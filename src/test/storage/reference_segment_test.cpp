@@ -0,0 +1,56 @@
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/reference_segment.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class StorageReferenceSegmentTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(3);
+    _table->add_column("a", "int");
+    _table->add_column("b", "string");
+    for (auto row = 0; row < 6; ++row) {
+      _table->append({row, "v" + std::to_string(row)});
+    }
+    _table->compress_chunk(ChunkID{1});
+
+    _pos_list = std::make_shared<PosList>(PosList{{ChunkID{1}, 2}, {ChunkID{0}, 0}, {ChunkID{1}, 0}});
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<PosList> _pos_list;
+};
+
+TEST_F(StorageReferenceSegmentTest, RetrievesValues) {
+  const auto segment = ReferenceSegment{_table, ColumnID{1}, _pos_list};
+  EXPECT_EQ(segment.size(), 3u);
+  EXPECT_EQ(segment[0], AllTypeVariant{"v5"});
+  EXPECT_EQ(segment[1], AllTypeVariant{"v0"});
+  EXPECT_EQ(segment[2], AllTypeVariant{"v3"});
+  EXPECT_THROW(segment[3], std::exception);
+}
+
+TEST_F(StorageReferenceSegmentTest, Accessors) {
+  const auto segment = ReferenceSegment{_table, ColumnID{0}, _pos_list};
+  EXPECT_EQ(segment.referenced_table(), _table);
+  EXPECT_EQ(segment.referenced_column_id(), ColumnID{0});
+  EXPECT_EQ(segment.pos_list(), _pos_list);
+  EXPECT_EQ(segment.estimate_memory_usage(), 3 * sizeof(RowID));
+}
+
+TEST_F(StorageReferenceSegmentTest, Immutable) {
+  auto segment = ReferenceSegment{_table, ColumnID{0}, _pos_list};
+  EXPECT_THROW(segment.append(1), std::logic_error);
+}
+
+TEST_F(StorageReferenceSegmentTest, InvalidReferencedColumn) {
+  EXPECT_THROW((ReferenceSegment{_table, ColumnID{2}, _pos_list}), std::logic_error);
+}
+
+}  // namespace opossum
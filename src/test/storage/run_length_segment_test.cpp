@@ -0,0 +1,75 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/run_length_segment.hpp"
+#include "../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageRunLengthSegmentTest : public BaseTest {
+ protected:
+  std::shared_ptr<ValueSegment<int32_t>> int_value_segment =
+      std::make_shared<ValueSegment<int32_t>>(std::vector<int32_t>{4, 4, 4, 1, 1, 4, 7, 7, 7, 7});
+  std::shared_ptr<ValueSegment<std::string>> string_value_segment = std::make_shared<ValueSegment<std::string>>(
+      std::vector<std::string>{"Bill", "Bill", "Steve", "Alexander", "Alexander"});
+};
+
+TEST_F(StorageRunLengthSegmentTest, CompressSegment) {
+  const auto segment = RunLengthSegment<int32_t>{int_value_segment};
+
+  EXPECT_EQ(segment.size(), 10u);
+  EXPECT_EQ(segment.run_count(), 4u);
+  EXPECT_EQ(segment.values(), (std::vector<int32_t>{4, 1, 4, 7}));
+  EXPECT_EQ(segment.end_positions(), (std::vector<ChunkOffset>{3, 5, 6, 10}));
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment.size(); ++chunk_offset) {
+    EXPECT_EQ(segment.get(chunk_offset), int_value_segment->values()[chunk_offset]);
+    EXPECT_EQ(segment[chunk_offset], AllTypeVariant{int_value_segment->values()[chunk_offset]});
+  }
+  EXPECT_EQ(segment.run_index(2), 0u);
+  EXPECT_EQ(segment.run_index(3), 1u);
+  EXPECT_EQ(segment.run_index(9), 3u);
+  EXPECT_THROW(segment[10], std::logic_error);
+}
+
+TEST_F(StorageRunLengthSegmentTest, CompressStringSegment) {
+  const auto segment = RunLengthSegment<std::string>{string_value_segment};
+
+  EXPECT_EQ(segment.values(), (std::vector<std::string>{"Bill", "Steve", "Alexander"}));
+  EXPECT_EQ(segment.end_positions(), (std::vector<ChunkOffset>{2, 3, 5}));
+  EXPECT_EQ(segment[4], AllTypeVariant{"Alexander"});
+}
+
+TEST_F(StorageRunLengthSegmentTest, EmptySegment) {
+  const auto segment = RunLengthSegment<int32_t>{std::make_shared<ValueSegment<int32_t>>()};
+
+  EXPECT_EQ(segment.size(), 0u);
+  EXPECT_EQ(segment.run_count(), 0u);
+  EXPECT_EQ(segment.estimate_memory_usage(), 0u);
+}
+
+TEST_F(StorageRunLengthSegmentTest, EncodedRuns) {
+  const auto segment = RunLengthSegment<int32_t>{{4, 1}, {3, 5}};
+  EXPECT_EQ(segment.size(), 5u);
+  EXPECT_EQ(segment.get(3), 1);
+
+  EXPECT_THROW((RunLengthSegment<int32_t>{{4, 1}, {3}}), std::logic_error);
+  EXPECT_THROW((RunLengthSegment<int32_t>{{4, 1}, {3, 3}}), std::logic_error);
+  EXPECT_THROW((RunLengthSegment<int32_t>{{4}, {0}}), std::logic_error);
+}
+
+TEST_F(StorageRunLengthSegmentTest, Immutable) {
+  auto segment = RunLengthSegment<int32_t>{int_value_segment};
+  EXPECT_THROW(segment.append(3), std::exception);
+  EXPECT_THROW(RunLengthSegment<int64_t>{int_value_segment}, std::logic_error);
+}
+
+TEST_F(StorageRunLengthSegmentTest, MemoryUsage) {
+  const auto segment = RunLengthSegment<int32_t>{int_value_segment};
+  EXPECT_EQ(segment.estimate_memory_usage(), 4 * sizeof(int32_t) + 4 * sizeof(ChunkOffset));
+}
+
+}  // namespace opossum
@@ -0,0 +1,193 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/delta_segment.hpp"
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/frame_of_reference_segment.hpp"
+#include "../lib/storage/fsst_segment.hpp"
+#include "../lib/storage/reference_segment.hpp"
+#include "../lib/storage/run_length_segment.hpp"
+#include "../lib/storage/segment_iterate.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageSegmentIterateTest : public BaseTest {
+ protected:
+  // Returns the values and offsets that segment_iterate passes to the functor.
+  template <typename T>
+  static std::vector<std::pair<T, ChunkOffset>> _iterate(const BaseSegment& segment) {
+    auto result = std::vector<std::pair<T, ChunkOffset>>{};
+    segment_iterate<T>(segment, [&](const SegmentPosition<T>& position) {
+      result.emplace_back(position.value(), position.chunk_offset());
+    });
+    return result;
+  }
+
+  template <typename T>
+  static std::vector<std::pair<T, ChunkOffset>> _expected(const std::vector<T>& values) {
+    auto result = std::vector<std::pair<T, ChunkOffset>>{};
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < values.size(); ++chunk_offset) {
+      result.emplace_back(values[chunk_offset], chunk_offset);
+    }
+    return result;
+  }
+
+  static std::shared_ptr<ValueSegment<int32_t>> _value_segment(const std::vector<int32_t>& values) {
+    auto segment = std::make_shared<ValueSegment<int32_t>>();
+    for (const auto value : values) {
+      segment->append(value);
+    }
+    return segment;
+  }
+};
+
+TEST_F(StorageSegmentIterateTest, IterateValueSegment) {
+  auto segment = std::make_shared<ValueSegment<std::string>>();
+  segment->append("Bill");
+  segment->append("Steve");
+  segment->append("Alexander");
+
+  EXPECT_EQ(_iterate<std::string>(*segment), _expected<std::string>({"Bill", "Steve", "Alexander"}));
+}
+
+TEST_F(StorageSegmentIterateTest, IterateDictionarySegments) {
+  // The number of distinct values determines the attribute vector: bit-packed for 3 and 1000 distinct values,
+  // fixed-size with one and two bytes for 200 and 40000 distinct values.
+  for (const auto distinct_count : {3, 200, 1000, 40000}) {
+    auto values = std::vector<int32_t>{};
+    for (auto row = 0; row < std::max(1500, distinct_count); ++row) {
+      values.push_back((row * 7) % distinct_count);
+    }
+    const auto segment = DictionarySegment<int32_t>{_value_segment(values)};
+    EXPECT_EQ(_iterate<int32_t>(segment), _expected(values)) << distinct_count << " distinct values";
+  }
+}
+
+TEST_F(StorageSegmentIterateTest, IterateRunLengthSegment) {
+  const auto values = std::vector<int32_t>{2, 2, 2, 5, 3, 3, 9, 9, 9, 9};
+  const auto segment = RunLengthSegment<int32_t>{_value_segment(values)};
+  EXPECT_EQ(_iterate<int32_t>(segment), _expected(values));
+
+  // Positions that stay in a run, move to the next one, skip runs, and jump back.
+  const auto positions = PosList{{ChunkID{0}, 1}, {ChunkID{0}, 3}, {ChunkID{0}, 4}, {ChunkID{0}, 8},
+                                 {ChunkID{0}, 0}, {ChunkID{0}, 5}, {ChunkID{0}, 6}};
+  auto result = std::vector<int32_t>{};
+  segment_with_iterators<int32_t>(segment, positions.data(), positions.data() + positions.size(),
+                                  [&](auto begin, const auto end) {
+                                    for (; begin != end; ++begin) {
+                                      result.push_back((*begin).value());
+                                    }
+                                  });
+  EXPECT_EQ(result, (std::vector<int32_t>{2, 5, 3, 9, 2, 3, 9}));
+}
+
+TEST_F(StorageSegmentIterateTest, IterateFrameOfReferenceSegment) {
+  auto values = std::vector<int32_t>{};
+  for (auto row = 0; row < 3000; ++row) {
+    values.push_back(row * 3 - 1000);
+  }
+  const auto segment = FrameOfReferenceSegment<int32_t>{_value_segment(values)};
+  EXPECT_EQ(_iterate<int32_t>(segment), _expected(values));
+}
+
+TEST_F(StorageSegmentIterateTest, IterateDeltaSegment) {
+  auto values = std::vector<int32_t>{};
+  for (auto row = 0; row < 300; ++row) {
+    values.push_back(row * (row % 2 ? 3 : -3));
+  }
+  const auto segment = DeltaSegment<int32_t>{_value_segment(values)};
+  EXPECT_EQ(_iterate<int32_t>(segment), _expected(values));
+
+  // Positions that continue sequentially, repeat, cross blocks, and jump back.
+  const auto positions = PosList{{ChunkID{0}, 5},   {ChunkID{0}, 6},   {ChunkID{0}, 6}, {ChunkID{0}, 127},
+                                 {ChunkID{0}, 128}, {ChunkID{0}, 299}, {ChunkID{0}, 2}};
+  auto result = std::vector<int32_t>{};
+  segment_with_iterators<int32_t>(segment, positions.data(), positions.data() + positions.size(),
+                                  [&](auto begin, const auto end) {
+                                    for (; begin != end; ++begin) {
+                                      result.push_back((*begin).value());
+                                    }
+                                  });
+  EXPECT_EQ(result, (std::vector<int32_t>{values[5], values[6], values[6], values[127], values[128], values[299],
+                                          values[2]}));
+}
+
+TEST_F(StorageSegmentIterateTest, IterateFsstSegment) {
+  auto values = std::vector<std::string>{};
+  auto value_segment = std::make_shared<ValueSegment<std::string>>();
+  for (auto row = 0; row < 300; ++row) {
+    values.push_back(row % 10 == 0 ? "" : "/index.html?session=" + std::to_string(row * 31));
+    value_segment->append(values.back());
+  }
+  const auto segment = FsstSegment{value_segment};
+  EXPECT_EQ(_iterate<std::string>(segment), _expected(values));
+
+  const auto positions = PosList{{ChunkID{0}, 20}, {ChunkID{0}, 7}, {ChunkID{0}, 7}, {ChunkID{0}, 299}};
+  auto result = std::vector<std::string>{};
+  segment_with_iterators<std::string>(segment, positions.data(), positions.data() + positions.size(),
+                                      [&](auto begin, const auto end) {
+                                        for (; begin != end; ++begin) {
+                                          result.push_back((*begin).value());
+                                        }
+                                      });
+  EXPECT_EQ(result, (std::vector<std::string>{values[20], values[7], values[7], values[299]}));
+}
+
+TEST_F(StorageSegmentIterateTest, IteratorsWithPositions) {
+  const auto values = std::vector<int32_t>{5, 3, 8, 3, 1};
+  const auto value_segment = _value_segment(values);
+  const auto dictionary_segment = DictionarySegment<int32_t>{value_segment};
+  const auto positions = PosList{{ChunkID{0}, 4}, {ChunkID{0}, 0}, {ChunkID{0}, 3}};
+
+  for (const BaseSegment* segment : {static_cast<const BaseSegment*>(value_segment.get()),
+                                     static_cast<const BaseSegment*>(&dictionary_segment)}) {
+    auto result = std::vector<std::pair<int32_t, ChunkOffset>>{};
+    segment_with_iterators<int32_t>(*segment, positions.data(), positions.data() + positions.size(),
+                                    [&](auto begin, const auto end) {
+                                      for (; begin != end; ++begin) {
+                                        result.emplace_back((*begin).value(), (*begin).chunk_offset());
+                                      }
+                                    });
+    EXPECT_EQ(result, _expected<int32_t>({1, 5, 3}));
+  }
+}
+
+TEST_F(StorageSegmentIterateTest, IterateReferenceSegment) {
+  auto table = std::make_shared<Table>(3);
+  table->add_column("a", "int");
+  for (auto row = 0; row < 8; ++row) {
+    table->append({row * 10});
+  }
+  table->compress_chunk(ChunkID{1});
+
+  // The positions switch between value and dictionary segments and revisit chunks.
+  const auto pos_list = std::make_shared<PosList>(
+      PosList{{ChunkID{1}, 2}, {ChunkID{1}, 0}, {ChunkID{0}, 1}, {ChunkID{2}, 1}, {ChunkID{1}, 1}, {ChunkID{0}, 0}});
+  const auto segment = ReferenceSegment{table, ColumnID{0}, pos_list};
+
+  EXPECT_EQ(_iterate<int32_t>(segment), _expected<int32_t>({50, 30, 10, 70, 40, 0}));
+}
+
+TEST_F(StorageSegmentIterateTest, IteratorsRejectReferenceSegments) {
+  auto table = std::make_shared<Table>(3);
+  table->add_column("a", "int");
+  table->append({1});
+  const auto segment = ReferenceSegment{table, ColumnID{0}, std::make_shared<PosList>(1, RowID{ChunkID{0}, 0})};
+
+  EXPECT_THROW(segment_with_iterators<int32_t>(segment, [](auto, auto) {}), std::logic_error);
+}
+
+TEST_F(StorageSegmentIterateTest, WrongDataType) {
+  const auto segment = _value_segment({1, 2});
+  EXPECT_THROW(segment_iterate<int64_t>(*segment, [](const auto&) {}), std::logic_error);
+}
+
+}  // namespace opossum
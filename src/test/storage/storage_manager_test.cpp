@@ -1,4 +1,9 @@
+#include <filesystem>
 #include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include "../base_test.hpp"
 #include "gtest/gtest.h"
@@ -50,4 +55,103 @@ TEST_F(StorageStorageManagerTest, HasTable) {
   EXPECT_EQ(sm.has_table("first_table"), true);
 }
 
+TEST_F(StorageStorageManagerTest, SaveAndLoad) {
+  auto& sm = StorageManager::get();
+  sm.get_table("second_table")->add_column("a", "int");
+  sm.get_table("second_table")->append({42});
+  const auto directory = (std::filesystem::temp_directory_path() / "opossum_storage_manager_test").string();
+
+  sm.save(directory);
+  sm.reset();
+  sm.add_table("second_table", std::make_shared<Table>());
+  sm.load(directory);
+  std::filesystem::remove_all(directory);
+
+  EXPECT_TRUE(sm.has_table("first_table"));
+  EXPECT_EQ(sm.get_table("second_table")->target_chunk_size(), 4u);
+  EXPECT_EQ(sm.get_table("second_table")->row_count(), 1u);
+}
+
+TEST_F(StorageStorageManagerTest, MemoryUsageReport) {
+  auto& sm = StorageManager::get();
+  const auto table = sm.get_table("second_table");
+  table->add_column("a", "int");
+  table->add_column("b", "string");
+  for (auto row = 0; row < 10; ++row) {
+    table->append({row, std::string(100, 'a')});
+  }
+  table->wait_for_background_compressions();
+
+  const auto report = sm.memory_usage_report();
+  ASSERT_EQ(report.size(), 2u);
+  // The larger table comes first.
+  EXPECT_EQ(report[0].table_name, "second_table");
+  EXPECT_EQ(report[0].total_bytes, table->memory_usage());
+  ASSERT_EQ(report[0].column_bytes.size(), 2u);
+  EXPECT_EQ(report[0].column_bytes[1], table->column_memory_usage(ColumnID{1}));
+  EXPECT_GT(report[0].column_bytes[1], report[0].column_bytes[0]);
+  EXPECT_GT(report[0].total_bytes, report[0].column_bytes[0] + report[0].column_bytes[1]);
+  EXPECT_EQ(report[1].table_name, "first_table");
+  EXPECT_TRUE(report[1].column_bytes.empty());
+
+  auto output = std::stringstream{};
+  sm.print_memory_usage(output);
+  const auto table_line = "Table second_table: " + std::to_string(report[0].total_bytes) + " bytes, 3 chunks, 10 rows";
+  EXPECT_NE(output.str().find(table_line), std::string::npos);
+  EXPECT_NE(output.str().find("  b (string): " + std::to_string(report[0].column_bytes[1]) + " bytes"),
+            std::string::npos);
+  EXPECT_NE(output.str().find("Total: "), std::string::npos);
+}
+
+TEST_F(StorageStorageManagerTest, SaveInvalidTableName) {
+  auto& sm = StorageManager::get();
+  sm.add_table("invalid/name", std::make_shared<Table>());
+  const auto directory = (std::filesystem::temp_directory_path() / "opossum_storage_manager_test").string();
+
+  EXPECT_THROW(sm.save(directory), std::logic_error);
+  std::filesystem::remove_all(directory);
+}
+
+TEST_F(StorageStorageManagerTest, ConcurrentAccess) {
+  auto& sm = StorageManager::get();
+  auto threads = std::vector<std::thread>{};
+  for (auto writer_index = 0; writer_index < 2; ++writer_index) {
+    threads.emplace_back([&, writer_index] {
+      for (auto table_index = 0; table_index < 200; ++table_index) {
+        const auto name = "table_" + std::to_string(writer_index) + "_" + std::to_string(table_index);
+        sm.add_table(name, std::make_shared<Table>());
+        if (table_index % 2 == 0) sm.drop_table(name);
+      }
+    });
+  }
+  for (auto reader_index = 0; reader_index < 4; ++reader_index) {
+    threads.emplace_back([&] {
+      for (auto lookup = 0; lookup < 2000; ++lookup) {
+        EXPECT_EQ(sm.get_table("first_table")->target_chunk_size(), Table{}.target_chunk_size());
+        EXPECT_TRUE(sm.has_table("second_table"));
+        EXPECT_GE(sm.table_names().size(), 2u);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(sm.table_names().size(), 2u + 2u * 100u);
+  EXPECT_TRUE(sm.has_table("table_1_199"));
+  EXPECT_FALSE(sm.has_table("table_1_198"));
+}
+
+TEST_F(StorageStorageManagerTest, DroppedTableOutlivesReaders) {
+  auto& sm = StorageManager::get();
+  auto table = sm.get_table("second_table");
+  const auto weak_table = std::weak_ptr<Table>{table};
+  sm.drop_table("second_table");
+  EXPECT_FALSE(sm.has_table("second_table"));
+  EXPECT_EQ(table->target_chunk_size(), 4u);
+
+  // The table is freed once the last reader releases it.
+  table.reset();
+  EXPECT_TRUE(weak_table.expired());
+}
+
 }  // namespace opossum
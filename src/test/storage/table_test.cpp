@@ -1,6 +1,11 @@
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
 #include <limits>
 #include <memory>
+#include <memory_resource>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -8,7 +13,14 @@
 #include "gtest/gtest.h"
 
 #include "../lib/resolve_type.hpp"
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/frame_of_reference_segment.hpp"
+#include "../lib/storage/reference_segment.hpp"
+#include "../lib/storage/run_length_segment.hpp"
 #include "../lib/storage/table.hpp"
+#include "../lib/storage/value_segment.hpp"
+#include "../lib/storage/zone_map.hpp"
+#include "../lib/utils/memory_resources.hpp"
 
 namespace opossum {
 
@@ -20,6 +32,11 @@ class StorageTableTest : public BaseTest {
   }
 
   Table t{2};
+
+  static bool _is_compressed(const Chunk& chunk) {
+    return std::dynamic_pointer_cast<DictionarySegment<int32_t>>(chunk.get_segment(ColumnID{0})) &&
+           std::dynamic_pointer_cast<DictionarySegment<std::string>>(chunk.get_segment(ColumnID{1}));
+  }
 };
 
 TEST_F(StorageTableTest, ChunkCount) {
@@ -89,6 +106,32 @@ TEST_F(StorageTableTest, PrivateAddSegment) {
   EXPECT_THROW(lastSegment->append("String"), std::exception);
 }
 
+TEST_F(StorageTableTest, EmplaceChunk) {
+  t.append({4, "Hello,"});
+  t.append({6, "world"});
+  t.append({3, "!"});
+  const auto referenced_table = std::make_shared<Table>(2);
+  referenced_table->add_column("col_1", "int");
+
+  auto reference_table = Table{2};
+  reference_table.add_column_definition("col_1", "int");
+  EXPECT_EQ(reference_table.get_chunk(ChunkID{0}).column_count(), 0u);
+
+  // The chunks of reference tables may have different sizes than the target chunk size.
+  const auto pos_list = std::make_shared<PosList>(3, RowID{ChunkID{0}, 0});
+  auto chunk = std::make_shared<Chunk>();
+  chunk->add_segment(std::make_shared<ReferenceSegment>(referenced_table, ColumnID{0}, pos_list));
+  reference_table.emplace_chunk(chunk);
+  EXPECT_EQ(reference_table.chunk_count(), 1u);
+  EXPECT_EQ(reference_table.row_count(), 3u);
+
+  reference_table.emplace_chunk(chunk);
+  EXPECT_EQ(reference_table.chunk_count(), 2u);
+  EXPECT_EQ(reference_table.row_count(), 6u);
+
+  EXPECT_THROW(t.emplace_chunk(chunk), std::logic_error);
+}
+
 TEST_F(StorageTableTest, CompressChunk) {
   t.append({1, "Value 1"});
   t.append({2, "Value 2"});
@@ -100,10 +143,391 @@ TEST_F(StorageTableTest, CompressChunk) {
   EXPECT_THROW(compressed_chunk.append({3, "Invalid Append"}), std::runtime_error);
 }
 
+TEST_F(StorageTableTest, CompressChunkTwice) {
+  t.set_background_compression(false);
+  t.append({1, "Value 1"});
+  t.append({2, "Value 2"});
+
+  t.compress_chunk(ChunkID{0});
+  const auto compressed_segment = t.get_chunk(ChunkID{0}).get_segment(ColumnID{0});
+  t.compress_chunk(ChunkID{0});
+
+  EXPECT_EQ(t.get_chunk(ChunkID{0}).get_segment(ColumnID{0}), compressed_segment);
+  EXPECT_EQ(t.completed_compression_count(), 1u);
+}
+
+TEST_F(StorageTableTest, CompressChunkRunLength) {
+  t.set_background_compression(false);
+  t.append({1, "Value 1"});
+  t.append({1, "Value 2"});
+
+  t.compress_chunk(ChunkID{0}, EncodingType::RunLength);
+  const auto& chunk = t.get_chunk(ChunkID{0});
+  const auto int_segment = std::dynamic_pointer_cast<RunLengthSegment<int32_t>>(chunk.get_segment(ColumnID{0}));
+  ASSERT_TRUE(int_segment);
+  EXPECT_EQ(int_segment->run_count(), 1u);
+  EXPECT_TRUE(std::dynamic_pointer_cast<RunLengthSegment<std::string>>(chunk.get_segment(ColumnID{1})));
+  EXPECT_EQ((*chunk.get_segment(ColumnID{1}))[1], AllTypeVariant{"Value 2"});
+  EXPECT_EQ(t.completed_compression_count(), 1u);
+}
+
+TEST_F(StorageTableTest, CompressChunkFrameOfReference) {
+  t.set_background_compression(false);
+  t.append({1'000'000, "Value 1"});
+  t.append({1'000'003, "Value 2"});
+
+  t.compress_chunk(ChunkID{0}, EncodingType::FrameOfReference);
+  const auto& chunk = t.get_chunk(ChunkID{0});
+  const auto int_segment =
+      std::dynamic_pointer_cast<FrameOfReferenceSegment<int32_t>>(chunk.get_segment(ColumnID{0}));
+  ASSERT_TRUE(int_segment);
+  EXPECT_EQ(int_segment->widths()[0], 2u);
+  EXPECT_EQ((*int_segment)[1], AllTypeVariant{1'000'003});
+  EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<std::string>>(chunk.get_segment(ColumnID{1})));
+}
+
+TEST_F(StorageTableTest, CompressChunkCreatesZoneMaps) {
+  t.set_background_compression(false);
+  t.append({5, "Value 5"});
+  t.append({3, "Value 3"});
+  t.append({4, "Value 4"});
+  EXPECT_FALSE(t.get_chunk(ChunkID{0}).get_zone_map(ColumnID{0}));
+
+  t.compress_chunk(ChunkID{0}, EncodingType::RunLength);
+  const auto& chunk = t.get_chunk(ChunkID{0});
+  const auto int_zone_map = std::dynamic_pointer_cast<const ZoneMap<int32_t>>(chunk.get_zone_map(ColumnID{0}));
+  ASSERT_TRUE(int_zone_map);
+  EXPECT_EQ(int_zone_map->min(), 3);
+  EXPECT_EQ(int_zone_map->max(), 5);
+  const auto string_zone_map =
+      std::dynamic_pointer_cast<const ZoneMap<std::string>>(chunk.get_zone_map(ColumnID{1}));
+  ASSERT_TRUE(string_zone_map);
+  EXPECT_EQ(string_zone_map->min(), "Value 3");
+
+  // The partial chunk is not compressed and has no zone maps.
+  EXPECT_FALSE(t.get_chunk(ChunkID{1}).get_zone_map(ColumnID{0}));
+}
+
+TEST_F(StorageTableTest, CompressChunkWithBloomFilters) {
+  t.set_background_compression(false);
+  t.append({1, "Value 1"});
+  t.append({2, "Value 2"});
+  t.append({3, "Value 3"});
+  t.append({4, "Value 4"});
+  EXPECT_THROW(t.set_bloom_filter_false_positive_rate(1.5), std::logic_error);
+
+  t.compress_chunk(ChunkID{0});
+  t.set_bloom_filter_false_positive_rate(0.05);
+  t.compress_chunk(ChunkID{1}, EncodingType::FrameOfReference);
+
+  const auto segment_without_filter =
+      std::dynamic_pointer_cast<DictionarySegment<int32_t>>(t.get_chunk(ChunkID{0}).get_segment(ColumnID{0}));
+  ASSERT_TRUE(segment_without_filter);
+  EXPECT_FALSE(segment_without_filter->bloom_filter());
+
+  // The string column falls back to dictionary encoding and gets a Bloom filter, too.
+  const auto segment_with_filter =
+      std::dynamic_pointer_cast<DictionarySegment<std::string>>(t.get_chunk(ChunkID{1}).get_segment(ColumnID{1}));
+  ASSERT_TRUE(segment_with_filter);
+  EXPECT_TRUE(segment_with_filter->bloom_filter());
+  EXPECT_TRUE(segment_with_filter->may_contain("Value 4"));
+}
+
+TEST_F(StorageTableTest, BackgroundCompression) {
+  for (auto row = 0; row < 5; ++row) {
+    t.append({row % 2, "Value " + std::to_string(row % 2)});
+  }
+  t.wait_for_background_compressions();
+
+  EXPECT_EQ(t.pending_compression_count(), 0u);
+  EXPECT_EQ(t.completed_compression_count(), 2u);
+  EXPECT_TRUE(_is_compressed(t.get_chunk(ChunkID{0})));
+  EXPECT_TRUE(_is_compressed(t.get_chunk(ChunkID{1})));
+  EXPECT_FALSE(_is_compressed(t.get_chunk(ChunkID{2})));
+  EXPECT_EQ((*t.get_chunk(ChunkID{1}).get_segment(ColumnID{1}))[1], AllTypeVariant{"Value 1"});
+}
+
+TEST_F(StorageTableTest, DisabledBackgroundCompression) {
+  t.set_background_compression(false);
+  t.append({1, "Value 1"});
+  t.append({2, "Value 2"});
+
+  EXPECT_EQ(t.completed_compression_count(), 0u);
+  EXPECT_TRUE(std::dynamic_pointer_cast<ValueSegment<int32_t>>(t.get_chunk(ChunkID{0}).get_segment(ColumnID{0})));
+}
+
+TEST_F(StorageTableTest, CompressionBytesSaved) {
+  // Repeated long strings are stored only once in the dictionary.
+  auto table = Table{100};
+  table.add_column("a", "string");
+  for (auto row = 0; row < 100; ++row) {
+    table.append({std::string(100, 'a')});
+  }
+  table.wait_for_background_compressions();
+
+  EXPECT_EQ(table.completed_compression_count(), 1u);
+  EXPECT_GT(table.compression_bytes_saved(), 0);
+}
+
+TEST_F(StorageTableTest, AppendColumns) {
+  t.set_background_compression(false);
+  t.append({0, "Value 0"});
+  auto int_values = std::vector<int32_t>{1, 2, 3, 4};
+  auto string_values = std::vector<std::string>{"Value 1", "Value 2", "Value 3", "Value 4"};
+  const auto int_batch = std::make_shared<ValueSegment<int32_t>>(std::move(int_values));
+  const auto string_batch = std::make_shared<ValueSegment<std::string>>(std::move(string_values));
+
+  t.append_columns({int_batch, string_batch});
+  EXPECT_EQ(t.row_count(), 5u);
+  EXPECT_EQ(t.chunk_count(), 3u);
+  EXPECT_EQ(int_batch->size(), 0u);
+  EXPECT_EQ(string_batch->size(), 0u);
+  for (auto row = 0; row < 5; ++row) {
+    const auto& chunk = t.get_chunk(ChunkID{static_cast<uint32_t>(row / 2)});
+    EXPECT_EQ((*chunk.get_segment(ColumnID{0}))[row % 2], AllTypeVariant{row});
+    EXPECT_EQ((*chunk.get_segment(ColumnID{1}))[row % 2], AllTypeVariant{"Value " + std::to_string(row)});
+  }
+}
+
+TEST_F(StorageTableTest, AppendColumnsTakesOverBuffer) {
+  auto table = Table{4};
+  table.add_column("a", "int");
+  auto values = pmr_vector<int32_t>{1, 2, 3};
+  const auto* data = values.data();
+
+  table.append_columns({std::make_shared<ValueSegment<int32_t>>(std::move(values))});
+  const auto segment =
+      std::dynamic_pointer_cast<ValueSegment<int32_t>>(table.get_chunk(ChunkID{0}).get_segment(ColumnID{0}));
+  ASSERT_TRUE(segment);
+  EXPECT_EQ(segment->values().data(), data);
+}
+
+TEST_F(StorageTableTest, AppendColumnsFail) {
+  const auto int_batch = std::make_shared<ValueSegment<int32_t>>(std::vector<int32_t>{1, 2});
+  const auto string_batch = std::make_shared<ValueSegment<std::string>>(std::vector<std::string>{"a"});
+  EXPECT_THROW(t.append_columns({int_batch}), std::logic_error);
+  EXPECT_THROW(t.append_columns({int_batch, string_batch}), std::logic_error);
+  EXPECT_THROW(t.append_columns({int_batch, int_batch}), std::logic_error);
+
+  // Failing calls leave the table and the batches unchanged.
+  EXPECT_EQ(t.row_count(), 0u);
+  EXPECT_EQ(t.get_chunk(ChunkID{0}).get_segment(ColumnID{0})->size(), 0u);
+  EXPECT_EQ(t.get_chunk(ChunkID{0}).get_segment(ColumnID{1})->size(), 0u);
+  EXPECT_EQ(int_batch->size(), 2u);
+  EXPECT_EQ(string_batch->size(), 1u);
+}
+
+TEST_F(StorageTableTest, AppendConcurrently) {
+  auto table = Table{100};
+  table.add_column("a", "int");
+  table.add_column("b", "string");
+
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_index = 0; thread_index < 4; ++thread_index) {
+    threads.emplace_back([&, thread_index] {
+      for (auto row = thread_index * 1000; row < (thread_index + 1) * 1000; ++row) {
+        table.append_concurrently({row, std::to_string(row)});
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  table.finish_concurrent_appends();
+  table.wait_for_background_compressions();
+
+  EXPECT_EQ(table.row_count(), 4000u);
+  EXPECT_EQ(table.chunk_count(), 40u);
+  auto values = std::vector<int32_t>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto& chunk = table.get_chunk(chunk_id);
+    ASSERT_EQ(chunk.size(), 100u);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk.size(); ++chunk_offset) {
+      const auto value = type_cast<int32_t>((*chunk.get_segment(ColumnID{0}))[chunk_offset]);
+      EXPECT_EQ((*chunk.get_segment(ColumnID{1}))[chunk_offset], AllTypeVariant{std::to_string(value)});
+      values.push_back(value);
+    }
+  }
+  std::sort(values.begin(), values.end());
+  for (auto row = 0; row < 4000; ++row) {
+    EXPECT_EQ(values[row], row);
+  }
+}
+
+TEST_F(StorageTableTest, GetChunkWhileAppendingAndCompressing) {
+  auto table = Table{100};
+  table.add_column("a", "int");
+
+  auto writer_done = std::atomic_bool{false};
+  auto reader = std::thread{[&] {
+    while (!writer_done) {
+      // The first chunk is replaced once it is full, so only its successors are read.
+      const auto chunk_count = table.chunk_count();
+      for (auto chunk_id = ChunkID{1}; chunk_id < chunk_count; ++chunk_id) {
+        EXPECT_EQ(table.get_chunk(chunk_id).size(), 100u);
+      }
+    }
+  }};
+  for (auto row = 0; row < 10000; ++row) {
+    table.append_concurrently({row});
+  }
+  writer_done = true;
+  reader.join();
+  table.wait_for_background_compressions();
+
+  EXPECT_EQ(table.chunk_count(), 100u);
+  EXPECT_EQ(table.completed_compression_count(), 100u);
+}
+
+TEST_F(StorageTableTest, CompressChunkReplacesWholeChunk) {
+  auto table = Table{1000};
+  table.set_background_compression(false);
+  for (auto column_index = 0; column_index < 8; ++column_index) {
+    table.add_column("col_" + std::to_string(column_index), "int");
+  }
+  for (auto row = 0; row < 1000; ++row) {
+    table.append(std::vector<AllTypeVariant>(8, row % 10));
+  }
+
+  const auto& uncompressed_chunk = table.get_chunk(ChunkID{0});
+  auto reader_done = std::atomic_bool{false};
+  auto reader = std::thread{[&] {
+    while (!reader_done) {
+      // A chunk that is looked up is either uncompressed or compressed as a whole, with all zone maps.
+      const auto& chunk = table.get_chunk(ChunkID{0});
+      if (&chunk == &uncompressed_chunk) continue;
+      for (auto column_id = ColumnID{0}; column_id < 8; ++column_id) {
+        EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<int32_t>>(chunk.get_segment(column_id)));
+        EXPECT_TRUE(chunk.get_zone_map(column_id));
+      }
+    }
+  }};
+  table.compress_chunk(ChunkID{0});
+  reader_done = true;
+  reader.join();
+
+  const auto& compressed_chunk = table.get_chunk(ChunkID{0});
+  EXPECT_NE(&compressed_chunk, &uncompressed_chunk);
+  // The replaced chunk stays valid and has been switched to the compressed segments, column by column.
+  EXPECT_EQ(uncompressed_chunk.get_segment(ColumnID{3}), compressed_chunk.get_segment(ColumnID{3}));
+  EXPECT_EQ((*uncompressed_chunk.get_segment(ColumnID{3}))[999], AllTypeVariant{9});
+
+  // Compressing it again keeps the chunk.
+  table.compress_chunk(ChunkID{0});
+  EXPECT_EQ(&table.get_chunk(ChunkID{0}), &compressed_chunk);
+  EXPECT_EQ(table.completed_compression_count(), 1u);
+}
+
+TEST_F(StorageTableTest, FinishConcurrentAppends) {
+  t.append_concurrently({1, "Value 1"});
+  t.append_concurrently({2, "Value 2"});
+  t.append_concurrently({3, "Value 3"});
+  EXPECT_EQ(t.row_count(), 2u);
+
+  t.finish_concurrent_appends();
+  EXPECT_EQ(t.row_count(), 3u);
+  EXPECT_EQ(t.chunk_count(), 2u);
+  EXPECT_EQ((*t.get_chunk(ChunkID{1}).get_segment(ColumnID{1}))[0], AllTypeVariant{"Value 3"});
+
+  t.finish_concurrent_appends();
+  EXPECT_EQ(t.chunk_count(), 2u);
+}
+
+TEST_F(StorageTableTest, AppendConcurrentlyNeedsTargetChunkSize) {
+  auto table = Table{};
+  table.add_column("a", "int");
+  EXPECT_THROW(table.append_concurrently({1}), std::logic_error);
+}
+
+TEST_F(StorageTableTest, SaveAndLoad) {
+  t.append({1, "Value 1"});
+  t.append({2, "Value 2"});
+  t.append({3, "Value 3"});
+  t.wait_for_background_compressions();
+  const auto file_name = (std::filesystem::temp_directory_path() / "opossum_table_test.bin").string();
+
+  t.save(file_name);
+  const auto table = Table::load(file_name);
+  std::filesystem::remove(file_name);
+
+  EXPECT_TABLE_EQ(*table, t, true);
+  EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<std::string>>(
+      table->get_chunk(ChunkID{0}).get_segment(ColumnID{1})));
+}
+
+TEST_F(StorageTableTest, CompressChunkKeepsColumnOrder) {
+  // With many columns, the compression of a later column likely finishes before that of an earlier one.
+  auto table = Table{2};
+  for (auto column_index = 0; column_index < 16; ++column_index) {
+    table.add_column("col_" + std::to_string(column_index), column_index % 2 == 0 ? "int" : "string");
+  }
+  for (auto row_index = 0; row_index < 2; ++row_index) {
+    auto row = std::vector<AllTypeVariant>{};
+    for (auto column_index = 0; column_index < 16; ++column_index) {
+      if (column_index % 2 == 0) {
+        row.emplace_back(column_index * 10 + row_index);
+      } else {
+        row.emplace_back(std::to_string(column_index * 10 + row_index));
+      }
+    }
+    table.append(row);
+  }
+
+  table.compress_chunk(ChunkID{0});
+
+  const auto& chunk = table.get_chunk(ChunkID{0});
+  for (auto column_index = 0; column_index < 16; ++column_index) {
+    const auto& segment = *chunk.get_segment(ColumnID{static_cast<ColumnID::base_type>(column_index)});
+    for (auto row_index = 0; row_index < 2; ++row_index) {
+      if (column_index % 2 == 0) {
+        EXPECT_EQ(type_cast<int32_t>(segment[row_index]), column_index * 10 + row_index);
+      } else {
+        EXPECT_EQ(type_cast<std::string>(segment[row_index]), std::to_string(column_index * 10 + row_index));
+      }
+    }
+  }
+}
+
 TEST_F(StorageTableTest, CompressOnlyFullChunks) {
   t.append({1, "Insufficient Row"});
 
   EXPECT_THROW(t.compress_chunk(ChunkID{0}), std::exception);
 }
 
+TEST_F(StorageTableTest, CompressWithMemoryResource) {
+  // Counts the bytes that the arenas of the compressed chunks request.
+  class CountingResource : public std::pmr::memory_resource {
+   public:
+    size_t allocated_bytes = 0;
+
+   protected:
+    void* do_allocate(size_t bytes, size_t alignment) final {
+      allocated_bytes += bytes;
+      return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* pointer, size_t bytes, size_t alignment) final {
+      allocated_bytes -= bytes;
+      std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+    }
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept final { return this == &other; }
+  };
+
+  const auto resource = std::make_shared<CountingResource>();
+  auto table = std::make_shared<Table>(2);
+  table->add_column("col_1", "int");
+  table->add_column("col_2", "string");
+  table->set_background_compression(false);
+  table->set_memory_resource(resource);
+  table->append({4, "Hello,"});
+  table->append({6, "world"});
+  table->compress_chunk(ChunkID{0});
+  EXPECT_TRUE(_is_compressed(table->get_chunk(ChunkID{0})));
+  EXPECT_GT(resource->allocated_bytes, 0u);
+  EXPECT_EQ((*table->get_chunk(ChunkID{0}).get_segment(ColumnID{1}))[1], AllTypeVariant{"world"});
+
+  // The arena of the chunk is released with its last segment.
+  table.reset();
+  EXPECT_EQ(resource->allocated_bytes, 0u);
+}
+
 }  // namespace opossum
@@ -1,4 +1,5 @@
 #include <limits>
+#include <memory_resource>
 #include <string>
 #include <vector>
 
@@ -6,6 +7,7 @@
 #include "gtest/gtest.h"
 
 #include "../lib/storage/value_segment.hpp"
+#include "../lib/utils/memory_resources.hpp"
 
 namespace opossum {
 
@@ -82,4 +84,33 @@ TEST_F(StorageValueSegmentTest, MemoryUsage) {
   EXPECT_EQ(int_value_segment.estimate_memory_usage(), size_t{8});
 }
 
+TEST_F(StorageValueSegmentTest, AllocatedMemoryUsage) {
+  // Unused capacity is included.
+  int_value_segment.values().reserve(100);
+  int_value_segment.append(1);
+  EXPECT_EQ(int_value_segment.memory_usage(), sizeof(ValueSegment<int>) + 100 * sizeof(int));
+
+  // Short strings are stored inside the string objects, long ones on the heap.
+  string_value_segment.values().reserve(2);
+  string_value_segment.append("Hello");
+  EXPECT_EQ(string_value_segment.memory_usage(), sizeof(ValueSegment<std::string>) + 2 * sizeof(std::string));
+  const auto long_string = std::string(100, 'a');
+  string_value_segment.append(long_string);
+  EXPECT_GE(string_value_segment.memory_usage(),
+            sizeof(ValueSegment<std::string>) + 2 * sizeof(std::string) + long_string.size());
+  EXPECT_GT(string_value_segment.memory_usage(), string_value_segment.estimate_memory_usage() + long_string.size());
+}
+
+TEST_F(StorageValueSegmentTest, MemoryResource) {
+  auto arena = MonotonicArena{};
+  auto segment = ValueSegment<int>{ChunkOffset{10}, &arena};
+  segment.set(ChunkOffset{9}, 4);
+  EXPECT_EQ(segment.values().get_allocator().resource(), &arena);
+  EXPECT_EQ(arena.allocated_bytes(), 10 * sizeof(int));
+
+  const auto copied_segment = ValueSegment<int>{std::vector<int>{1, 2, 3}, &arena};
+  EXPECT_EQ(copied_segment.values().back(), 3);
+  EXPECT_EQ(arena.allocated_bytes(), 13 * sizeof(int));
+}
+
 }  // namespace opossum
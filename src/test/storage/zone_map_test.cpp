@@ -0,0 +1,77 @@
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/fsst_segment.hpp"
+#include "../lib/storage/run_length_segment.hpp"
+#include "../lib/storage/value_segment.hpp"
+#include "../lib/storage/zone_map.hpp"
+
+namespace opossum {
+
+class StorageZoneMapTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    for (const auto value : {17, 12, 30, 12, 25}) {
+      _int_segment->append(value);
+      _string_segment->append("v" + std::to_string(value));
+    }
+  }
+
+  std::shared_ptr<ValueSegment<int32_t>> _int_segment = std::make_shared<ValueSegment<int32_t>>();
+  std::shared_ptr<ValueSegment<std::string>> _string_segment = std::make_shared<ValueSegment<std::string>>();
+};
+
+TEST_F(StorageZoneMapTest, FromSegment) {
+  const auto dictionary_zone_map = ZoneMap<int32_t>::from_segment(DictionarySegment<int32_t>{_int_segment});
+  EXPECT_EQ(dictionary_zone_map->min(), 12);
+  EXPECT_EQ(dictionary_zone_map->max(), 30);
+
+  const auto run_length_zone_map = ZoneMap<int32_t>::from_segment(RunLengthSegment<int32_t>{_int_segment});
+  EXPECT_EQ(run_length_zone_map->min(), 12);
+  EXPECT_EQ(run_length_zone_map->max(), 30);
+
+  const auto string_zone_map = ZoneMap<std::string>::from_segment(DictionarySegment<std::string>{_string_segment});
+  EXPECT_EQ(string_zone_map->min(), "v12");
+  EXPECT_EQ(string_zone_map->max(), "v30");
+
+  const auto fsst_zone_map = ZoneMap<std::string>::from_segment(FsstSegment{_string_segment});
+  EXPECT_EQ(fsst_zone_map->min(), "v12");
+  EXPECT_EQ(fsst_zone_map->max(), "v30");
+  EXPECT_EQ(fsst_zone_map->estimate_memory_usage(), 2 * sizeof(std::string));
+
+  EXPECT_THROW(ZoneMap<int32_t>::from_segment(ValueSegment<int32_t>{}), std::logic_error);
+}
+
+TEST_F(StorageZoneMapTest, PruneAndMatchAll) {
+  const auto zone_map = ZoneMap<int32_t>{10, 20};
+  // Every scan type with search values below, at the bounds of, inside, and above the range
+  const auto search_values = std::vector<int32_t>{9, 10, 15, 20, 21};
+  const auto expectations = std::vector<std::tuple<ScanType, std::vector<bool>, std::vector<bool>>>{
+      {ScanType::OpEquals, {true, false, false, false, true}, {false, false, false, false, false}},
+      {ScanType::OpNotEquals, {false, false, false, false, false}, {true, false, false, false, true}},
+      {ScanType::OpLessThan, {true, true, false, false, false}, {false, false, false, false, true}},
+      {ScanType::OpLessThanEquals, {true, false, false, false, false}, {false, false, false, true, true}},
+      {ScanType::OpGreaterThan, {false, false, false, true, true}, {true, false, false, false, false}},
+      {ScanType::OpGreaterThanEquals, {false, false, false, false, true}, {true, true, false, false, false}}};
+  for (const auto& [scan_type, can_prune, matches_all] : expectations) {
+    for (auto index = size_t{0}; index < search_values.size(); ++index) {
+      EXPECT_EQ(zone_map.can_prune(scan_type, search_values[index]), can_prune[index])
+          << "scan type " << static_cast<int>(scan_type) << ", value " << search_values[index];
+      EXPECT_EQ(zone_map.matches_all(scan_type, search_values[index]), matches_all[index])
+          << "scan type " << static_cast<int>(scan_type) << ", value " << search_values[index];
+    }
+  }
+
+  // A single distinct value matches all or none for (not) equals.
+  const auto single_value_zone_map = ZoneMap<int32_t>{7, 7};
+  EXPECT_TRUE(single_value_zone_map.matches_all(ScanType::OpEquals, 7));
+  EXPECT_TRUE(single_value_zone_map.can_prune(ScanType::OpNotEquals, 7));
+}
+
+}  // namespace opossum
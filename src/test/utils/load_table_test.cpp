@@ -0,0 +1,149 @@
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/statistics/table_statistics.hpp"
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/zone_map.hpp"
+#include "../lib/utils/load_table.hpp"
+
+namespace opossum {
+
+class UtilsLoadTableTest : public BaseTest {
+ protected:
+  void TearDown() override { std::filesystem::remove(_file_name); }
+
+  // Writes the content to a temporary .tbl file and returns its name.
+  const std::string& _write_file(const std::string& content) {
+    auto file = std::ofstream{_file_name};
+    file << content;
+    return _file_name;
+  }
+
+  const std::string _file_name = (std::filesystem::temp_directory_path() / "opossum_load_table_test.tbl").string();
+};
+
+TEST_F(UtilsLoadTableTest, LoadTable) {
+  const auto table = load_table("src/test/tables/int_float.tbl", 2);
+
+  auto expected_table = std::make_shared<Table>(2);
+  expected_table->add_column("a", "int");
+  expected_table->add_column("b", "float");
+  expected_table->append({12345, 458.7f});
+  expected_table->append({123, 456.7f});
+  expected_table->append({1234, 457.7f});
+
+  EXPECT_TABLE_EQ(table, expected_table, true);
+  EXPECT_EQ(table->chunk_count(), 2u);
+  EXPECT_EQ(table->get_chunk(ChunkID{1}).size(), 1u);
+}
+
+TEST_F(UtilsLoadTableTest, AllTypes) {
+  const auto table = load_table(_write_file("a|b|c|d|e\nint|long|float|double|string\r\n"
+                                            "-1|5000000000|1.5|0.25|first value\r\n"
+                                            "\n"
+                                            "2|-3|1e3|-7|\n"),
+                                10);
+
+  ASSERT_EQ(table->row_count(), 2u);
+  const auto& chunk = table->get_chunk(ChunkID{0});
+  EXPECT_EQ((*chunk.get_segment(ColumnID{0}))[0], AllTypeVariant{-1});
+  EXPECT_EQ((*chunk.get_segment(ColumnID{1}))[0], AllTypeVariant{int64_t{5000000000}});
+  EXPECT_EQ((*chunk.get_segment(ColumnID{2}))[1], AllTypeVariant{1000.0f});
+  EXPECT_EQ((*chunk.get_segment(ColumnID{3}))[1], AllTypeVariant{-7.0});
+  EXPECT_EQ((*chunk.get_segment(ColumnID{4}))[0], AllTypeVariant{"first value"});
+  EXPECT_EQ((*chunk.get_segment(ColumnID{4}))[1], AllTypeVariant{""});
+}
+
+TEST_F(UtilsLoadTableTest, ParallelLoadKeepsRowOrder) {
+  // Large enough to be split into several ranges, whose partial chunks at the range boundaries are merged.
+  auto content = std::string{"a|b\nint|string\n"};
+  const auto row_count = 400'500;
+  for (auto row = 0; row < row_count; ++row) {
+    content += std::to_string(row) + "|" + std::to_string(row % 7) + "\n";
+  }
+  const auto table = load_table(_write_file(content), 1000, true);
+
+  ASSERT_EQ(table->row_count(), static_cast<uint64_t>(row_count));
+  ASSERT_EQ(table->chunk_count(), 401u);
+  EXPECT_EQ(table->statistics().row_count(), 400'000u);
+  EXPECT_EQ(table->statistics().chunk_count(), 400u);
+  auto row = 0;
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto& chunk = table->get_chunk(chunk_id);
+    // Only the last chunk is not full, so all others can be compressed.
+    const auto is_last_chunk = chunk_id + 1 == table->chunk_count();
+    EXPECT_EQ(chunk.size(), is_last_chunk ? 500u : 1000u);
+    const auto is_compressed =
+        std::dynamic_pointer_cast<DictionarySegment<int32_t>>(chunk.get_segment(ColumnID{0})) != nullptr;
+    EXPECT_EQ(is_compressed, !is_last_chunk);
+    // Compressed chunks, whether parsed as a whole or merged from the ends of two ranges, have zone maps.
+    const auto zone_map = std::dynamic_pointer_cast<const ZoneMap<int32_t>>(chunk.get_zone_map(ColumnID{0}));
+    EXPECT_EQ(zone_map != nullptr, !is_last_chunk);
+    if (zone_map) {
+      EXPECT_EQ(zone_map->min(), row);
+      EXPECT_EQ(zone_map->max(), row + 999);
+    }
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk.size(); ++chunk_offset, ++row) {
+      ASSERT_EQ((*chunk.get_segment(ColumnID{0}))[chunk_offset], AllTypeVariant{row});
+    }
+  }
+}
+
+TEST_F(UtilsLoadTableTest, CompressFullChunks) {
+  const auto table = load_table("src/test/tables/int_float.tbl", 2, true);
+
+  const auto full_segment = table->get_chunk(ChunkID{0}).get_segment(ColumnID{0});
+  const auto partial_segment = table->get_chunk(ChunkID{1}).get_segment(ColumnID{0});
+  EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<int32_t>>(full_segment));
+  EXPECT_TRUE(std::dynamic_pointer_cast<ValueSegment<int32_t>>(partial_segment));
+  EXPECT_EQ((*table->get_chunk(ChunkID{0}).get_segment(ColumnID{1}))[1], AllTypeVariant{456.7f});
+  // Only the compressed chunk is covered by the statistics.
+  EXPECT_EQ(table->statistics().row_count(), 2u);
+}
+
+TEST_F(UtilsLoadTableTest, ScanPrunesCompressedChunks) {
+  auto content = std::string{"a\nint\n"};
+  for (auto row = 0; row < 450; ++row) {
+    content += std::to_string(row) + "\n";
+  }
+  const auto table = load_table(_write_file(content), 100, true);
+  const auto zone_map =
+      std::dynamic_pointer_cast<const ZoneMap<int32_t>>(table->get_chunk(ChunkID{0}).get_zone_map(ColumnID{0}));
+  ASSERT_TRUE(zone_map);
+  EXPECT_TRUE(zone_map->can_prune(ScanType::OpGreaterThanEquals, 150));
+
+  // The scan trusts the zone maps without reading the segments, so a wrong zone map shows that chunk 2 is skipped.
+  table->get_chunk(ChunkID{2}).set_zone_map(ColumnID{0}, std::make_shared<ZoneMap<int32_t>>(0, 10));
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  auto table_scan = TableScan{table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 150};
+  table_scan.execute();
+  EXPECT_EQ(table_scan.get_output()->row_count(), 200u);
+}
+
+TEST_F(UtilsLoadTableTest, LoadTableFail) {
+  EXPECT_THROW(load_table("src/test/tables/does_not_exist.tbl", 2), std::logic_error);
+  EXPECT_THROW(load_table(_write_file("a|b\nint|int\n1|x\n"), 2), std::logic_error);
+  EXPECT_THROW(load_table(_write_file("a|b\nint|int\n1\n"), 2), std::logic_error);
+  EXPECT_THROW(load_table(_write_file("a|b\nint|int\n1|2|3\n"), 2), std::logic_error);
+  EXPECT_THROW(load_table(_write_file("a|b\nint|string\n1|x|y\n"), 2), std::logic_error);
+  EXPECT_THROW(load_table(_write_file("a|b\nint\n"), 2), std::logic_error);
+}
+
+TEST_F(UtilsLoadTableTest, EmptyFile) {
+  EXPECT_THROW(load_table(_write_file(""), 2), std::logic_error);
+
+  const auto table = load_table(_write_file("a|b\nint|int\n"), 2);
+  EXPECT_EQ(table->column_count(), 2u);
+  EXPECT_EQ(table->row_count(), 0u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,95 @@
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <memory_resource>
+#include <thread>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/types.hpp"
+#include "../lib/utils/memory_resources.hpp"
+
+namespace opossum {
+
+class UtilsMemoryResourcesTest : public BaseTest {};
+
+TEST_F(UtilsMemoryResourcesTest, MonotonicArena) {
+  auto arena = MonotonicArena{nullptr, 64};
+  auto values = pmr_vector<int64_t>(&arena);
+  values.reserve(100);
+  values.resize(100, 7);
+  EXPECT_EQ(arena.allocated_bytes(), 100 * sizeof(int64_t));
+
+  // Deallocating does not return any memory to the arena.
+  values = pmr_vector<int64_t>(&arena);
+  EXPECT_EQ(arena.allocated_bytes(), 100 * sizeof(int64_t));
+  EXPECT_TRUE(arena.is_equal(arena));
+  EXPECT_FALSE(arena.is_equal(MonotonicArena{}));
+}
+
+TEST_F(UtilsMemoryResourcesTest, MonotonicArenaConcurrently) {
+  auto arena = MonotonicArena{};
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_index = 0; thread_index < 4; ++thread_index) {
+    threads.emplace_back([&] {
+      for (auto allocation = 0; allocation < 1000; ++allocation) {
+        auto* const pointer = static_cast<char*>(arena.allocate(16, 8));
+        std::memset(pointer, 1, 16);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(arena.allocated_bytes(), 4u * 1000u * 16u);
+}
+
+TEST_F(UtilsMemoryResourcesTest, MonotonicArenaKeepsUpstreamAlive) {
+  auto upstream = std::make_shared<PageMemoryResource>();
+  const auto arena = std::make_shared<MonotonicArena>(upstream, PageMemoryResource::MIN_MAPPED_SIZE);
+  const auto weak_upstream = std::weak_ptr<PageMemoryResource>{upstream};
+  upstream.reset();
+
+  auto values = pmr_vector<uint8_t>(PageMemoryResource::MIN_MAPPED_SIZE, 1, arena.get());
+  EXPECT_FALSE(weak_upstream.expired());
+  EXPECT_EQ(values.back(), 1);
+}
+
+TEST_F(UtilsMemoryResourcesTest, PageMemoryResource) {
+  auto resource = PageMemoryResource{};
+  EXPECT_FALSE(resource.uses_huge_pages());
+  EXPECT_FALSE(resource.numa_node());
+
+  // Small allocations come from the heap, large ones are mapped, which aligns them to pages.
+  auto small_values = pmr_vector<int32_t>(16, 1, &resource);
+  auto large_values = pmr_vector<int32_t>(PageMemoryResource::MIN_MAPPED_SIZE, 2, &resource);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(large_values.data()) % 4096, 0u);
+  EXPECT_EQ(small_values.back(), 1);
+  EXPECT_EQ(large_values.back(), 2);
+
+  auto huge_page_resource = PageMemoryResource{true};
+  EXPECT_TRUE(huge_page_resource.uses_huge_pages());
+  EXPECT_FALSE(huge_page_resource.is_equal(resource));
+  auto huge_values = pmr_vector<uint8_t>(PageMemoryResource::HUGE_PAGE_SIZE + 1, 3, &huge_page_resource);
+  EXPECT_EQ(huge_values.back(), 3);
+}
+
+TEST_F(UtilsMemoryResourcesTest, PageMemoryResourceNumaNode) {
+  EXPECT_THROW(PageMemoryResource(false, 1000), std::logic_error);
+  if (!std::filesystem::exists("/sys/devices/system/node/node0")) GTEST_SKIP();
+
+  // Binding may be refused, e.g., in containers without the permission to set memory policies.
+  auto resource = PageMemoryResource{false, 0};
+  EXPECT_EQ(resource.numa_node(), 0u);
+  try {
+    auto values = pmr_vector<int32_t>(PageMemoryResource::MIN_MAPPED_SIZE, 4, &resource);
+    EXPECT_EQ(values.back(), 4);
+  } catch (const std::bad_alloc&) {
+    GTEST_SKIP();
+  }
+}
+
+}  // namespace opossum